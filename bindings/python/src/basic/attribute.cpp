@@ -22,12 +22,15 @@
  */
 
 #include "../common.hpp"
+#include "../numpy.hpp"
 
 #include <geode/basic/attribute.hpp>
 namespace geode
 {
     template < typename type >
-    void python_attribute_class(
+    pybind11::class_< VariableAttribute< type >, ReadOnlyAttribute< type >,
+        std::shared_ptr< VariableAttribute< type > > >
+        python_attribute_class(
         pybind11::module& module, const std::string& typestr )
     {
         const auto read_name = absl::StrCat( "ReadOnlyAttribute", typestr );
@@ -45,17 +48,42 @@ namespace geode
             .def( "set_value", &ConstantAttribute< type >::set_value )
             .def( "default_value", &ConstantAttribute< type >::default_value );
         const auto variable_name = absl::StrCat( "VariableAttribute", typestr );
-        pybind11::class_< VariableAttribute< type >, ReadOnlyAttribute< type >,
-            std::shared_ptr< VariableAttribute< type > > >(
-            module, variable_name.c_str() )
-            .def( "set_value", &VariableAttribute< type >::set_value )
-            .def( "default_value", &VariableAttribute< type >::default_value );
+        auto variable_class =
+            pybind11::class_< VariableAttribute< type >,
+                ReadOnlyAttribute< type >,
+                std::shared_ptr< VariableAttribute< type > > >(
+                module, variable_name.c_str() )
+                .def( "set_value", &VariableAttribute< type >::set_value )
+                .def( "default_value",
+                    &VariableAttribute< type >::default_value );
         const auto sparse_name = absl::StrCat( "SparseAttribute", typestr );
         pybind11::class_< SparseAttribute< type >, ReadOnlyAttribute< type >,
             std::shared_ptr< SparseAttribute< type > > >(
             module, sparse_name.c_str() )
             .def( "set_value", &SparseAttribute< type >::set_value )
             .def( "default_value", &SparseAttribute< type >::default_value );
+        return variable_class;
+    }
+
+    template < typename type >
+    void python_variable_attribute_arrays(
+        pybind11::class_< VariableAttribute< type >, ReadOnlyAttribute< type >,
+            std::shared_ptr< VariableAttribute< type > > >& variable_class )
+    {
+        variable_class
+            .def( "values_array",
+                []( pybind11::object attribute ) {
+                    return numpy_view(
+                        attribute.cast< const VariableAttribute< type >& >()
+                            .values(),
+                        attribute );
+                } )
+            .def( "modifiable_values_array", []( pybind11::object attribute ) {
+                return numpy_modifiable_view(
+                    attribute.cast< VariableAttribute< type >& >()
+                        .modifiable_values(),
+                    attribute );
+            } );
     }
 
     void define_attributes( pybind11::module& module )
@@ -77,13 +105,21 @@ namespace geode
             .def( "type", &AttributeBase::type )
             .def( "name", &AttributeBase::name );
         python_attribute_class< bool >( module, "Bool" );
-        python_attribute_class< int >( module, "Int" );
-        python_attribute_class< unsigned int >( module, "UInt" );
-        python_attribute_class< float >( module, "Float" );
-        python_attribute_class< double >( module, "Double" );
-        python_attribute_class< std::array< double, 2 > >(
+        auto int_class = python_attribute_class< int >( module, "Int" );
+        python_variable_attribute_arrays( int_class );
+        auto uint_class =
+            python_attribute_class< unsigned int >( module, "UInt" );
+        python_variable_attribute_arrays( uint_class );
+        auto float_class = python_attribute_class< float >( module, "Float" );
+        python_variable_attribute_arrays( float_class );
+        auto double_class =
+            python_attribute_class< double >( module, "Double" );
+        python_variable_attribute_arrays( double_class );
+        auto array2_class = python_attribute_class< std::array< double, 2 > >(
             module, "ArrayDouble2" );
-        python_attribute_class< std::array< double, 3 > >(
+        python_variable_attribute_arrays( array2_class );
+        auto array3_class = python_attribute_class< std::array< double, 3 > >(
             module, "ArrayDouble3" );
+        python_variable_attribute_arrays( array3_class );
     }
 } // namespace geode
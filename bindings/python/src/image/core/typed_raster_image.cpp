@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "../../common.hpp"
+#include "../../numpy.hpp"
+
+#include <geode/image/core/typed_raster_image.hpp>
+
+namespace geode
+{
+    template < typename Pixel, index_t dimension >
+    void python_typed_raster_image(
+        pybind11::module& module, std::string_view typestr )
+    {
+        using Image = TypedRasterImage< Pixel, dimension >;
+        const auto name =
+            absl::StrCat( "TypedRasterImage", dimension, "D", typestr );
+        pybind11::class_< Image, CellArray< dimension > >(
+            module, name.c_str() )
+            .def( pybind11::init< std::array< index_t, dimension > >() )
+            .def( "native_extension", &Image::native_extension )
+            .def( "value", &Image::value )
+            .def( "set_value", &Image::set_value )
+            .def( "clone", &Image::clone )
+            .def( "values_array",
+                []( pybind11::object image ) {
+                    return numpy_view(
+                        image.cast< const Image& >().values(), image );
+                } )
+            .def( "modifiable_values_array", []( pybind11::object image ) {
+                return numpy_modifiable_view(
+                    image.cast< Image& >().modifiable_values(), image );
+            } );
+    }
+
+    template < typename Pixel >
+    void python_typed_raster_image(
+        pybind11::module& module, std::string_view typestr )
+    {
+        python_typed_raster_image< Pixel, 2 >( module, typestr );
+        python_typed_raster_image< Pixel, 3 >( module, typestr );
+    }
+
+    void define_typed_raster_image( pybind11::module& module )
+    {
+        python_typed_raster_image< std::uint8_t >( module, "UInt8" );
+        python_typed_raster_image< std::uint16_t >( module, "UInt16" );
+        python_typed_raster_image< float >( module, "Float" );
+        python_typed_raster_image< double >( module, "Double" );
+        python_typed_raster_image< std::array< float, 3 > >(
+            module, "ArrayFloat3" );
+    }
+} // namespace geode
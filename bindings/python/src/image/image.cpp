@@ -34,6 +34,8 @@ namespace geode
     void define_raster_image( pybind11::module& );
     void define_raster_image_io( pybind11::module& );
     void define_rgb_color( pybind11::module& );
+    void define_typed_raster_image( pybind11::module& );
+    void define_typed_raster_image_io( pybind11::module& );
 } // namespace geode
 
 PYBIND11_MODULE( opengeode_py_image, module )
@@ -50,4 +52,6 @@ PYBIND11_MODULE( opengeode_py_image, module )
     geode::define_raster_image( module );
     geode::define_raster_image_io( module );
     geode::define_rgb_color( module );
+    geode::define_typed_raster_image( module );
+    geode::define_typed_raster_image_io( module );
 }
\ No newline at end of file
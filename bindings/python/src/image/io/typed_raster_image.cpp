@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "../../common.hpp"
+
+#include <geode/image/core/typed_raster_image.hpp>
+#include <geode/image/io/typed_raster_image_input.hpp>
+#include <geode/image/io/typed_raster_image_output.hpp>
+
+namespace geode
+{
+    template < typename Pixel, index_t dimension >
+    void python_typed_raster_image_io(
+        pybind11::module& module, std::string_view typestr )
+    {
+        const auto suffix = absl::StrCat( dimension, "D", typestr );
+        const auto save = absl::StrCat( "save_typed_raster_image", suffix );
+        module.def(
+            save.c_str(), &save_typed_raster_image< Pixel, dimension > );
+        const auto load = absl::StrCat( "load_typed_raster_image", suffix );
+        module.def(
+            load.c_str(), &load_typed_raster_image< Pixel, dimension > );
+        const auto loadable =
+            absl::StrCat( "is_typed_raster_image_loadable", suffix );
+        module.def( loadable.c_str(),
+            &is_typed_raster_image_loadable< Pixel, dimension > );
+        const auto saveable =
+            absl::StrCat( "is_typed_raster_image_saveable", suffix );
+        module.def( saveable.c_str(),
+            &is_typed_raster_image_saveable< Pixel, dimension > );
+    }
+
+    template < typename Pixel >
+    void python_typed_raster_image_io(
+        pybind11::module& module, std::string_view typestr )
+    {
+        python_typed_raster_image_io< Pixel, 2 >( module, typestr );
+        python_typed_raster_image_io< Pixel, 3 >( module, typestr );
+    }
+
+    void define_typed_raster_image_io( pybind11::module& module )
+    {
+        python_typed_raster_image_io< std::uint8_t >( module, "UInt8" );
+        python_typed_raster_image_io< std::uint16_t >( module, "UInt16" );
+        python_typed_raster_image_io< float >( module, "Float" );
+        python_typed_raster_image_io< double >( module, "Double" );
+        python_typed_raster_image_io< std::array< float, 3 > >(
+            module, "ArrayFloat3" );
+    }
+} // namespace geode
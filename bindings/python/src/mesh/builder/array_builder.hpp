@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "../../numpy.hpp"
+
+#include <geode/basic/assert.hpp>
+#include <geode/basic/range.hpp>
+
+#include <geode/geometry/point.hpp>
+
+namespace geode
+{
+    /*!
+     * Create one vertex per row of a (nb_points, dimension) array.
+     * @return Index of the first created vertex.
+     */
+    template < typename Builder >
+    index_t create_points_from_array(
+        Builder& builder, const NumpyInput< double >& points )
+    {
+        constexpr auto dimension = Builder::dim;
+        const auto nb_points = numpy_nb_rows( points, dimension );
+        const auto* values = points.data();
+        std::vector< Point< dimension > > new_points;
+        new_points.reserve( nb_points );
+        for( const auto p : Range{ nb_points } )
+        {
+            std::array< double, dimension > coordinates;
+            for( const auto d : Range{ dimension } )
+            {
+                coordinates[d] = values[p * dimension + d];
+            }
+            new_points.emplace_back( coordinates );
+        }
+        return builder.create_points( new_points );
+    }
+
+    /*!
+     * View a (nb_elements, nb_vertices) array of vertex indices as one
+     * array of vertices per element, without copy.
+     */
+    template < index_t nb_vertices >
+    absl::Span< const std::array< index_t, nb_vertices > > elements_from_array(
+        const NumpyInput< index_t >& elements )
+    {
+        static_assert( sizeof( std::array< index_t, nb_vertices > )
+                           == nb_vertices * sizeof( index_t ),
+            "[elements_from_array] Unexpected padding in vertex arrays" );
+        const auto nb_elements = numpy_nb_rows( elements, nb_vertices );
+        return { reinterpret_cast< const std::array< index_t, nb_vertices >* >(
+                     elements.data() ),
+            nb_elements };
+    }
+
+    /*!
+     * Raise a Python ValueError when the builder rejects the given arrays,
+     * e.g. for vertex indices out of the mesh.
+     */
+    template < typename Creator >
+    index_t create_from_arrays( const Creator& creator )
+    {
+        try
+        {
+            return creator();
+        }
+        catch( const OpenGeodeException& exception )
+        {
+            throw pybind11::value_error( exception.what() );
+        }
+    }
+
+    template < typename Builder >
+    index_t create_triangles_from_array(
+        Builder& builder, const NumpyInput< index_t >& triangles )
+    {
+        const auto elements = elements_from_array< 3 >( triangles );
+        if( elements.empty() )
+        {
+            return NO_ID;
+        }
+        return create_from_arrays( [&builder, &elements] {
+            return builder.create_triangles( elements );
+        } );
+    }
+
+    template < typename Builder >
+    index_t create_tetrahedra_from_array(
+        Builder& builder, const NumpyInput< index_t >& tetrahedra )
+    {
+        const auto elements = elements_from_array< 4 >( tetrahedra );
+        if( elements.empty() )
+        {
+            return NO_ID;
+        }
+        return create_from_arrays( [&builder, &elements] {
+            return builder.create_tetrahedra( elements );
+        } );
+    }
+
+    /*!
+     * Create polygons from a flat array of vertices and an array of offsets:
+     * vertices of polygon p are stored between offsets[p] and offsets[p+1].
+     * @return Index of the first created polygon.
+     */
+    template < typename Builder >
+    index_t create_polygons_from_arrays( Builder& builder,
+        const NumpyInput< index_t >& vertices,
+        const NumpyInput< index_t >& offsets )
+    {
+        const absl::Span< const index_t > polygons_vertices{ vertices.data(),
+            numpy_nb_rows( vertices, 1 ) };
+        const absl::Span< const index_t > polygons_offsets{ offsets.data(),
+            numpy_nb_rows( offsets, 1 ) };
+        return create_from_arrays(
+            [&builder, &polygons_vertices, &polygons_offsets] {
+                return builder.create_polygons(
+                    polygons_vertices, polygons_offsets );
+            } );
+    }
+} // namespace geode
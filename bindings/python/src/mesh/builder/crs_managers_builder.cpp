@@ -22,11 +22,13 @@
  */
 
 #include "../../common.hpp"
+#include "../../numpy.hpp"
 
 #include <geode/geometry/point.hpp>
 
 #include <geode/mesh/builder/coordinate_reference_system_manager_builder.hpp>
 #include <geode/mesh/builder/coordinate_reference_system_managers_builder.hpp>
+#include <geode/mesh/core/attribute_coordinate_reference_system.hpp>
 #include <geode/mesh/core/coordinate_reference_system_managers.hpp>
 
 #define PYTHON_CRS_MANAGERS_BUILDER( dimension )                               \
@@ -51,10 +53,37 @@
                 main_coordinate_reference_system_manager_builder )             \
         .def( "set_point",                                                     \
             &CoordinateReferenceSystemManagersBuilder##dimension##D::          \
-                set_point )
+                set_point )                                                    \
+        .def( "modifiable_points_array", &modifiable_points_array< dimension > )
 
 namespace geode
 {
+    /*!
+     * Writable view of the points stored in the active
+     * AttributeCoordinateReferenceSystem, without copy. Writes through the
+     * view are not tracked: getting it disables the geometric cache of the
+     * mesh.
+     */
+    template < index_t dimension >
+    pybind11::array modifiable_points_array( pybind11::object builder )
+    {
+        using Builder = CoordinateReferenceSystemManagersBuilder< dimension >;
+        auto crs_manager_builder =
+            builder.cast< Builder& >()
+                .main_coordinate_reference_system_manager_builder();
+        auto* attribute_crs =
+            dynamic_cast< AttributeCoordinateReferenceSystem< dimension >* >(
+                &crs_manager_builder.active_coordinate_reference_system() );
+        if( !attribute_crs )
+        {
+            throw pybind11::type_error( "Active CoordinateReferenceSystem "
+                                        "does not store points in an "
+                                        "attribute" );
+        }
+        return numpy_modifiable_view(
+            attribute_crs->modifiable_points(), builder );
+    }
+
     void define_crs_managers_builder( pybind11::module& module )
     {
         PYTHON_CRS_MANAGERS_BUILDER( 2 );
@@ -23,6 +23,8 @@
 
 #include "../../common.hpp"
 
+#include "array_builder.hpp"
+
 #include <geode/geometry/point.hpp>
 
 #include <geode/mesh/builder/edged_curve_builder.hpp>
@@ -35,7 +37,9 @@
         CoordinateReferenceSystemManagersBuilder##dimension##D >(              \
         module, name##dimension.c_str() )                                      \
         .def_static( "create", &EdgedCurveBuilder##dimension##D::create )      \
-        .def( "create_point", &EdgedCurveBuilder##dimension##D::create_point )
+        .def( "create_point", &EdgedCurveBuilder##dimension##D::create_point ) \
+        .def( "create_points",                                                 \
+            &create_points_from_array< EdgedCurveBuilder##dimension##D > )
 
 namespace geode
 {
@@ -23,6 +23,8 @@
 
 #include "../../common.hpp"
 
+#include "array_builder.hpp"
+
 #include <geode/geometry/point.hpp>
 
 #include <geode/mesh/builder/point_set_builder.hpp>
@@ -35,7 +37,9 @@
         CoordinateReferenceSystemManagersBuilder##dimension##D >(              \
         module, name##dimension.c_str() )                                      \
         .def_static( "create", &PointSetBuilder##dimension##D::create )        \
-        .def( "create_point", &PointSetBuilder##dimension##D::create_point )
+        .def( "create_point", &PointSetBuilder##dimension##D::create_point )   \
+        .def( "create_points",                                                 \
+            &create_points_from_array< PointSetBuilder##dimension##D > )
 
 namespace geode
 {
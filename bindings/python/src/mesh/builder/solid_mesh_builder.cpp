@@ -23,6 +23,8 @@
 
 #include "../../common.hpp"
 
+#include "array_builder.hpp"
+
 #include <geode/geometry/point.hpp>
 
 #include <geode/mesh/builder/solid_edges_builder.hpp>
@@ -37,6 +39,8 @@
         module, name##dimension.c_str() )                                      \
         .def_static( "create", &SolidMeshBuilder##dimension##D::create )       \
         .def( "create_point", &SolidMeshBuilder##dimension##D::create_point )  \
+        .def( "create_points",                                                 \
+            &create_points_from_array< SolidMeshBuilder##dimension##D > )      \
         .def( "create_polyhedron",                                             \
             &SolidMeshBuilder##dimension##D::create_polyhedron )               \
         .def( "set_polyhedron_vertex",                                         \
@@ -23,6 +23,8 @@
 
 #include "../../common.hpp"
 
+#include "array_builder.hpp"
+
 #include <geode/geometry/point.hpp>
 
 #include <geode/mesh/builder/surface_edges_builder.hpp>
@@ -38,6 +40,10 @@
         .def_static( "create", &SurfaceMeshBuilder##dimension##D::create )     \
         .def(                                                                  \
             "create_point", &SurfaceMeshBuilder##dimension##D::create_point )  \
+        .def( "create_points",                                                 \
+            &create_points_from_array< SurfaceMeshBuilder##dimension##D > )    \
+        .def( "create_polygons",                                               \
+            &create_polygons_from_arrays< SurfaceMeshBuilder##dimension##D > ) \
         .def( "create_polygon",                                                \
             &SurfaceMeshBuilder##dimension##D::create_polygon )                \
         .def( "set_polygon_vertex",                                            \
@@ -23,6 +23,8 @@
 
 #include "../../common.hpp"
 
+#include "array_builder.hpp"
+
 #include <geode/mesh/builder/tetrahedral_solid_builder.hpp>
 #include <geode/mesh/core/tetrahedral_solid.hpp>
 
@@ -34,7 +36,10 @@
         .def_static(                                                           \
             "create", &TetrahedralSolidBuilder##dimension##D::create )         \
         .def( "create_tetrahedron",                                            \
-            &TetrahedralSolidBuilder##dimension##D::create_tetrahedron )
+            &TetrahedralSolidBuilder##dimension##D::create_tetrahedron )       \
+        .def( "create_tetrahedra",                                             \
+            &create_tetrahedra_from_array<                                     \
+                TetrahedralSolidBuilder##dimension##D > )
 
 namespace geode
 {
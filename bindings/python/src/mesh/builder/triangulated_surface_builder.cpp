@@ -23,6 +23,8 @@
 
 #include "../../common.hpp"
 
+#include "array_builder.hpp"
+
 #include <geode/mesh/builder/triangulated_surface_builder.hpp>
 #include <geode/mesh/core/triangulated_surface.hpp>
 
@@ -34,7 +36,10 @@
         .def_static(                                                           \
             "create", &TriangulatedSurfaceBuilder##dimension##D::create )      \
         .def( "create_triangle",                                               \
-            &TriangulatedSurfaceBuilder##dimension##D::create_triangle )
+            &TriangulatedSurfaceBuilder##dimension##D::create_triangle )       \
+        .def( "create_triangles",                                              \
+            &create_triangles_from_array<                                      \
+                TriangulatedSurfaceBuilder##dimension##D > )
 
 namespace geode
 {
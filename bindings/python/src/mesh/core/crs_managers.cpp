@@ -22,9 +22,11 @@
  */
 
 #include "../../common.hpp"
+#include "../../numpy.hpp"
 
 #include <geode/geometry/point.hpp>
 
+#include <geode/mesh/core/attribute_coordinate_reference_system.hpp>
 #include <geode/mesh/core/coordinate_reference_system_manager.hpp>
 #include <geode/mesh/core/coordinate_reference_system_managers.hpp>
 
@@ -63,10 +65,34 @@
                     main_coordinate_reference_system_manager ),                \
             pybind11::return_value_policy::reference )                         \
         .def(                                                                  \
-            "point", &CoordinateReferenceSystemManagers##dimension##D::point )
+            "point", &CoordinateReferenceSystemManagers##dimension##D::point ) \
+        .def( "points_array", &points_array< dimension > )
 
 namespace geode
 {
+    /*!
+     * Read-only view of the points stored in the active
+     * AttributeCoordinateReferenceSystem, without copy.
+     */
+    template < index_t dimension >
+    pybind11::array points_array( pybind11::object crs_managers )
+    {
+        const auto& crs =
+            crs_managers
+                .cast< const CoordinateReferenceSystemManagers< dimension >& >()
+                .main_coordinate_reference_system_manager()
+                .active_coordinate_reference_system();
+        const auto* attribute_crs = dynamic_cast<
+            const AttributeCoordinateReferenceSystem< dimension >* >( &crs );
+        if( !attribute_crs )
+        {
+            throw pybind11::type_error( "Active CoordinateReferenceSystem "
+                                        "does not store points in an "
+                                        "attribute" );
+        }
+        return numpy_view( attribute_crs->points(), crs_managers );
+    }
+
     void define_crs_managers( pybind11::module& module )
     {
         PYTHON_CRS_MANAGERS( 2 );
@@ -23,6 +23,12 @@
 
 #include "../../common.hpp"
 
+#include "../../numpy.hpp"
+
+#include <geode/basic/range.hpp>
+
+#include <geode/mesh/core/geode/geode_polygonal_surface.hpp>
+
 #include <geode/mesh/core/polygonal_surface.hpp>
 
 #define PYTHON_POLYGONAL_SURFACE( dimension )                                  \
@@ -34,10 +40,46 @@
             static_cast<                                                       \
                 std::unique_ptr< PolygonalSurface##dimension##D > ( * )() >(   \
                 &PolygonalSurface##dimension##D::create ) )                    \
-        .def( "clone", &PolygonalSurface##dimension##D::clone )
+        .def( "clone", &PolygonalSurface##dimension##D::clone )                \
+        .def( "polygons_arrays", &polygons_arrays< dimension > )
 
 namespace geode
 {
+    /*!
+     * Polygon vertices as a pair of arrays (vertices, offsets): vertices of
+     * polygon p are stored between offsets[p] and offsets[p+1]. OpenGeode
+     * storage is viewed without copy, other implementations are copied.
+     */
+    template < index_t dimension >
+    pybind11::tuple polygons_arrays( pybind11::object surface )
+    {
+        const auto& mesh =
+            surface.cast< const PolygonalSurface< dimension >& >();
+        if( const auto* geode_mesh = dynamic_cast<
+                const OpenGeodePolygonalSurface< dimension >* >( &mesh ) )
+        {
+            return pybind11::make_tuple(
+                numpy_view( geode_mesh->polygons_vertices(), surface ),
+                numpy_view(
+                    geode_mesh->polygons_vertices_offsets(), surface ) );
+        }
+        std::vector< index_t > offsets( mesh.nb_polygons() + 1, 0 );
+        for( const auto p : Range{ mesh.nb_polygons() } )
+        {
+            offsets[p + 1] = offsets[p] + mesh.nb_polygon_vertices( p );
+        }
+        std::vector< index_t > vertices( offsets.back() );
+        for( const auto p : Range{ mesh.nb_polygons() } )
+        {
+            for( const auto v : LRange{ mesh.nb_polygon_vertices( p ) } )
+            {
+                vertices[offsets[p] + v] = mesh.polygon_vertex( { p, v } );
+            }
+        }
+        return pybind11::make_tuple( numpy_copy< index_t >( vertices ),
+            numpy_copy< index_t >( offsets ) );
+    }
+
     void define_polygonal_surface( pybind11::module& module )
     {
         PYTHON_POLYGONAL_SURFACE( 2 );
@@ -59,6 +59,12 @@
             &SolidMesh##dimension##D::are_facets_enabled )                     \
         .def( "enable_facets", &SolidMesh##dimension##D::enable_facets )       \
         .def( "disable_facets", &SolidMesh##dimension##D::disable_facets )     \
+        .def( "is_geometric_cache_enabled",                                    \
+            &SolidMesh##dimension##D::is_geometric_cache_enabled )             \
+        .def( "enable_geometric_cache",                                        \
+            &SolidMesh##dimension##D::enable_geometric_cache )                 \
+        .def( "disable_geometric_cache",                                       \
+            &SolidMesh##dimension##D::disable_geometric_cache )                \
         .def( "facets",                                                        \
             static_cast< const SolidFacets##dimension##D& (                    \
                 SolidMesh##dimension##D::*) () const >(                        \
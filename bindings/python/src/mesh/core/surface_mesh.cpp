@@ -43,6 +43,12 @@
             &SurfaceMesh##dimension##D::are_edges_enabled )                    \
         .def( "enable_edges", &SurfaceMesh##dimension##D::enable_edges )       \
         .def( "disable_edges", &SurfaceMesh##dimension##D::disable_edges )     \
+        .def( "is_geometric_cache_enabled",                                    \
+            &SurfaceMesh##dimension##D::is_geometric_cache_enabled )           \
+        .def( "enable_geometric_cache",                                        \
+            &SurfaceMesh##dimension##D::enable_geometric_cache )               \
+        .def( "disable_geometric_cache",                                       \
+            &SurfaceMesh##dimension##D::disable_geometric_cache )              \
         .def( "edges",                                                         \
             static_cast< const SurfaceEdges##dimension##D& (                   \
                 SurfaceMesh##dimension##D::*) () const >(                      \
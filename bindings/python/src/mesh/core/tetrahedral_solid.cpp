@@ -23,8 +23,13 @@
 
 #include "../../common.hpp"
 
+#include "../../numpy.hpp"
+
+#include <geode/basic/range.hpp>
+
 #include <geode/geometry/basic_objects/tetrahedron.hpp>
 #include <geode/geometry/basic_objects/triangle.hpp>
+#include <geode/mesh/core/geode/geode_tetrahedral_solid.hpp>
 #include <geode/mesh/core/tetrahedral_solid.hpp>
 
 #define PYTHON_TETRAHEDRAL_SOLID( dimension )                                  \
@@ -38,10 +43,35 @@
                 &TetrahedralSolid##dimension##D::create ) )                    \
         .def( "clone", &TetrahedralSolid##dimension##D::clone )                \
         .def( "tetrahedron", &TetrahedralSolid##dimension##D::tetrahedron )    \
-        .def( "triangle", &TetrahedralSolid##dimension##D::triangle )
+        .def( "triangle", &TetrahedralSolid##dimension##D::triangle )          \
+        .def( "tetrahedra_array", &tetrahedra_array )
 
 namespace geode
 {
+    /*!
+     * Tetrahedron vertices as a (nb_polyhedra, 4) array. OpenGeode storage is
+     * viewed without copy, other implementations are copied.
+     */
+    pybind11::array tetrahedra_array( pybind11::object solid )
+    {
+        const auto& mesh = solid.cast< const TetrahedralSolid3D& >();
+        if( const auto* geode_mesh =
+                dynamic_cast< const OpenGeodeTetrahedralSolid3D* >( &mesh ) )
+        {
+            return numpy_view( geode_mesh->tetrahedra_vertices(), solid );
+        }
+        std::vector< std::array< index_t, 4 > > tetrahedra(
+            mesh.nb_polyhedra() );
+        for( const auto t : Range{ mesh.nb_polyhedra() } )
+        {
+            for( const auto v : LRange{ 4 } )
+            {
+                tetrahedra[t][v] = mesh.polyhedron_vertex( { t, v } );
+            }
+        }
+        return numpy_copy< std::array< index_t, 4 > >( tetrahedra );
+    }
+
     void define_tetrahedral_solid( pybind11::module& module )
     {
         PYTHON_TETRAHEDRAL_SOLID( 3 );
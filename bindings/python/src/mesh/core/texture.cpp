@@ -26,6 +26,7 @@
 #include <geode/geometry/point.hpp>
 
 #include <geode/image/core/raster_image.hpp>
+#include <geode/image/core/rgb_color.hpp>
 
 #include <geode/mesh/core/texture1d.hpp>
 #include <geode/mesh/core/texture2d.hpp>
@@ -42,6 +43,12 @@
                 RasterImage< dimension >& image ) {                            \
                 texture.set_image( std::move( image ) );                       \
             } )                                                                \
+        .def( "build_mipmaps", &Texture< dimension >::build_mipmaps )          \
+        .def( "nb_mipmap_levels", &Texture< dimension >::nb_mipmap_levels )    \
+        .def( "mipmap", &Texture< dimension >::mipmap,                         \
+            pybind11::return_value_policy::reference_internal )                \
+        .def( "texture_value", &Texture< dimension >::texture_value )          \
+        .def( "texture_values", &Texture< dimension >::texture_values )        \
         .def( "texture_coordinates",                                           \
             &Texture< dimension >::texture_coordinates )                       \
         .def( "set_texture_coordinates",                                       \
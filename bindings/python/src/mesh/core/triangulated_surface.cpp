@@ -23,7 +23,12 @@
 
 #include "../../common.hpp"
 
+#include "../../numpy.hpp"
+
+#include <geode/basic/range.hpp>
+
 #include <geode/geometry/basic_objects/triangle.hpp>
+#include <geode/mesh/core/geode/geode_triangulated_surface.hpp>
 #include <geode/mesh/core/triangulated_surface.hpp>
 
 #define PYTHON_TRIANGULATED_SURFACE( dimension )                               \
@@ -36,10 +41,36 @@
                           TriangulatedSurface##dimension##D > ( * )() >(       \
                           &TriangulatedSurface##dimension##D::create ) )       \
         .def( "clone", &TriangulatedSurface##dimension##D::clone )             \
-        .def( "triangle", &TriangulatedSurface##dimension##D::triangle )
+        .def( "triangle", &TriangulatedSurface##dimension##D::triangle )       \
+        .def( "triangles_array", &triangles_array< dimension > )
 
 namespace geode
 {
+    /*!
+     * Triangle vertices as a (nb_polygons, 3) array. OpenGeode storage is
+     * viewed without copy, other implementations are copied.
+     */
+    template < index_t dimension >
+    pybind11::array triangles_array( pybind11::object surface )
+    {
+        const auto& mesh =
+            surface.cast< const TriangulatedSurface< dimension >& >();
+        if( const auto* geode_mesh = dynamic_cast<
+                const OpenGeodeTriangulatedSurface< dimension >* >( &mesh ) )
+        {
+            return numpy_view( geode_mesh->triangles_vertices(), surface );
+        }
+        std::vector< std::array< index_t, 3 > > triangles( mesh.nb_polygons() );
+        for( const auto t : Range{ mesh.nb_polygons() } )
+        {
+            for( const auto v : LRange{ 3 } )
+            {
+                triangles[t][v] = mesh.polygon_vertex( { t, v } );
+            }
+        }
+        return numpy_copy< std::array< index_t, 3 > >( triangles );
+    }
+
     void define_triangulated_surface( pybind11::module& module )
     {
         PYTHON_TRIANGULATED_SURFACE( 2 );
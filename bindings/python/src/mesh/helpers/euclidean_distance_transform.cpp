@@ -30,8 +30,20 @@ namespace geode
     void define_euclidean_distance_transform( pybind11::module& module )
     {
         module.def( "euclidean_distance_transform2D",
-            &euclidean_distance_transform< 2 > );
+            static_cast< std::shared_ptr< VariableAttribute< double > > ( * )(
+                const Grid2D&, absl::Span< const Grid2D::CellIndices >,
+                std::string_view ) >( &euclidean_distance_transform< 2 > ) );
         module.def( "euclidean_distance_transform3D",
-            &euclidean_distance_transform< 3 > );
+            static_cast< std::shared_ptr< VariableAttribute< double > > ( * )(
+                const Grid3D&, absl::Span< const Grid3D::CellIndices >,
+                std::string_view ) >( &euclidean_distance_transform< 3 > ) );
+        module.def( "euclidean_distance_transform_from_runs2D",
+            static_cast< std::shared_ptr< VariableAttribute< double > > ( * )(
+                const Grid2D&, absl::Span< const GridCellRun2D >,
+                std::string_view ) >( &euclidean_distance_transform< 2 > ) );
+        module.def( "euclidean_distance_transform_from_runs3D",
+            static_cast< std::shared_ptr< VariableAttribute< double > > ( * )(
+                const Grid3D&, absl::Span< const GridCellRun3D >,
+                std::string_view ) >( &euclidean_distance_transform< 3 > ) );
     }
 } // namespace geode
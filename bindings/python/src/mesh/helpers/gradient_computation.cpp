@@ -32,6 +32,15 @@
 #include <geode/mesh/core/triangulated_surface.hpp>
 #include <geode/mesh/helpers/gradient_computation.hpp>
 
+namespace
+{
+    std::vector< std::string_view > to_string_views(
+        const std::vector< std::string >& names )
+    {
+        return { names.begin(), names.end() };
+    }
+} // namespace
+
 namespace geode
 {
     void define_gradient_computation( pybind11::module& module )
@@ -42,6 +51,24 @@ namespace geode
             .def( "compute_surface_scalar_function_gradient3D",
                 &compute_surface_scalar_function_gradient< 3 > )
             .def( "compute_solid_scalar_function_gradient3D",
-                &compute_solid_scalar_function_gradient );
+                &compute_solid_scalar_function_gradient )
+            .def( "compute_surface_scalar_functions_gradients2D",
+                []( const SurfaceMesh2D& mesh,
+                    const std::vector< std::string >& names ) {
+                    return compute_surface_scalar_functions_gradients(
+                        mesh, to_string_views( names ) );
+                } )
+            .def( "compute_surface_scalar_functions_gradients3D",
+                []( const SurfaceMesh3D& mesh,
+                    const std::vector< std::string >& names ) {
+                    return compute_surface_scalar_functions_gradients(
+                        mesh, to_string_views( names ) );
+                } )
+            .def( "compute_solid_scalar_functions_gradients3D",
+                []( const SolidMesh3D& mesh,
+                    const std::vector< std::string >& names ) {
+                    return compute_solid_scalar_functions_gradients(
+                        mesh, to_string_views( names ) );
+                } );
     }
 } // namespace geode
\ No newline at end of file
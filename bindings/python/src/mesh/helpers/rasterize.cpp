@@ -30,12 +30,25 @@
 #include <geode/geometry/basic_objects/triangle.hpp>
 
 #include <geode/mesh/core/grid.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
 #include <geode/mesh/core/triangulated_surface.hpp>
 
 namespace geode
 {
     void define_rasterize( pybind11::module& module )
     {
+        pybind11::enum_< RASTERIZATION_VALUE >( module, "RasterizationValue" )
+            .value( "element_id", RASTERIZATION_VALUE::element_id )
+            .value( "nb_elements", RASTERIZATION_VALUE::nb_elements )
+            .export_values();
+        pybind11::class_< GridCellRun2D >( module, "GridCellRun2D" )
+            .def( pybind11::init<>() )
+            .def_readwrite( "first_cell", &GridCellRun2D::first_cell )
+            .def_readwrite( "nb_cells", &GridCellRun2D::nb_cells );
+        pybind11::class_< GridCellRun3D >( module, "GridCellRun3D" )
+            .def( pybind11::init<>() )
+            .def_readwrite( "first_cell", &GridCellRun3D::first_cell )
+            .def_readwrite( "nb_cells", &GridCellRun3D::nb_cells );
         module.def( "rasterize_segment2D", &rasterize_segment< 2 > );
         module.def( "rasterize_segment3D", &rasterize_segment< 3 > );
         module.def( "conservative_rasterize_segment2D",
@@ -48,6 +61,16 @@ namespace geode
             &conservative_rasterize_triangle< 3 > );
         module.def( "rasterize_tetrahedron", &rasterize_tetrahedron );
         module.def( "rasterize_closed_surface", &rasterize_closed_surface );
+        module.def(
+            "rasterize_tetrahedron_runs", &rasterize_tetrahedron_runs );
+        module.def(
+            "rasterize_closed_surface_runs", &rasterize_closed_surface_runs );
+        module.def(
+            "rasterize_tetrahedral_solid", &rasterize_tetrahedral_solid );
+        module.def(
+            "rasterize_triangulated_surface", &rasterize_triangulated_surface );
+        module.def( "grid_cell_runs2D", &grid_cell_runs< 2 > );
+        module.def( "grid_cell_runs3D", &grid_cell_runs< 3 > );
     }
 
 } // namespace geode
\ No newline at end of file
@@ -81,6 +81,7 @@ namespace geode
     void define_gradient_computation( pybind11::module& module );
     void define_mesh_crs_helper( pybind11::module& );
     void define_rasterize( pybind11::module& );
+    void define_signed_distance_transform( pybind11::module& );
 
     void define_vertex_set_io( pybind11::module& );
     void define_graph_io( pybind11::module& );
@@ -164,6 +165,7 @@ PYBIND11_MODULE( opengeode_py_mesh, module )
     geode::define_gradient_computation( module );
     geode::define_mesh_crs_helper( module );
     geode::define_rasterize( module );
+    geode::define_signed_distance_transform( module );
 
     geode::define_vertex_set_io( module );
     geode::define_graph_io( module );
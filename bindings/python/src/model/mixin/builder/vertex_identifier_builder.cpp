@@ -75,6 +75,10 @@ namespace geode
                 &VertexIdentifierBuilder::create_unique_vertices )
             .def( "set_unique_vertex",
                 &VertexIdentifierBuilder::set_unique_vertex )
+            .def( "set_unique_vertices",
+                static_cast< void ( VertexIdentifierBuilder::* )(
+                    const ComponentID&, absl::Span< const index_t > ) >(
+                    &VertexIdentifierBuilder::set_unique_vertices ) )
             .def( "update_unique_vertices",
                 &VertexIdentifierBuilder::update_unique_vertices )
             .def( "delete_isolated_vertices",
@@ -33,7 +33,17 @@ namespace geode
             .def( pybind11::init<>() )
             .def( "nb_unique_vertices", &VertexIdentifier::nb_unique_vertices )
             .def( "component_mesh_vertices",
-                &VertexIdentifier::component_mesh_vertices )
+                []( const VertexIdentifier& identifier,
+                    index_t unique_vertex_id ) {
+                    pybind11::list vertices;
+                    for( const auto& cmv :
+                        identifier.component_mesh_vertices_range(
+                            unique_vertex_id ) )
+                    {
+                        vertices.append( cmv.component_mesh_vertex() );
+                    }
+                    return vertices;
+                } )
             .def( "unique_vertex", &VertexIdentifier::unique_vertex );
 
         pybind11::class_< ComponentMeshVertex >( module, "ComponentMeshVertex" )
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <array>
+
+#include <pybind11/numpy.h>
+
+#include <absl/strings/str_cat.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Point );
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Describe how a value type is seen by NumPy: a scalar type and a number
+     * of scalar components per value.
+     */
+    template < typename T >
+    struct NumpyLayout
+    {
+        using Scalar = T;
+        static constexpr index_t nb_components = 1;
+    };
+
+    template < typename T, size_t size >
+    struct NumpyLayout< std::array< T, size > >
+    {
+        using Scalar = T;
+        static constexpr index_t nb_components = size;
+    };
+
+    template < index_t dimension >
+    struct NumpyLayout< Point< dimension > >
+    {
+        using Scalar = double;
+        static constexpr index_t nb_components = dimension;
+    };
+
+    /*!
+     * C-contiguous NumPy array given as input, converted if needed.
+     */
+    template < typename Scalar >
+    using NumpyInput = pybind11::array_t< Scalar,
+        pybind11::array::c_style | pybind11::array::forcecast >;
+
+    namespace detail
+    {
+        template < typename T >
+        pybind11::array numpy_array(
+            const T* data, index_t nb_values, pybind11::handle base )
+        {
+            using Layout = NumpyLayout< T >;
+            using Scalar = typename Layout::Scalar;
+            static_assert(
+                sizeof( T ) == Layout::nb_components * sizeof( Scalar ),
+                "[numpy_array] Value type is not a packed array of scalars" );
+            if( Layout::nb_components == 1 )
+            {
+                return pybind11::array_t< Scalar >( { nb_values },
+                    { sizeof( T ) }, reinterpret_cast< const Scalar* >( data ),
+                    base );
+            }
+            return pybind11::array_t< Scalar >(
+                { nb_values, Layout::nb_components },
+                { sizeof( T ), sizeof( Scalar ) },
+                reinterpret_cast< const Scalar* >( data ), base );
+        }
+    } // namespace detail
+
+    /*!
+     * Read-only NumPy view over contiguous values, without copy.
+     * @param[in] base Python object owning the memory, kept alive by the view.
+     */
+    template < typename T >
+    pybind11::array numpy_view(
+        absl::Span< const T > values, pybind11::handle base )
+    {
+        auto array = detail::numpy_array(
+            values.data(), static_cast< index_t >( values.size() ), base );
+        array.attr( "setflags" )( pybind11::arg( "write" ) = false );
+        return array;
+    }
+
+    /*!
+     * Writable NumPy view over contiguous values, without copy.
+     * @param[in] base Python object owning the memory, kept alive by the view.
+     */
+    template < typename T >
+    pybind11::array numpy_modifiable_view(
+        absl::Span< T > values, pybind11::handle base )
+    {
+        return detail::numpy_array(
+            values.data(), static_cast< index_t >( values.size() ), base );
+    }
+
+    /*!
+     * NumPy array owning a copy of the given values.
+     * Used when the storage of a mesh implementation is not contiguous.
+     */
+    template < typename T >
+    pybind11::array numpy_copy( absl::Span< const T > values )
+    {
+        return detail::numpy_array( values.data(),
+            static_cast< index_t >( values.size() ), pybind11::handle{} );
+    }
+
+    /*!
+     * Check that the given array has the expected number of components per
+     * row and return its number of rows.
+     */
+    template < typename Scalar >
+    index_t numpy_nb_rows(
+        const NumpyInput< Scalar >& array, index_t nb_components )
+    {
+        if( nb_components == 1 && array.ndim() == 1 )
+        {
+            return static_cast< index_t >( array.shape( 0 ) );
+        }
+        if( array.ndim() != 2
+            || array.shape( 1 ) != static_cast< pybind11::ssize_t >(
+                   nb_components ) )
+        {
+            throw pybind11::value_error( absl::StrCat(
+                "Expected an array with ", nb_components, " columns" ) );
+        }
+        return static_cast< index_t >( array.shape( 0 ) );
+    }
+} // namespace geode
@@ -52,6 +52,9 @@ def test_gradient_grid2D():
     attribute.set_value( 15, 8 )
     gradient_name = mesh.compute_surface_scalar_function_gradient2D( grid, scalar_function_name )
     print("Gradient attribute name: ", gradient_name)
+    gradient_names = mesh.compute_surface_scalar_functions_gradients2D( grid, [ scalar_function_name, scalar_function_name ] )
+    if len( gradient_names ) != 2 or gradient_names[0] == gradient_names[1]:
+        raise ValueError( "[Test] Wrong gradient names for multiple gradients computation" )
     mesh.save_regular_grid2D( grid, "grid_with_gradient.og_rgd2d" )
 
 def test_gradient_triangulated_surface2D():
@@ -26,6 +26,8 @@ if sys.version_info >= (3, 8, 0) and platform.system() == "Windows":
     for path in [x.strip() for x in os.environ['PATH'].split(';') if x]:
         os.add_dll_directory(path)
 
+import numpy
+
 import opengeode_py_basic as basic
 import opengeode_py_geometry as geom
 import opengeode_py_mesh as mesh
@@ -210,6 +212,36 @@ def test_permutation(surface, builder):
         raise ValueError("[Test] Wrong polygons_4 after polygon permute")
 
 
+def test_numpy_arrays():
+    surface = mesh.TriangulatedSurface3D.create()
+    builder = mesh.TriangulatedSurfaceBuilder3D.create(surface)
+    points = numpy.array(
+        [[0., 0., 0.], [1., 0., 0.], [0., 1., 0.], [1., 1., 1.]])
+    if builder.create_points(points) != 0:
+        raise ValueError("[Test] Wrong first vertex from array")
+    triangles = numpy.array([[0, 1, 2], [1, 3, 2]])
+    if builder.create_triangles(triangles) != 0:
+        raise ValueError("[Test] Wrong first triangle from array")
+    if surface.nb_vertices() != 4 or surface.nb_polygons() != 2:
+        raise ValueError("[Test] Wrong mesh size after array creation")
+    if not numpy.array_equal(surface.points_array(), points):
+        raise ValueError("[Test] Wrong points array")
+    if not numpy.array_equal(surface.triangles_array(), triangles):
+        raise ValueError("[Test] Wrong triangles array")
+    try:
+        builder.create_triangles(numpy.array([[0, 1, 4]]))
+        raise RuntimeError("[Test] Unknown vertex should be rejected")
+    except ValueError:
+        pass
+    if surface.nb_polygons() != 2:
+        raise ValueError("[Test] Rejected triangles should not be created")
+    if surface.points_array().flags.writeable:
+        raise ValueError("[Test] Points array should be read-only")
+    builder.modifiable_points_array()[3, 2] = 2.
+    if surface.point(3).value(2) != 2.:
+        raise ValueError("[Test] Points array should be a view")
+
+
 if __name__ == '__main__':
     mesh.OpenGeodeMeshLibrary.initialize()
     surface = mesh.TriangulatedSurface3D.create()
@@ -228,3 +260,4 @@ if __name__ == '__main__':
     test_permutation(surface, builder)
     test_delete_polygon(surface, builder)
     test_clone(surface)
+    test_numpy_arrays()
@@ -24,10 +24,13 @@
 #pragma once
 
 #include <algorithm>
+#include <iterator>
 #include <vector>
 
 #include <absl/algorithm/container.h>
 
+#include <async++.h>
+
 #include <geode/basic/common.hpp>
 #include <geode/basic/range.hpp>
 
@@ -133,6 +136,35 @@ namespace geode
         container.erase( last, container.end() );
     }
 
+    /*!
+     * Sort a range with a parallel merge sort.
+     * Result is the same as std::sort for a strict total order, stable
+     * sorting requires a tie-breaking comparison.
+     * @param[in] grain_size Below this number of elements, sorting is serial.
+     */
+    template < typename RandomIt, typename Comparison >
+    void parallel_sort( RandomIt begin,
+        RandomIt end,
+        Comparison comp,
+        std::ptrdiff_t grain_size = 65536 )
+    {
+        const auto size = std::distance( begin, end );
+        if( size <= grain_size )
+        {
+            std::sort( begin, end, comp );
+            return;
+        }
+        const auto middle = begin + size / 2;
+        async::parallel_invoke(
+            [begin, middle, &comp, grain_size] {
+                parallel_sort( begin, middle, comp, grain_size );
+            },
+            [middle, end, &comp, grain_size] {
+                parallel_sort( middle, end, comp, grain_size );
+            } );
+        std::inplace_merge( begin, middle, end, comp );
+    }
+
     /*!
      * Concatenate tuples into a single tuple.
      */
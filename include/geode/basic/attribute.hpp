@@ -28,6 +28,7 @@
 #include <typeinfo>
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
 
 #include <bitsery/bitsery.h>
 #include <bitsery/brief_syntax.h>
@@ -403,6 +404,26 @@ namespace geode
             return values_.size();
         }
 
+        /*!
+         * Contiguous storage of all the attribute values.
+         * @warning The returned view is invalidated when the number of
+         * elements changes.
+         */
+        [[nodiscard]] absl::Span< const T > values() const
+        {
+            return values_;
+        }
+
+        /*!
+         * Modifiable contiguous storage of all the attribute values.
+         * @warning The returned view is invalidated when the number of
+         * elements changes.
+         */
+        [[nodiscard]] absl::Span< T > modifiable_values()
+        {
+            return absl::MakeSpan( values_ );
+        }
+
     public:
         void compute_value( index_t from_element,
             index_t to_element,
@@ -443,6 +464,23 @@ namespace geode
                             []( Archive& a2, T& item ) {
                                 a2( item );
                             } );
+                    },
+                    []( Archive& a, VariableAttribute< T >& attribute ) {
+                        a.ext( attribute, bitsery::ext::BaseClass<
+                                              ReadOnlyAttribute< T > >{} );
+                        a( attribute.default_value_ );
+                        if constexpr( is_raw_serializable_v< T > )
+                        {
+                            serialize_raw_values( a, attribute.values_ );
+                        }
+                        else
+                        {
+                            a.container( attribute.values_,
+                                attribute.values_.max_size(),
+                                []( Archive& a2, T& item ) {
+                                    a2( item );
+                                } );
+                        }
                     } } } );
             values_.reserve( 10 );
         }
@@ -23,7 +23,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <type_traits>
+#include <vector>
 
 #include <absl/container/fixed_array.h>
 #include <absl/container/inlined_vector.h>
@@ -113,6 +117,53 @@ namespace geode
         absl::FixedArray< std::function< void( Archive &, T & ) > >
             serializers_;
     };
+
+    /*!
+     * Values that can be serialized as raw memory by serialize_raw_values.
+     */
+    template < typename T >
+    inline constexpr bool is_raw_serializable_v =
+        std::is_trivially_copyable_v< T > && !std::is_same_v< T, bool >;
+
+    /*!
+     * Serialize trivially copyable values as their raw memory: the number of
+     * values followed by bulk copies of chunks of at most
+     * RAW_VALUES_CHUNK_SIZE bytes, instead of one bitsery call per value.
+     * @warning Data are only portable between platforms sharing the same
+     * endianness and value layout.
+     */
+    template < typename Archive, typename T >
+    void serialize_raw_values( Archive &archive, std::vector< T > &values )
+    {
+        static_assert( is_raw_serializable_v< T >,
+            "[serialize_raw_values] Values should be trivially copyable" );
+        constexpr std::uint64_t RAW_VALUES_CHUNK_SIZE{ 1u << 24 };
+        constexpr auto is_reading = std::is_same_v< Archive, Deserializer >;
+        auto nb_values = static_cast< std::uint64_t >( values.size() );
+        archive.value8b( nb_values );
+        if constexpr( is_reading )
+        {
+            values.resize( nb_values );
+        }
+        auto *bytes = reinterpret_cast< std::uint8_t * >( values.data() );
+        const auto nb_bytes = nb_values * sizeof( T );
+        for( std::uint64_t offset = 0; offset < nb_bytes;
+             offset += RAW_VALUES_CHUNK_SIZE )
+        {
+            const auto chunk_size =
+                std::min( RAW_VALUES_CHUNK_SIZE, nb_bytes - offset );
+            if constexpr( is_reading )
+            {
+                archive.adapter().template readBuffer< 1 >(
+                    bytes + offset, chunk_size );
+            }
+            else
+            {
+                archive.adapter().template writeBuffer< 1 >(
+                    bytes + offset, chunk_size );
+            }
+        }
+    }
 } // namespace geode
 
 namespace bitsery
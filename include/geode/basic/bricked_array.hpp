@@ -0,0 +1,421 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include <absl/types/span.h>
+
+#include <geode/basic/common.hpp>
+#include <geode/basic/range.hpp>
+
+namespace geode
+{
+    /*!
+     * Storage of one value per cell of a regular array, split into cubic
+     * bricks of BRICK_SIZE cells in each direction. Values of a brick are
+     * contiguous (first direction fastest), so slices in any direction and
+     * local neighborhoods touch few memory pages.
+     * Bricks are allocated on first write, cells of other bricks read the
+     * default value. When a BrickLoader is set (see open_bricked_array),
+     * bricks are loaded on first access and can be released to bound the
+     * memory footprint.
+     */
+    template < typename T, index_t dimension >
+    class BrickedArray
+    {
+        OPENGEODE_DISABLE_COPY( BrickedArray );
+
+    public:
+        static constexpr index_t BRICK_SIZE{ 32 };
+        using CellIndices = std::array< index_t, dimension >;
+        using BrickLoader = std::function< void( index_t, absl::Span< T > ) >;
+
+        BrickedArray( CellIndices cells_number, T default_value )
+            : cells_number_( std::move( cells_number ) ),
+              default_value_( std::move( default_value ) ),
+              mutex_{ std::make_unique< std::mutex >() }
+        {
+            index_t nb_bricks{ 1 };
+            for( const auto d : LRange{ dimension } )
+            {
+                nb_bricks_[d] =
+                    ( cells_number_[d] + BRICK_SIZE - 1 ) / BRICK_SIZE;
+                nb_bricks *= nb_bricks_[d];
+            }
+            bricks_.resize( nb_bricks );
+            brick_pointers_ = std::vector< std::atomic< T* > >( nb_bricks );
+        }
+
+        BrickedArray( BrickedArray&& ) noexcept = default;
+        BrickedArray& operator=( BrickedArray&& ) noexcept = default;
+
+        [[nodiscard]] static constexpr index_t nb_cells_in_brick()
+        {
+            index_t nb_cells{ 1 };
+            for( const auto d : LRange{ dimension } )
+            {
+                geode_unused( d );
+                nb_cells *= BRICK_SIZE;
+            }
+            return nb_cells;
+        }
+
+        [[nodiscard]] index_t nb_cells_in_direction( index_t direction ) const
+        {
+            return cells_number_[direction];
+        }
+
+        [[nodiscard]] index_t nb_bricks() const
+        {
+            return static_cast< index_t >( bricks_.size() );
+        }
+
+        [[nodiscard]] index_t nb_bricks_in_direction( index_t direction ) const
+        {
+            return nb_bricks_[direction];
+        }
+
+        [[nodiscard]] const T& default_value() const
+        {
+            return default_value_;
+        }
+
+        [[nodiscard]] index_t brick( const CellIndices& cell ) const
+        {
+            index_t brick_id{ 0 };
+            for( const auto d : ReverseRange{ dimension } )
+            {
+                brick_id = brick_id * nb_bricks_[d] + cell[d] / BRICK_SIZE;
+            }
+            return brick_id;
+        }
+
+        [[nodiscard]] CellIndices brick_first_cell( index_t brick ) const
+        {
+            CellIndices cell;
+            for( const auto d : LRange{ dimension } )
+            {
+                cell[d] = ( brick % nb_bricks_[d] ) * BRICK_SIZE;
+                brick /= nb_bricks_[d];
+            }
+            return cell;
+        }
+
+        /*!
+         * Position of a cell inside the values of its brick.
+         */
+        [[nodiscard]] static index_t brick_local_index(
+            const CellIndices& cell )
+        {
+            index_t local_index{ 0 };
+            for( const auto d : ReverseRange{ dimension } )
+            {
+                local_index = local_index * BRICK_SIZE + cell[d] % BRICK_SIZE;
+            }
+            return local_index;
+        }
+
+        [[nodiscard]] const T& value( const CellIndices& cell ) const
+        {
+            const auto* data = brick_data( brick( cell ) );
+            if( !data )
+            {
+                return default_value_;
+            }
+            return data[brick_local_index( cell )];
+        }
+
+        void set_value( const CellIndices& cell, T value )
+        {
+            const auto brick_id = brick( cell );
+            brick_values_data( brick_id )[brick_local_index( cell )] =
+                std::move( value );
+        }
+
+        [[nodiscard]] bool is_brick_in_memory( index_t brick ) const
+        {
+            return brick_pointers_[brick].load( std::memory_order_acquire )
+                   != nullptr;
+        }
+
+        /*!
+         * Values of a brick, BRICK_SIZE cells per direction, first direction
+         * fastest. Cells outside the array keep the default value.
+         * The brick is loaded or allocated if needed.
+         */
+        [[nodiscard]] absl::Span< const T > brick_values( index_t brick ) const
+        {
+            return { brick_values_data( brick ), nb_cells_in_brick() };
+        }
+
+        [[nodiscard]] absl::Span< T > modifiable_brick_values( index_t brick )
+        {
+            return { brick_values_data( brick ), nb_cells_in_brick() };
+        }
+
+        void set_brick_loader( BrickLoader loader )
+        {
+            loader_ = std::move( loader );
+        }
+
+        [[nodiscard]] bool has_brick_loader() const
+        {
+            return static_cast< bool >( loader_ );
+        }
+
+        /*!
+         * Free the memory of a brick. It is loaded again on next access if a
+         * BrickLoader is set, otherwise its cells go back to the default
+         * value.
+         * @warning Not thread safe with concurrent accesses to this brick.
+         */
+        void release_brick( index_t brick )
+        {
+            std::lock_guard< std::mutex > lock{ *mutex_ };
+            brick_pointers_[brick].store( nullptr, std::memory_order_release );
+            bricks_[brick].reset();
+        }
+
+    private:
+        const T* brick_data( index_t brick ) const
+        {
+            if( const auto* data =
+                    brick_pointers_[brick].load( std::memory_order_acquire ) )
+            {
+                return data;
+            }
+            if( !loader_ )
+            {
+                return nullptr;
+            }
+            return brick_values_data( brick );
+        }
+
+        T* brick_values_data( index_t brick ) const
+        {
+            if( auto* data =
+                    brick_pointers_[brick].load( std::memory_order_acquire ) )
+            {
+                return data;
+            }
+            std::lock_guard< std::mutex > lock{ *mutex_ };
+            if( auto* data =
+                    brick_pointers_[brick].load( std::memory_order_relaxed ) )
+            {
+                return data;
+            }
+            auto values = std::make_unique< T[] >( nb_cells_in_brick() );
+            std::fill_n( values.get(), nb_cells_in_brick(), default_value_ );
+            if( loader_ )
+            {
+                loader_( brick, { values.get(), nb_cells_in_brick() } );
+            }
+            auto* data = values.get();
+            bricks_[brick] = std::move( values );
+            brick_pointers_[brick].store( data, std::memory_order_release );
+            return data;
+        }
+
+    private:
+        CellIndices cells_number_;
+        CellIndices nb_bricks_;
+        T default_value_;
+        BrickLoader loader_;
+        mutable std::vector< std::unique_ptr< T[] > > bricks_;
+        mutable std::vector< std::atomic< T* > > brick_pointers_;
+        std::unique_ptr< std::mutex > mutex_;
+    };
+
+    /*!
+     * Build a BrickedArray from a function returning the value of each cell.
+     * Cells are visited brick by brick.
+     * @param[in] cells_number Number of cells in each direction
+     * @param[in] default_value Value of the cells outside the array bounds
+     * @param[in] cell_value Function taking the CellIndices of a cell and
+     * returning its value
+     */
+    template < index_t dimension, typename T, typename CellValue >
+    [[nodiscard]] BrickedArray< T, dimension > build_bricked_array(
+        std::array< index_t, dimension > cells_number,
+        T default_value,
+        CellValue&& cell_value )
+    {
+        using Array = BrickedArray< T, dimension >;
+        Array array{ cells_number, std::move( default_value ) };
+        for( const auto brick : Range{ array.nb_bricks() } )
+        {
+            const auto first_cell = array.brick_first_cell( brick );
+            auto values = array.modifiable_brick_values( brick );
+            for( const auto local_index : Range{ Array::nb_cells_in_brick() } )
+            {
+                auto cell = first_cell;
+                auto remainder = local_index;
+                bool inside{ true };
+                for( const auto d : LRange{ dimension } )
+                {
+                    cell[d] += remainder % Array::BRICK_SIZE;
+                    remainder /= Array::BRICK_SIZE;
+                    inside = inside && cell[d] < cells_number[d];
+                }
+                if( inside )
+                {
+                    values[local_index] = cell_value( cell );
+                }
+            }
+        }
+        return array;
+    }
+
+    namespace detail
+    {
+        constexpr std::array< char, 8 > BRICKED_ARRAY_MAGIC{ 'O', 'G',
+            'B', 'R', 'I', 'C', 'K', '1' };
+
+        template < typename Value >
+        void write_raw( std::ofstream& file, const Value& value )
+        {
+            file.write(
+                reinterpret_cast< const char* >( &value ), sizeof( Value ) );
+        }
+
+        template < typename Value >
+        void read_raw( std::ifstream& file, Value& value )
+        {
+            file.read( reinterpret_cast< char* >( &value ), sizeof( Value ) );
+        }
+    } // namespace detail
+
+    /*!
+     * Save a BrickedArray in a binary file with a table of brick offsets, so
+     * that bricks can be loaded independently by open_bricked_array.
+     * Bricks never written and without loader are not stored.
+     */
+    template < typename T, index_t dimension >
+    void save_bricked_array(
+        const BrickedArray< T, dimension >& array, std::string_view filename )
+    {
+        static_assert( std::is_trivially_copyable< T >::value,
+            "[save_bricked_array] Values should be trivially copyable" );
+        std::ofstream file{ to_string( filename ), std::ios::binary };
+        OPENGEODE_EXCEPTION( file.good(),
+            "[save_bricked_array] Error while opening file: ", filename );
+        detail::write_raw( file, detail::BRICKED_ARRAY_MAGIC );
+        detail::write_raw( file, dimension );
+        detail::write_raw( file, BrickedArray< T, dimension >::BRICK_SIZE );
+        detail::write_raw( file, static_cast< index_t >( sizeof( T ) ) );
+        for( const auto d : LRange{ dimension } )
+        {
+            detail::write_raw( file, array.nb_cells_in_direction( d ) );
+        }
+        detail::write_raw( file, array.default_value() );
+        const auto offsets_position = file.tellp();
+        std::vector< uint64_t > offsets( array.nb_bricks(), 0 );
+        file.write( reinterpret_cast< const char* >( offsets.data() ),
+            offsets.size() * sizeof( uint64_t ) );
+        for( const auto brick : Range{ array.nb_bricks() } )
+        {
+            if( !array.is_brick_in_memory( brick )
+                && !array.has_brick_loader() )
+            {
+                continue;
+            }
+            offsets[brick] = static_cast< uint64_t >( file.tellp() );
+            const auto values = array.brick_values( brick );
+            file.write( reinterpret_cast< const char* >( values.data() ),
+                values.size() * sizeof( T ) );
+        }
+        file.seekp( offsets_position );
+        file.write( reinterpret_cast< const char* >( offsets.data() ),
+            offsets.size() * sizeof( uint64_t ) );
+        OPENGEODE_EXCEPTION( file.good(),
+            "[save_bricked_array] Error while writing file: ", filename );
+    }
+
+    /*!
+     * Open a file written by save_bricked_array. Only the header is read,
+     * bricks are loaded from the file on first access.
+     */
+    template < typename T, index_t dimension >
+    [[nodiscard]] BrickedArray< T, dimension > open_bricked_array(
+        std::string_view filename )
+    {
+        static_assert( std::is_trivially_copyable< T >::value,
+            "[open_bricked_array] Values should be trivially copyable" );
+        std::ifstream file{ to_string( filename ), std::ios::binary };
+        OPENGEODE_EXCEPTION( file.good(),
+            "[open_bricked_array] Error while opening file: ", filename );
+        std::array< char, 8 > magic;
+        index_t file_dimension;
+        index_t brick_size;
+        index_t value_size;
+        detail::read_raw( file, magic );
+        detail::read_raw( file, file_dimension );
+        detail::read_raw( file, brick_size );
+        detail::read_raw( file, value_size );
+        constexpr auto BRICK_SIZE = BrickedArray< T, dimension >::BRICK_SIZE;
+        OPENGEODE_EXCEPTION( file.good() && magic == detail::BRICKED_ARRAY_MAGIC
+                                 && file_dimension == dimension
+                                 && value_size == sizeof( T )
+                                 && brick_size == BRICK_SIZE,
+            "[open_bricked_array] Wrong file format: ", filename );
+        typename BrickedArray< T, dimension >::CellIndices cells_number;
+        for( const auto d : LRange{ dimension } )
+        {
+            detail::read_raw( file, cells_number[d] );
+        }
+        T default_value;
+        detail::read_raw( file, default_value );
+        BrickedArray< T, dimension > array{ cells_number, default_value };
+        auto offsets =
+            std::make_shared< std::vector< uint64_t > >( array.nb_bricks() );
+        file.read( reinterpret_cast< char* >( offsets->data() ),
+            offsets->size() * sizeof( uint64_t ) );
+        OPENGEODE_EXCEPTION( file.good(),
+            "[open_bricked_array] Error while reading file: ", filename );
+        array.set_brick_loader(
+            [path = to_string( filename ), offsets](
+                index_t brick, absl::Span< T > values ) {
+                const auto offset = ( *offsets )[brick];
+                if( offset == 0 )
+                {
+                    return;
+                }
+                std::ifstream brick_file{ path, std::ios::binary };
+                brick_file.seekg( static_cast< std::streamoff >( offset ) );
+                brick_file.read( reinterpret_cast< char* >( values.data() ),
+                    values.size() * sizeof( T ) );
+                OPENGEODE_EXCEPTION( brick_file.good(),
+                    "[BrickedArray] Error while loading brick ", brick,
+                    " from file: ", path );
+            } );
+        return array;
+    }
+} // namespace geode
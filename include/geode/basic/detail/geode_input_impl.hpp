@@ -27,10 +27,12 @@
 #include <string_view>
 
 #include <absl/strings/ascii.h>
+#include <absl/strings/str_cat.h>
 
 #include <geode/basic/filename.hpp>
 #include <geode/basic/identifier.hpp>
 #include <geode/basic/identifier_builder.hpp>
+#include <geode/basic/io_profiler.hpp>
 #include <geode/basic/logger.hpp>
 #include <geode/basic/timer.hpp>
 
@@ -78,9 +80,11 @@ namespace geode
                 std::string_view type, std::string_view filename, Args... args )
         {
             const Timer timer;
+            IOProfileScope profile{ absl::StrCat( type, " load ", filename ) };
             auto input = geode_object_input_reader< Factory >( filename );
             auto object = input->read( std::forward< Args >( args )... );
             update_default_name( object, filename );
+            profile.add_file_bytes( input->filename() );
             Logger::info(
                 type, " loaded from ", filename, " in ", timer.duration() );
             return object;
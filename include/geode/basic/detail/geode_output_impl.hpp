@@ -30,8 +30,10 @@
 #include <vector>
 
 #include <absl/strings/ascii.h>
+#include <absl/strings/str_cat.h>
 
 #include <geode/basic/filename.hpp>
+#include <geode/basic/io_profiler.hpp>
 #include <geode/basic/logger.hpp>
 #include <geode/basic/timer.hpp>
 
@@ -59,6 +61,7 @@ namespace geode
             std::string_view filename )
         {
             const Timer timer;
+            IOProfileScope profile{ absl::StrCat( type, " save ", filename ) };
             auto output = geode_object_output_writer< Factory >( filename );
             const auto directories = filepath_without_filename( filename );
             if( !directories.empty() )
@@ -66,6 +69,10 @@ namespace geode
                 std::filesystem::create_directories( directories );
             }
             auto result = output->write( object );
+            for( const auto& file : result )
+            {
+                profile.add_file_bytes( file );
+            }
             Logger::info(
                 type, " saved in ", filename, " in ", timer.duration() );
             return result;
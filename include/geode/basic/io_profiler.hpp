@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <absl/time/time.h>
+
+#include <geode/basic/common.hpp>
+#include <geode/basic/pimpl.hpp>
+
+namespace geode
+{
+    /*!
+     * Timing of one stage of a load or save operation.
+     * start is the offset from the beginning of the profile, top_level
+     * flags the outermost operation which opened the profile.
+     */
+    struct opengeode_basic_api IOProfileStage
+    {
+        std::string name;
+        absl::Duration start;
+        absl::Duration duration;
+        std::uintmax_t bytes{ 0 };
+        index_t thread{ 0 };
+        bool top_level{ false };
+    };
+
+    /*!
+     * Breakdown of a load or save operation, including the nested stages
+     * (e.g. each component mesh of a model) run on any thread.
+     */
+    struct opengeode_basic_api IOProfile
+    {
+        /*!
+         * Number of distinct threads on which stages were run
+         */
+        [[nodiscard]] index_t nb_threads() const;
+
+        /*!
+         * Ratio in [0, 1] between the time spent in stages and the time
+         * available on the threads used during the operation
+         */
+        [[nodiscard]] double thread_utilization() const;
+
+        [[nodiscard]] std::string string() const;
+
+        std::string name;
+        absl::Duration duration;
+        std::uintmax_t bytes{ 0 };
+        std::vector< IOProfileStage > stages;
+    };
+
+    /*!
+     * Collect I/O profiles of native loads and saves.
+     * Profiling is disabled until a hook is set, the hook is called with
+     * the complete profile each time an outermost load or save ends.
+     * Stages of loads and saves running concurrently are gathered in the
+     * same profile.
+     * @code
+     *   IOProfiler::set_hook( []( const IOProfile& profile ) {
+     *       Logger::info( profile.string() );
+     *   } );
+     * @endcode
+     */
+    class opengeode_basic_api IOProfiler
+    {
+        friend class IOProfileScope;
+
+    public:
+        using Hook = std::function< void( const IOProfile& ) >;
+
+        ~IOProfiler();
+
+        /*!
+         * Set the function receiving the profiles.
+         * An empty hook disables profiling.
+         */
+        static void set_hook( Hook hook );
+
+        [[nodiscard]] static bool is_enabled();
+
+    private:
+        IOProfiler();
+
+        [[nodiscard]] static IOProfiler& instance();
+
+        [[nodiscard]] static absl::Time begin_stage(
+            IOProfileStage& stage );
+
+        static void end_stage( IOProfileStage stage, absl::Time start );
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+
+    /*!
+     * RAII helper recording a profile stage from its construction to its
+     * destruction. Does nothing if profiling is disabled.
+     */
+    class opengeode_basic_api IOProfileScope
+    {
+        OPENGEODE_DISABLE_COPY_AND_MOVE( IOProfileScope );
+
+    public:
+        explicit IOProfileScope( std::string_view name );
+        ~IOProfileScope();
+
+        void add_bytes( std::uintmax_t bytes );
+
+        /*!
+         * Add the size of the given file, or of all the files in the given
+         * directory, to the stage bytes
+         */
+        void add_file_bytes( std::string_view filename );
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+} // namespace geode
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include <absl/strings/ascii.h>
+#include <absl/strings/str_cat.h>
+
+#include <async++.h>
+
+#include <geode/basic/filename.hpp>
+#include <geode/basic/progress_logger.hpp>
+#include <geode/basic/uuid.hpp>
+
+namespace geode
+{
+    namespace detail
+    {
+        template < typename Object >
+        [[nodiscard]] const Object& saved_object( const Object& object )
+        {
+            return object;
+        }
+
+        template < typename Object >
+        [[nodiscard]] const Object& saved_object(
+            const std::unique_ptr< Object >& object )
+        {
+            return *object;
+        }
+
+        /*!
+         * Unique file path next to the given one, keeping its extension so
+         * that the same output factory is used.
+         */
+        [[nodiscard]] inline std::string temporary_save_filename(
+            std::string_view filename )
+        {
+            std::filesystem::path path{ to_string( filename ) };
+            const auto temporary_name = absl::StrCat(
+                filename_without_extension( path ).string(), ".",
+                uuid{}.string(), ".", extension_from_filename( filename ) );
+            return path.replace_filename( temporary_name ).string();
+        }
+
+        /*!
+         * Final path of a file saved under the temporary name. Sidecar files
+         * of multi-file formats are named after the main file, next to it
+         * (e.g. "model.<uuid>_data.bin") or in a folder named after it
+         * (e.g. "model.<uuid>/block.bin"): the temporary prefix is replaced
+         * by the target one. Other files keep their path.
+         */
+        [[nodiscard]] inline std::filesystem::path final_save_filename(
+            std::string_view file,
+            std::string_view temporary,
+            std::string_view target )
+        {
+            const auto temporary_prefix =
+                filepath_without_extension( to_string( temporary ) ).string();
+            if( file.substr( 0, temporary_prefix.size() ) != temporary_prefix )
+            {
+                return to_string( file );
+            }
+            return absl::StrCat(
+                filepath_without_extension( to_string( target ) ).string(),
+                file.substr( temporary_prefix.size() ) );
+        }
+
+        /*!
+         * Rename the saved files from the temporary name to the target one.
+         * @return The renamed files.
+         */
+        [[nodiscard]] inline std::vector< std::string > rename_saved_files(
+            std::vector< std::string > files,
+            std::string_view temporary,
+            std::string_view target )
+        {
+            for( auto& file : files )
+            {
+                const std::filesystem::path saved{ file };
+                const auto renamed =
+                    final_save_filename( file, temporary, target );
+                if( renamed == saved )
+                {
+                    continue;
+                }
+                if( renamed.has_parent_path() )
+                {
+                    std::filesystem::create_directories(
+                        renamed.parent_path() );
+                }
+                std::filesystem::rename( saved, renamed );
+                if( saved.parent_path() != renamed.parent_path() )
+                {
+                    std::error_code error;
+                    std::filesystem::remove( saved.parent_path(), error );
+                }
+                file = renamed.string();
+            }
+            return files;
+        }
+
+        /*!
+         * Remove every entry of the target folder named after the temporary
+         * file: the main file, its sidecar files and folders. The save may
+         * have failed before returning its files, so they are found by
+         * their unique temporary prefix.
+         */
+        inline void remove_temporary_files( std::string_view temporary )
+        {
+            const std::filesystem::path temporary_path{ to_string(
+                temporary ) };
+            const auto prefix =
+                filename_without_extension( temporary_path ).string();
+            auto folder = temporary_path.parent_path();
+            if( folder.empty() )
+            {
+                folder = ".";
+            }
+            std::error_code error;
+            std::vector< std::filesystem::path > entries;
+            for( const auto& entry :
+                std::filesystem::directory_iterator{ folder, error } )
+            {
+                if( entry.path().filename().string().rfind( prefix, 0 ) == 0 )
+                {
+                    entries.push_back( entry.path() );
+                }
+            }
+            for( const auto& entry : entries )
+            {
+                std::filesystem::remove_all( entry, error );
+            }
+        }
+    } // namespace detail
+
+    /*!
+     * Save an object in a task of the async++ thread pool, without blocking
+     * the caller. The file is written under a temporary name in the target
+     * folder, then renamed to the target: readers see either the previous
+     * file or the complete new one. Sidecar files of multi-file formats are
+     * renamed the same way (see detail::final_save_filename), one after the
+     * other: together they are not replaced atomically.
+     * @param[in] object Object to save, or a std::unique_ptr to it. It is
+     * moved into the task: give a clone() to keep modifying the original.
+     * @param[in] filename Path to the file where save the object.
+     * @param[in] save Function saving the object, e.g. save_brep or
+     * save_triangulated_surface< 3 >.
+     * @return Task giving the saved files. Saving errors are rethrown by
+     * get().
+     */
+    template < typename Object, typename SaveFunction >
+    [[nodiscard]] async::task< std::vector< std::string > > save_async(
+        Object object, std::string_view filename, SaveFunction save )
+    {
+        auto target = expand_predefined_folders(
+            absl::StripAsciiWhitespace( filename ) );
+        return async::spawn( [object = std::move( object ),
+                                 target = std::move( target ),
+                                 save = std::move( save )] {
+            ProgressLogger logger{ absl::StrCat( "Saving ", target ), 2 };
+            const auto temporary = detail::temporary_save_filename( target );
+            std::vector< std::string > files;
+            try
+            {
+                files = save( detail::saved_object( object ), temporary );
+                logger.increment();
+                files = detail::rename_saved_files( files, temporary, target );
+            }
+            catch( ... )
+            {
+                detail::remove_temporary_files( temporary );
+                throw;
+            }
+            logger.increment();
+            return files;
+        } );
+    }
+} // namespace geode
@@ -0,0 +1,783 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <mutex>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/fixed_array.h>
+#include <absl/container/inlined_vector.h>
+
+#include <async++.h>
+
+#include <geode/basic/pimpl_impl.hpp>
+
+#include <geode/geometry/points_sort.hpp>
+#include <geode/geometry/wide_aabb.hpp>
+
+namespace geode
+{
+    /*!
+     * Wide AABB tree structure implementation
+     * The tree is built bottom-up from the element boxes sorted along the
+     * Morton curve: WIDTH consecutive elements form a leaf, WIDTH
+     * consecutive nodes form their parent, and so on up to the root.
+     * All the leaves are then at the same depth.
+     * Nodes are stored level by level in a single vector, the root first:
+     *                          ROOT
+     *                     /    |    |    \
+     *                    A1   A2    A3    A4
+     *                  / | | \ ...
+     *                 e0 e1 e2 e3  ...  (elements in leaves)
+     *  Storage: |ROOT|A1|A2|A3|A4|
+     * Child boxes are stored per axis in float arrays, relatively to the
+     * minimum of the global bounding box, and rounded outward.
+     */
+    template < index_t dimension >
+    class WideAABBTree< dimension >::Impl
+    {
+    public:
+        static constexpr index_t ROOT_INDEX{ 0 };
+        static constexpr local_index_t WIDTH{ 4 };
+
+        struct FloatBox
+        {
+            std::array< float, dimension > min;
+            std::array< float, dimension > max;
+        };
+
+        struct Node
+        {
+            Node()
+            {
+                for( auto& axis_min : min )
+                {
+                    axis_min.fill( std::numeric_limits< float >::infinity() );
+                }
+                for( auto& axis_max : max )
+                {
+                    axis_max.fill( -std::numeric_limits< float >::infinity() );
+                }
+                children.fill( NO_ID );
+            }
+
+            std::array< std::array< float, WIDTH >, dimension > min;
+            std::array< std::array< float, WIDTH >, dimension > max;
+            std::array< index_t, WIDTH > children;
+            local_index_t nb_children{ 0 };
+            bool is_leaf{ false };
+        };
+
+    public:
+        Impl() = default;
+
+        Impl( absl::Span< const BoundingBox< dimension > > bboxes )
+            : nb_bboxes_( bboxes.size() )
+        {
+            if( bboxes.empty() )
+            {
+                return;
+            }
+            absl::FixedArray< Point< dimension > > points( bboxes.size() );
+            for( const auto i : Indices{ bboxes } )
+            {
+                points[i] = bboxes[i].min() + bboxes[i].max();
+                root_box_.add_box( bboxes[i] );
+            }
+            origin_ = root_box_.min();
+            const auto mapping = morton_mapping< dimension >( points );
+
+            std::vector< index_t > level_sizes;
+            auto level_size = nb_bboxes_;
+            do
+            {
+                level_size = ( level_size + WIDTH - 1 ) / WIDTH;
+                level_sizes.push_back( level_size );
+            } while( level_size > 1 );
+            depth_ = level_sizes.size();
+            std::vector< index_t > level_offsets( depth_ );
+            index_t nb_nodes{ 0 };
+            for( const auto level : ReverseRange{ depth_ } )
+            {
+                level_offsets[level] = nb_nodes;
+                nb_nodes += level_sizes[level];
+            }
+            nodes_.resize( nb_nodes );
+
+            std::vector< BoundingBox< dimension > > level_boxes(
+                level_sizes[0] );
+            async::parallel_for( async::irange( index_t{ 0 }, level_sizes[0] ),
+                [&]( index_t leaf ) {
+                    auto& node = nodes_[level_offsets[0] + leaf];
+                    node.is_leaf = true;
+                    const auto begin = leaf * WIDTH;
+                    const auto end = std::min( begin + WIDTH, nb_bboxes_ );
+                    for( const auto e : Range{ begin, end } )
+                    {
+                        const auto element = mapping[e];
+                        set_child( node, element, bboxes[element] );
+                        level_boxes[leaf].add_box( bboxes[element] );
+                    }
+                } );
+            for( const auto level : Range{ 1, depth_ } )
+            {
+                std::vector< BoundingBox< dimension > > parent_boxes(
+                    level_sizes[level] );
+                async::parallel_for(
+                    async::irange( index_t{ 0 }, level_sizes[level] ),
+                    [&]( index_t parent ) {
+                        auto& node = nodes_[level_offsets[level] + parent];
+                        const auto begin = parent * WIDTH;
+                        const auto end =
+                            std::min( begin + WIDTH, level_sizes[level - 1] );
+                        for( const auto child : Range{ begin, end } )
+                        {
+                            set_child( node, level_offsets[level - 1] + child,
+                                level_boxes[child] );
+                            parent_boxes[parent].add_box( level_boxes[child] );
+                        }
+                    } );
+                level_boxes = std::move( parent_boxes );
+            }
+
+            const auto grain = async::detail::auto_grain_size( bboxes.size() );
+            const auto nb_async_depth = static_cast< index_t >(
+                std::log2( grain ) / std::log2( WIDTH ) );
+            async_depth_ =
+                depth_ > nb_async_depth ? depth_ - nb_async_depth : 0;
+        }
+
+        [[nodiscard]] index_t nb_bboxes() const
+        {
+            return nb_bboxes_;
+        }
+
+        [[nodiscard]] const BoundingBox< dimension >& bounding_box() const
+        {
+            return root_box_;
+        }
+
+        [[nodiscard]] std::size_t memory_size() const
+        {
+            return nodes_.size() * sizeof( Node );
+        }
+
+        [[nodiscard]] static float round_down( double value )
+        {
+            return std::nextafter( to_float( value ),
+                -std::numeric_limits< float >::infinity() );
+        }
+
+        [[nodiscard]] static float round_up( double value )
+        {
+            return std::nextafter(
+                to_float( value ), std::numeric_limits< float >::infinity() );
+        }
+
+        [[nodiscard]] FloatBox to_float_box(
+            const BoundingBox< dimension >& box ) const
+        {
+            FloatBox result;
+            for( const auto axis : LRange{ dimension } )
+            {
+                const auto& origin = origin_.value( axis );
+                result.min[axis] =
+                    round_down( box.min().value( axis ) - origin );
+                result.max[axis] = round_up( box.max().value( axis ) - origin );
+            }
+            return result;
+        }
+
+        [[nodiscard]] FloatBox to_float_box(
+            const Point< dimension >& point ) const
+        {
+            FloatBox result;
+            for( const auto axis : LRange{ dimension } )
+            {
+                const auto value = point.value( axis ) - origin_.value( axis );
+                result.min[axis] = round_down( value );
+                result.max[axis] = round_up( value );
+            }
+            return result;
+        }
+
+        [[nodiscard]] BoundingBox< dimension > child_box(
+            const Node& node, local_index_t lane ) const
+        {
+            Point< dimension > min;
+            Point< dimension > max;
+            for( const auto axis : LRange{ dimension } )
+            {
+                min.set_value(
+                    axis, origin_.value( axis ) + node.min[axis][lane] );
+                max.set_value(
+                    axis, origin_.value( axis ) + node.max[axis][lane] );
+            }
+            return { min, max };
+        }
+
+        [[nodiscard]] static unsigned full_mask( const Node& node )
+        {
+            return ( 1u << node.nb_children ) - 1;
+        }
+
+        /*!
+         * Test the WIDTH child boxes against the given box at once.
+         * Empty child slots have inverted boxes and never overlap.
+         */
+        [[nodiscard]] static unsigned overlap_mask(
+            const Node& node, const FloatBox& box )
+        {
+            std::array< bool, WIDTH > overlap;
+            overlap.fill( true );
+            for( const auto axis : LRange{ dimension } )
+            {
+                for( const auto lane : LRange{ WIDTH } )
+                {
+                    overlap[lane] &=
+                        ( node.min[axis][lane] <= box.max[axis] )
+                        & ( node.max[axis][lane] >= box.min[axis] );
+                }
+            }
+            unsigned mask{ 0 };
+            for( const auto lane : LRange{ WIDTH } )
+            {
+                mask |= static_cast< unsigned >( overlap[lane] ) << lane;
+            }
+            return mask;
+        }
+
+        template < typename Object >
+        [[nodiscard]] unsigned object_mask(
+            const Node& node, const Object& object ) const
+        {
+            unsigned mask{ 0 };
+            for( const auto lane : LRange{ node.nb_children } )
+            {
+                if( child_box( node, lane ).intersects( object ) )
+                {
+                    mask |= 1u << lane;
+                }
+            }
+            return mask;
+        }
+
+        [[nodiscard]] double child_distance( const Node& node,
+            local_index_t lane,
+            const std::array< double, dimension >& query ) const
+        {
+            double distance2{ 0 };
+            for( const auto axis : LRange{ dimension } )
+            {
+                const auto gap = std::max(
+                    { node.min[axis][lane] - query[axis],
+                        query[axis] - node.max[axis][lane], 0. } );
+                distance2 += gap * gap;
+            }
+            return std::sqrt( distance2 );
+        }
+
+        [[nodiscard]] std::array< double, dimension > relative_point(
+            const Point< dimension >& point ) const
+        {
+            std::array< double, dimension > result;
+            for( const auto axis : LRange{ dimension } )
+            {
+                result[axis] = point.value( axis ) - origin_.value( axis );
+            }
+            return result;
+        }
+
+        /*!
+         * Run the task on each child selected by the mask, in parallel near
+         * the root of the tree.
+         * @return true if one of the tasks asked to stop the search.
+         */
+        template < typename Task >
+        bool for_each_child( const Node& node,
+            unsigned mask,
+            index_t depth,
+            const Task& task ) const
+        {
+            if( depth > async_depth_ )
+            {
+                for( const auto lane : LRange{ node.nb_children } )
+                {
+                    if( ( mask & ( 1u << lane ) ) && task( lane ) )
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+            absl::InlinedVector< local_index_t, WIDTH > lanes;
+            for( const auto lane : LRange{ node.nb_children } )
+            {
+                if( mask & ( 1u << lane ) )
+                {
+                    lanes.push_back( lane );
+                }
+            }
+            std::atomic< bool > stop{ false };
+            async::parallel_for( lanes, [&task, &stop]( local_index_t lane ) {
+                if( task( lane ) )
+                {
+                    stop = true;
+                }
+            } );
+            return stop;
+        }
+
+        template < typename MaskFunctor, typename ACTION >
+        bool intersect_recursive( index_t node_index,
+            index_t depth,
+            const MaskFunctor& mask_functor,
+            ACTION& action ) const
+        {
+            OPENGEODE_ASSERT(
+                node_index < nodes_.size(), "Node out of tree range" );
+            const auto& node = nodes_[node_index];
+            const auto mask = mask_functor( node );
+            if( node.is_leaf )
+            {
+                for( const auto lane : LRange{ node.nb_children } )
+                {
+                    if( ( mask & ( 1u << lane ) )
+                        && action( node.children[lane] ) )
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+            return for_each_child(
+                node, mask, depth, [&]( local_index_t lane ) {
+                    return intersect_recursive(
+                        node.children[lane], depth + 1, mask_functor, action );
+                } );
+        }
+
+        template < typename ACTION >
+        bool box_intersect_recursive( const FloatBox& box,
+            index_t node_index,
+            index_t depth,
+            ACTION& action ) const
+        {
+            return intersect_recursive( node_index, depth,
+                [&box]( const Node& node ) {
+                    return overlap_mask( node, box );
+                },
+                action );
+        }
+
+        template < typename Object, typename ACTION >
+        bool object_intersect_recursive(
+            const Object& object, index_t depth, ACTION& action ) const
+        {
+            return intersect_recursive( ROOT_INDEX, depth,
+                [this, &object]( const Node& node ) {
+                    return object_mask( node, object );
+                },
+                action );
+        }
+
+        template < typename ACTION >
+        bool self_intersect_recursive(
+            index_t node_index, index_t depth, ACTION& action ) const
+        {
+            const auto& node = nodes_[node_index];
+            return for_each_child( node, full_mask( node ), depth,
+                [&]( local_index_t lane ) {
+                    if( !node.is_leaf
+                        && self_intersect_recursive(
+                            node.children[lane], depth + 1, action ) )
+                    {
+                        return true;
+                    }
+                    FloatBox box;
+                    for( const auto axis : LRange{ dimension } )
+                    {
+                        box.min[axis] = node.min[axis][lane];
+                        box.max[axis] = node.max[axis][lane];
+                    }
+                    const auto mask = overlap_mask( node, box );
+                    for( const auto other_lane :
+                        LRange{ lane + 1, node.nb_children } )
+                    {
+                        if( !( mask & ( 1u << other_lane ) ) )
+                        {
+                            continue;
+                        }
+                        if( node.is_leaf )
+                        {
+                            if( action( node.children[lane],
+                                    node.children[other_lane] ) )
+                            {
+                                return true;
+                            }
+                        }
+                        else if( pair_intersect_recursive( node.children[lane],
+                                     node.children[other_lane], depth + 1,
+                                     action ) )
+                        {
+                            return true;
+                        }
+                    }
+                    return false;
+                } );
+        }
+
+        /*!
+         * Intersect two different nodes of the tree, lying at the same
+         * depth since all leaves are at the same depth.
+         */
+        template < typename ACTION >
+        bool pair_intersect_recursive( index_t node_index1,
+            index_t node_index2,
+            index_t depth,
+            ACTION& action ) const
+        {
+            const auto& node1 = nodes_[node_index1];
+            const auto& node2 = nodes_[node_index2];
+            return for_each_child( node1, full_mask( node1 ), depth,
+                [&]( local_index_t lane1 ) {
+                    FloatBox box;
+                    for( const auto axis : LRange{ dimension } )
+                    {
+                        box.min[axis] = node1.min[axis][lane1];
+                        box.max[axis] = node1.max[axis][lane1];
+                    }
+                    const auto mask = overlap_mask( node2, box );
+                    for( const auto lane2 : LRange{ node2.nb_children } )
+                    {
+                        if( !( mask & ( 1u << lane2 ) ) )
+                        {
+                            continue;
+                        }
+                        if( node1.is_leaf )
+                        {
+                            if( action( node1.children[lane1],
+                                    node2.children[lane2] ) )
+                            {
+                                return true;
+                            }
+                        }
+                        else if( pair_intersect_recursive(
+                                     node1.children[lane1],
+                                     node2.children[lane2], depth + 1,
+                                     action ) )
+                        {
+                            return true;
+                        }
+                    }
+                    return false;
+                } );
+        }
+
+        /*!
+         * Intersect a node of this tree with a node of the other tree.
+         * Since the trees may have different depths, when one of the node is
+         * a leaf, its elements are intersected with the subtree of the other
+         * one.
+         */
+        template < typename ACTION >
+        bool other_intersect_recursive( index_t node_index1,
+            index_t depth,
+            const Impl& other,
+            index_t node_index2,
+            ACTION& action ) const
+        {
+            const auto& node1 = nodes_[node_index1];
+            const auto& node2 = other.nodes_[node_index2];
+            return for_each_child( node1, full_mask( node1 ), depth,
+                [&]( local_index_t lane1 ) {
+                    const auto child1 = node1.children[lane1];
+                    const auto box1 = child_box( node1, lane1 );
+                    const auto mask =
+                        overlap_mask( node2, other.to_float_box( box1 ) );
+                    for( const auto lane2 : LRange{ node2.nb_children } )
+                    {
+                        if( !( mask & ( 1u << lane2 ) ) )
+                        {
+                            continue;
+                        }
+                        const auto child2 = node2.children[lane2];
+                        if( node1.is_leaf && node2.is_leaf )
+                        {
+                            if( action( child1, child2 ) )
+                            {
+                                return true;
+                            }
+                        }
+                        else if( node1.is_leaf )
+                        {
+                            auto element_action =
+                                [&action, child1]( index_t element2 ) {
+                                    return action( child1, element2 );
+                                };
+                            if( other.box_intersect_recursive(
+                                    other.to_float_box( box1 ), child2,
+                                    depth + 1, element_action ) )
+                            {
+                                return true;
+                            }
+                        }
+                        else if( node2.is_leaf )
+                        {
+                            auto element_action =
+                                [&action, child2]( index_t element1 ) {
+                                    return action( element1, child2 );
+                                };
+                            if( box_intersect_recursive(
+                                    to_float_box(
+                                        other.child_box( node2, lane2 ) ),
+                                    child1, depth + 1, element_action ) )
+                            {
+                                return true;
+                            }
+                        }
+                        else if( other_intersect_recursive( child1, depth + 1,
+                                     other, child2, action ) )
+                        {
+                            return true;
+                        }
+                    }
+                    return false;
+                } );
+        }
+
+        [[nodiscard]] index_t closest_element_box_hint(
+            const std::array< double, dimension >& query ) const
+        {
+            auto node_index = ROOT_INDEX;
+            while( true )
+            {
+                const auto& node = nodes_[node_index];
+                local_index_t nearest_lane{ 0 };
+                auto nearest_distance = child_distance( node, 0, query );
+                for( const auto lane : LRange{ 1, node.nb_children } )
+                {
+                    const auto distance = child_distance( node, lane, query );
+                    if( distance < nearest_distance )
+                    {
+                        nearest_distance = distance;
+                        nearest_lane = lane;
+                    }
+                }
+                if( node.is_leaf )
+                {
+                    return node.children[nearest_lane];
+                }
+                node_index = node.children[nearest_lane];
+            }
+        }
+
+        template < typename ACTION >
+        void closest_element_box_recursive( const Point< dimension >& query,
+            const std::array< double, dimension >& relative_query,
+            index_t& nearest_box,
+            double& distance,
+            index_t node_index,
+            const ACTION& action ) const
+        {
+            const auto& node = nodes_[node_index];
+            absl::InlinedVector< std::pair< double, local_index_t >, WIDTH >
+                candidates;
+            for( const auto lane : LRange{ node.nb_children } )
+            {
+                const auto lane_distance =
+                    child_distance( node, lane, relative_query );
+                if( lane_distance < distance )
+                {
+                    candidates.emplace_back( lane_distance, lane );
+                }
+            }
+            // Traverse the "nearest" children first, so that they have more
+            // chances to prune the traversal of the other ones.
+            absl::c_sort( candidates );
+            for( const auto& [lane_distance, lane] : candidates )
+            {
+                if( lane_distance >= distance )
+                {
+                    break;
+                }
+                if( node.is_leaf )
+                {
+                    const auto cur_box = node.children[lane];
+                    const auto cur_distance = action( query, cur_box );
+                    if( cur_distance < distance )
+                    {
+                        nearest_box = cur_box;
+                        distance = cur_distance;
+                    }
+                }
+                else
+                {
+                    closest_element_box_recursive( query, relative_query,
+                        nearest_box, distance, node.children[lane], action );
+                }
+            }
+        }
+
+    private:
+        [[nodiscard]] static float to_float( double value )
+        {
+            const auto max =
+                static_cast< double >( std::numeric_limits< float >::max() );
+            return static_cast< float >( std::clamp( value, -max, max ) );
+        }
+
+        void set_child( Node& node,
+            index_t child,
+            const BoundingBox< dimension >& box ) const
+        {
+            const auto lane = node.nb_children++;
+            node.children[lane] = child;
+            const auto float_box = to_float_box( box );
+            for( const auto axis : LRange{ dimension } )
+            {
+                node.min[axis][lane] = float_box.min[axis];
+                node.max[axis][lane] = float_box.max[axis];
+            }
+        }
+
+    private:
+        std::vector< Node > nodes_;
+        index_t nb_bboxes_{ 0 };
+        BoundingBox< dimension > root_box_;
+        Point< dimension > origin_;
+        index_t depth_{ 1 };
+        index_t async_depth_{ 0 };
+    };
+
+    template < index_t dimension >
+    template < typename EvalDistance >
+    std::tuple< index_t, double >
+        WideAABBTree< dimension >::closest_element_box(
+            const Point< dimension >& query, const EvalDistance& action ) const
+    {
+        if( nb_bboxes() == 0 )
+        {
+            return std::make_tuple( NO_ID, 0 );
+        }
+        const auto relative_query = impl_->relative_point( query );
+        auto nearest_box = impl_->closest_element_box_hint( relative_query );
+        auto distance = action( query, nearest_box );
+        impl_->closest_element_box_recursive( query, relative_query,
+            nearest_box, distance, Impl::ROOT_INDEX, action );
+        OPENGEODE_ASSERT( nearest_box != NO_ID, "No box found" );
+        return std::make_tuple( nearest_box, distance );
+    }
+
+    template < index_t dimension >
+    template < class EvalIntersection >
+    void WideAABBTree< dimension >::compute_bbox_element_bbox_intersections(
+        const BoundingBox< dimension >& box, EvalIntersection& action ) const
+    {
+        if( nb_bboxes() == 0 )
+        {
+            return;
+        }
+        impl_->box_intersect_recursive(
+            impl_->to_float_box( box ), Impl::ROOT_INDEX, 0, action );
+    }
+
+    template < index_t dimension >
+    template < class EvalIntersection >
+    void WideAABBTree< dimension >::compute_self_element_bbox_intersections(
+        EvalIntersection& action ) const
+    {
+        if( nb_bboxes() == 0 )
+        {
+            return;
+        }
+        impl_->self_intersect_recursive( Impl::ROOT_INDEX, 0, action );
+    }
+
+    template < index_t dimension >
+    template < class EvalIntersection >
+    void WideAABBTree< dimension >::compute_other_element_bbox_intersections(
+        const WideAABBTree< dimension >& other_tree,
+        EvalIntersection& action ) const
+    {
+        if( nb_bboxes() == 0 || other_tree.nb_bboxes() == 0 )
+        {
+            return;
+        }
+        impl_->other_intersect_recursive(
+            Impl::ROOT_INDEX, 0, *other_tree.impl_, Impl::ROOT_INDEX, action );
+    }
+
+    template < index_t dimension >
+    template < class EvalIntersection >
+    void WideAABBTree< dimension >::compute_ray_element_bbox_intersections(
+        const Ray< dimension >& ray, EvalIntersection& action ) const
+    {
+        if( nb_bboxes() == 0 )
+        {
+            return;
+        }
+        impl_->object_intersect_recursive( ray, 0, action );
+    }
+
+    template < index_t dimension >
+    template < class EvalIntersection >
+    void WideAABBTree< dimension >::compute_line_element_bbox_intersections(
+        const InfiniteLine< dimension >& line, EvalIntersection& action ) const
+    {
+        if( nb_bboxes() == 0 )
+        {
+            return;
+        }
+        impl_->object_intersect_recursive( line, 0, action );
+    }
+
+    template < index_t dimension >
+    template < class EvalIntersection >
+    void WideAABBTree< dimension >::compute_segment_element_bbox_intersections(
+        const Segment< dimension >& segment, EvalIntersection& action ) const
+    {
+        if( nb_bboxes() == 0 )
+        {
+            return;
+        }
+        impl_->object_intersect_recursive( segment, 0, action );
+    }
+
+    template < index_t dimension >
+    template < class EvalIntersection >
+    void WideAABBTree< dimension >::compute_triangle_element_bbox_intersections(
+        const Triangle< dimension >& triangle, EvalIntersection& action ) const
+    {
+        if( nb_bboxes() == 0 )
+        {
+            return;
+        }
+        impl_->object_intersect_recursive( triangle, 0, action );
+    }
+} // namespace geode
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <absl/types/span.h>
+
+#include <geode/basic/pimpl.hpp>
+
+#include <geode/geometry/basic_objects/infinite_line.hpp>
+#include <geode/geometry/basic_objects/triangle.hpp>
+#include <geode/geometry/bounding_box.hpp>
+#include <geode/geometry/common.hpp>
+
+namespace geode
+{
+    /*!
+     * @brief Compact alternative to AABBTree for very large sets of boxes.
+     * Nodes have up to four children whose boxes are stored with float
+     * precision, relatively to the global bounding box, so that the
+     * children of a node are tested together. Leaves store up to four
+     * elements and element indices are kept directly in the nodes.
+     * The queries follow the AABBTree API and semantic.
+     * @warning Stored boxes are conservatively enlarged by float rounding:
+     * queries may report boxes which are closer than the float precision
+     * but not strictly intersecting.
+     */
+    template < index_t dimension >
+    class WideAABBTree
+    {
+        OPENGEODE_DISABLE_COPY( WideAABBTree );
+        OPENGEODE_TEMPLATE_ASSERT_2D_OR_3D( dimension );
+
+    public:
+        WideAABBTree();
+        explicit WideAABBTree(
+            absl::Span< const BoundingBox< dimension > > bboxes );
+        WideAABBTree( WideAABBTree&& other ) noexcept;
+        ~WideAABBTree();
+
+        WideAABBTree& operator=( WideAABBTree&& other ) noexcept;
+
+        /*!
+         * @brief Gets the number of element boxes stored in the tree.
+         */
+        [[nodiscard]] index_t nb_bboxes() const;
+
+        [[nodiscard]] const BoundingBox< dimension >& bounding_box() const;
+
+        /*!
+         * @brief Gets the size in bytes of the tree nodes.
+         */
+        [[nodiscard]] std::size_t memory_size() const;
+
+        /*!
+         * @brief Gets all the boxes containing a point
+         * @param[in] query the point to test
+         */
+        [[nodiscard]] std::vector< index_t > containing_boxes(
+            const Point< dimension >& query ) const;
+
+        /*!
+         * @brief Gets the closest element to a point
+         * @see AABBTree::closest_element_box
+         */
+        template < typename EvalDistance >
+        [[nodiscard]] std::tuple< index_t, double > closest_element_box(
+            const Point< dimension >& query, const EvalDistance& action ) const;
+
+        /*!
+         * @brief Computes the intersections between a given box and all
+         * element boxes.
+         * @see AABBTree::compute_bbox_element_bbox_intersections
+         */
+        template < class EvalIntersection >
+        void compute_bbox_element_bbox_intersections(
+            const BoundingBox< dimension >& box,
+            EvalIntersection& action ) const;
+
+        /*!
+         * @brief Computes the self intersections of the element boxes.
+         * @see AABBTree::compute_self_element_bbox_intersections
+         */
+        template < class EvalIntersection >
+        void compute_self_element_bbox_intersections(
+            EvalIntersection& action ) const;
+
+        /*!
+         * @brief Computes all the intersections of the element boxes between
+         * this tree and another one.
+         * @see AABBTree::compute_other_element_bbox_intersections
+         */
+        template < class EvalIntersection >
+        void compute_other_element_bbox_intersections(
+            const WideAABBTree< dimension >& other_tree,
+            EvalIntersection& action ) const;
+
+        /*!
+         * @brief Computes the intersections between a given ray and all
+         * element boxes.
+         * @see AABBTree::compute_ray_element_bbox_intersections
+         */
+        template < class EvalIntersection >
+        void compute_ray_element_bbox_intersections(
+            const Ray< dimension >& ray, EvalIntersection& action ) const;
+
+        /*!
+         * @brief Computes the intersections between a given infinite line and
+         * all element boxes.
+         * @see AABBTree::compute_line_element_bbox_intersections
+         */
+        template < class EvalIntersection >
+        void compute_line_element_bbox_intersections(
+            const InfiniteLine< dimension >& line,
+            EvalIntersection& action ) const;
+
+        /*!
+         * @brief Computes the intersections between a given Segment and
+         * all element boxes.
+         * @see AABBTree::compute_segment_element_bbox_intersections
+         */
+        template < class EvalIntersection >
+        void compute_segment_element_bbox_intersections(
+            const Segment< dimension >& segment,
+            EvalIntersection& action ) const;
+
+        /*!
+         * @brief Computes the intersections between a given Triangle and
+         * all element boxes.
+         * @see AABBTree::compute_triangle_element_bbox_intersections
+         */
+        template < class EvalIntersection >
+        void compute_triangle_element_bbox_intersections(
+            const Triangle< dimension >& triangle,
+            EvalIntersection& action ) const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+    ALIAS_2D_AND_3D( WideAABBTree );
+} // namespace geode
+
+#include <geode/geometry/detail/wide_aabb_impl.hpp>
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <geode/basic/bricked_array.hpp>
+
+#include <geode/image/common.hpp>
+#include <geode/image/core/raster_image.hpp>
+#include <geode/image/core/rgb_color.hpp>
+
+namespace geode
+{
+    /*!
+     * Copy the colors of a RasterImage into a BrickedArray, to be saved with
+     * save_bricked_array and read back brick by brick.
+     */
+    template < index_t dimension >
+    [[nodiscard]] BrickedArray< RGBColor, dimension > bricked_colors(
+        const RasterImage< dimension >& image )
+    {
+        std::array< index_t, dimension > cells_number;
+        for( const auto d : LRange{ dimension } )
+        {
+            cells_number[d] = image.nb_cells_in_direction( d );
+        }
+        return build_bricked_array< dimension >( cells_number, RGBColor{},
+            [&image](
+                const typename RasterImage< dimension >::CellIndices& cell ) {
+                return image.color( image.cell_index( cell ) );
+            } );
+    }
+} // namespace geode
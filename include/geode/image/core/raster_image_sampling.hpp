@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <absl/types/span.h>
+
+#include <geode/image/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( RasterImage );
+    class RGBColor;
+} // namespace geode
+
+namespace geode
+{
+    namespace detail
+    {
+        template < index_t dimension >
+        struct ImageCoordinatesType
+        {
+            using type = std::array< double, dimension >;
+        };
+    } // namespace detail
+
+    /*!
+     * Normalized coordinates in a RasterImage: each coordinate goes from 0
+     * to 1 across the image, cell centers are at (i + 0.5) / nb_cells.
+     * The same coordinates address every level of a mipmap pyramid.
+     */
+    template < index_t dimension >
+    using ImageCoordinates =
+        typename detail::ImageCoordinatesType< dimension >::type;
+
+    /*!
+     * Compute the mipmap pyramid of an image: each level halves the number
+     * of cells in each direction by averaging colors, until every direction
+     * has a single cell. The input image is level 0 and is not included in
+     * the returned vector. Cells of each level are computed in parallel.
+     */
+    template < index_t dimension >
+    [[nodiscard]] std::vector< RasterImage< dimension > >
+        build_raster_image_mipmaps( const RasterImage< dimension >& image );
+
+    /*!
+     * Color at the given coordinates using linear interpolation between the
+     * nearest cell centers (bilinear in 2D, trilinear in 3D).
+     * Coordinates outside [0, 1] are clamped to the image border.
+     */
+    template < index_t dimension >
+    [[nodiscard]] RGBColor raster_image_value(
+        const RasterImage< dimension >& image,
+        const ImageCoordinates< dimension >& coordinates );
+
+    /*!
+     * Same as raster_image_value for many coordinates, computed in parallel.
+     */
+    template < index_t dimension >
+    [[nodiscard]] std::vector< RGBColor > raster_image_values(
+        const RasterImage< dimension >& image,
+        absl::Span< const ImageCoordinates< dimension > > coordinates );
+} // namespace geode
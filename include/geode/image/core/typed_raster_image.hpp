@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <absl/types/span.h>
+
+#include <geode/basic/cell_array.hpp>
+#include <geode/basic/identifier.hpp>
+#include <geode/basic/pimpl.hpp>
+
+#include <geode/image/common.hpp>
+
+namespace geode
+{
+    /*!
+     * Image storing one value of type Pixel per cell, contiguously.
+     * Contrary to RasterImage (RGBColor per cell), the pixel type matches the
+     * data: single channel images (std::uint8_t, std::uint16_t, float,
+     * double) or multi-channel ones (std::array< float, 3 >).
+     * Values are serialized as a single contiguous block, so single channel
+     * images are loaded with one bulk read.
+     */
+    template < typename Pixel, index_t dimension >
+    class TypedRasterImage : public CellArray< dimension >, public Identifier
+    {
+        friend class bitsery::Access;
+
+    public:
+        static constexpr auto dim = dimension;
+        using PixelType = Pixel;
+        using CellIndices = typename CellArray< dimension >::CellIndices;
+
+        TypedRasterImage();
+        explicit TypedRasterImage(
+            std::array< index_t, dimension > cells_number );
+        TypedRasterImage( TypedRasterImage&& other ) noexcept;
+        TypedRasterImage& operator=( TypedRasterImage&& other ) noexcept;
+        ~TypedRasterImage();
+
+        [[nodiscard]] static std::string native_extension_static();
+
+        [[nodiscard]] std::string native_extension() const
+        {
+            return native_extension_static();
+        }
+
+        [[nodiscard]] index_t cell_index(
+            const CellIndices& index ) const override;
+
+        [[nodiscard]] CellIndices cell_indices( index_t index ) const override;
+
+        [[nodiscard]] const Pixel& value( index_t index ) const;
+
+        void set_value( index_t index, Pixel value );
+
+        /*!
+         * All the cell values, ordered by cell index.
+         */
+        [[nodiscard]] absl::Span< const Pixel > values() const;
+
+        [[nodiscard]] absl::Span< Pixel > modifiable_values();
+
+        [[nodiscard]] TypedRasterImage clone() const;
+
+    private:
+        template < typename Archive >
+        void serialize( Archive& archive );
+
+        using CellArray< dimension >::set_array_dimensions;
+        using CellArray< dimension >::copy;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+} // namespace geode
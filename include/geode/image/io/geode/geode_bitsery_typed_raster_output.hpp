@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <geode/image/core/bitsery_archive.hpp>
+#include <geode/image/core/typed_raster_image.hpp>
+#include <geode/image/io/typed_raster_image_output.hpp>
+
+namespace geode
+{
+    template < typename Pixel, index_t dimension >
+    class OpenGeodeTypedRasterImageOutput
+        : public TypedRasterImageOutput< Pixel, dimension >
+    {
+    public:
+        explicit OpenGeodeTypedRasterImageOutput( std::string_view filename )
+            : TypedRasterImageOutput< Pixel, dimension >( filename )
+        {
+        }
+
+        std::vector< std::string > write(
+            const TypedRasterImage< Pixel, dimension >& image ) const final
+        {
+            std::ofstream file{ to_string( this->filename() ),
+                std::ofstream::binary };
+            TContext context{};
+            BitseryExtensions::register_serialize_pcontext(
+                std::get< 0 >( context ) );
+            Serializer archive{ context, file };
+            archive.object( image );
+            archive.adapter().flush();
+            OPENGEODE_EXCEPTION( std::get< 1 >( context ).isValid(),
+                "[Bitsery::write] Error while writing file: ",
+                this->filename() );
+            return { to_string( this->filename() ) };
+        }
+    };
+} // namespace geode
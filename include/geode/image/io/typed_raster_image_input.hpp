@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <string_view>
+
+#include <geode/basic/factory.hpp>
+#include <geode/basic/input.hpp>
+
+#include <geode/image/common.hpp>
+
+namespace geode
+{
+    template < typename Pixel, index_t dimension >
+    class TypedRasterImage;
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * API function for loading a TypedRasterImage.
+     * The adequate loader is called depending on the filename extension.
+     * @param[in] filename Path to the file to load.
+     */
+    template < typename Pixel, index_t dimension >
+    [[nodiscard]] TypedRasterImage< Pixel, dimension > load_typed_raster_image(
+        std::string_view filename );
+
+    template < typename Pixel, index_t dimension >
+    class TypedRasterImageInput
+        : public Input< TypedRasterImage< Pixel, dimension > >
+    {
+    public:
+        using Base = Input< TypedRasterImage< Pixel, dimension > >;
+        using typename Base::InputData;
+        using typename Base::MissingFiles;
+
+    protected:
+        explicit TypedRasterImageInput( std::string_view filename )
+            : Base{ filename }
+        {
+        }
+    };
+
+    template < typename Pixel, index_t dimension >
+    [[nodiscard]] bool is_typed_raster_image_loadable(
+        std::string_view filename );
+
+    template < typename Pixel, index_t dimension >
+    using TypedRasterImageInputFactory = Factory< std::string,
+        TypedRasterImageInput< Pixel, dimension >,
+        std::string_view >;
+} // namespace geode
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include <geode/mesh/common.hpp>
 
 namespace geode
@@ -37,12 +39,27 @@ namespace geode
     class CoordinateReferenceSystemManagerBuilder
     {
     public:
+        /*!
+         * Called when the coordinates given by the active CRS may change:
+         * when the active CRS is switched or deleted, and when write access
+         * to it is given.
+         */
+        using ActivePointsHook = std::function< void() >;
+
         explicit CoordinateReferenceSystemManagerBuilder(
             CoordinateReferenceSystemManager< dimension >& crs_manager )
             : crs_manager_( crs_manager )
         {
         }
 
+        CoordinateReferenceSystemManagerBuilder(
+            CoordinateReferenceSystemManager< dimension >& crs_manager,
+            ActivePointsHook active_points_hook )
+            : crs_manager_( crs_manager ),
+              active_points_hook_( std::move( active_points_hook ) )
+        {
+        }
+
         void register_coordinate_reference_system( std::string_view name,
             std::shared_ptr< CoordinateReferenceSystem< dimension > >&& crs );
 
@@ -56,8 +73,12 @@ namespace geode
         [[nodiscard]] CoordinateReferenceSystem< dimension >&
             coordinate_reference_system( std::string_view name );
 
+    private:
+        void notify_active_points_change( std::string_view name );
+
     private:
         CoordinateReferenceSystemManager< dimension >& crs_manager_;
+        ActivePointsHook active_points_hook_;
     };
     ALIAS_1D_AND_2D_AND_3D( CoordinateReferenceSystemManagerBuilder );
 } // namespace geode
\ No newline at end of file
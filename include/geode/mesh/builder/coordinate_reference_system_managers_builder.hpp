@@ -23,12 +23,15 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/pimpl.hpp>
 
 #include <geode/mesh/common.hpp>
 
 namespace geode
 {
+    FORWARD_DECLARATION_DIMENSION_CLASS( CoordinateReferenceSystemManager );
     FORWARD_DECLARATION_DIMENSION_CLASS( CoordinateReferenceSystemManagers );
     FORWARD_DECLARATION_DIMENSION_CLASS(
         CoordinateReferenceSystemManagerBuilder );
@@ -48,6 +51,8 @@ namespace geode
         {
         }
 
+        virtual ~CoordinateReferenceSystemManagersBuilder() = default;
+
         [[nodiscard]] CoordinateReferenceSystemManagerBuilder1D
             coordinate_reference_system_manager_builder1D();
 
@@ -57,17 +62,56 @@ namespace geode
         [[nodiscard]] CoordinateReferenceSystemManagerBuilder3D
             coordinate_reference_system_manager_builder3D();
 
+        /*!
+         * Switching or deleting the active CRS of the returned builder, and
+         * getting write access to it, release data computed from the
+         * coordinates (see release_point_dependencies).
+         */
         [[nodiscard]] CoordinateReferenceSystemManagerBuilder< dimension >
             main_coordinate_reference_system_manager_builder();
 
         /*!
          * Set coordinates to a vertex. This vertex should be created before.
-         * It will be set in the active CRS.
+         * It will be set in the active CRS. Distinct vertices may be set from
+         * several threads.
          * @param[in] vertex_id The vertex, in [0, nb_vertices()-1].
          * @param[in] point The vertex coordinates
          */
         void set_point( index_t vertex, Point< dimension > point );
 
+        /*!
+         * Set coordinates to consecutive vertices in parallel. These vertices
+         * should be created before. They will be set in the active CRS.
+         * @param[in] first_vertex The vertex receiving the first point.
+         * @param[in] points The vertices coordinates
+         */
+        void set_points( index_t first_vertex,
+            absl::Span< const Point< dimension > > points );
+
+    private:
+        /*!
+         * Called after coordinates of consecutive vertices have been set,
+         * so that data computed from these coordinates can be reset.
+         * It may be called from several threads.
+         */
+        virtual void reset_point_dependencies(
+            index_t /*first_vertex*/, index_t /*nb_vertices*/ )
+        {
+        }
+
+        /*!
+         * Called when the coordinates may change without going through
+         * set_point or set_points, so that data computed from these
+         * coordinates are released.
+         */
+        virtual void release_point_dependencies() {}
+
+        template < index_t crs_dimension >
+        [[nodiscard]] CoordinateReferenceSystemManagerBuilder< crs_dimension >
+            coordinate_reference_system_manager_builder(
+                CoordinateReferenceSystemManager< crs_dimension >&
+                    crs_manager );
+
     private:
         CoordinateReferenceSystemManagers< dimension >& crs_managers_;
     };
@@ -77,6 +77,9 @@ namespace geode
 
         void do_create_tetrahedra( index_t nb ) final;
 
+        void do_create_tetrahedra( index_t first_tetrahedron,
+            absl::Span< const std::array< index_t, 4 > > tetrahedra ) final;
+
         void do_delete_polyhedra( const std::vector< bool >& to_delete,
             absl::Span< const index_t > old2new ) final;
 
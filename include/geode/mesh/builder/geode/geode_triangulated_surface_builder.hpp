@@ -74,6 +74,9 @@ namespace geode
 
         void do_create_triangles( index_t nb ) final;
 
+        void do_create_triangles( index_t first_triangle,
+            absl::Span< const std::array< index_t, 3 > > triangles ) final;
+
         void do_delete_polygons( const std::vector< bool >& to_delete,
             absl::Span< const index_t > old2new ) final;
 
@@ -64,6 +64,14 @@ namespace geode
          */
         index_t create_point( Point< dimension > point );
 
+        /*!
+         * Create new points with associated coordinates.
+         * Vertices are created at once and coordinates are set in parallel.
+         * @param[in] points The points to create
+         * @return the index of the first created point
+         */
+        index_t create_points( absl::Span< const Point< dimension > > points );
+
         void copy( const PointSet< dimension >& point_set );
 
     protected:
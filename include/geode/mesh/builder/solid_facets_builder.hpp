@@ -52,6 +52,14 @@ namespace geode
 
         index_t find_or_create_facet( PolyhedronFacetVertices facet_vertices );
 
+        /*!
+         * Find or create several facets at once, in parallel.
+         * Resulting indices are the same as calling find_or_create_facet
+         * on each facet in order.
+         */
+        void find_or_create_facets(
+            std::vector< PolyhedronFacetVertices > facets_vertices );
+
         std::vector< index_t > delete_facets(
             const std::vector< bool >& to_delete );
 
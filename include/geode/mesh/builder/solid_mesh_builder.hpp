@@ -71,6 +71,14 @@ namespace geode
          */
         index_t create_point( Point< dimension > point );
 
+        /*!
+         * Create new points with associated coordinates.
+         * Vertices are created at once and coordinates are set in parallel.
+         * @param[in] points The points to create
+         * @return the index of the first created point
+         */
+        index_t create_points( absl::Span< const Point< dimension > > points );
+
         /*!
          * Create a new polyhedron from vertices and facets.
          * @param[in] vertices The vertices defining the polyhedron to create
@@ -180,12 +188,24 @@ namespace geode
         void update_polyhedron_info(
             index_t polyhedron_id, absl::Span< const index_t > vertices );
 
+        /*!
+         * Deferred equivalent of update_polyhedron_info for a range of
+         * polyhedra whose vertices are already set.
+         */
+        void update_polyhedra_info(
+            index_t first_polyhedron, index_t nb_polyhedra );
+
         using VertexSetBuilder::delete_vertices;
 
     private:
         void update_polyhedron_adjacencies(
             absl::Span< const index_t > old2new );
 
+        void reset_point_dependencies(
+            index_t first_vertex, index_t nb_vertices ) final;
+
+        void release_point_dependencies() final;
+
         void do_delete_vertices( const std::vector< bool >& to_delete,
             absl::Span< const index_t > old2new ) final;
 
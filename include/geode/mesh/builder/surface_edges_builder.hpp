@@ -54,6 +54,14 @@ namespace geode
 
         index_t find_or_create_edge( std::array< index_t, 2 > edge_vertices );
 
+        /*!
+         * Find or create several edges at once, in parallel.
+         * Resulting indices are the same as calling find_or_create_edge
+         * on each edge in order.
+         */
+        void find_or_create_edges(
+            std::vector< std::array< index_t, 2 > > edges_vertices );
+
         std::vector< index_t > delete_edges(
             const std::vector< bool >& to_delete );
 
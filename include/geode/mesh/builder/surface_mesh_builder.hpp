@@ -72,6 +72,14 @@ namespace geode
          */
         index_t create_point( Point< dimension > point );
 
+        /*!
+         * Create new points with associated coordinates.
+         * Vertices are created at once and coordinates are set in parallel.
+         * @param[in] points The points to create
+         * @return the index of the first created point
+         */
+        index_t create_points( absl::Span< const Point< dimension > > points );
+
         /*!
          * Create a new polygon from vertices.
          * @param[in] vertices The ordered vertices defining the polygon to
@@ -80,6 +88,17 @@ namespace geode
          */
         index_t create_polygon( absl::Span< const index_t > vertices );
 
+        /*!
+         * Create new polygons from a flat list of vertices.
+         * Offsets and vertex indices are checked before the mesh is modified.
+         * @param[in] vertices The ordered vertices of all the polygons
+         * @param[in] offsets Vertices of polygon p are stored between
+         * offsets[p] and offsets[p+1]
+         * @return the index of the first created polygon
+         */
+        index_t create_polygons( absl::Span< const index_t > vertices,
+            absl::Span< const index_t > offsets );
+
         /*!
          * Modify a polygon vertex.
          * @param[in] polygon_vertex The index of the polygon vertex to modify
@@ -111,6 +130,15 @@ namespace geode
          */
         void unset_polygon_adjacent( const PolygonEdge& polygon_edge );
 
+        /*!
+         * Reverse the orientation of a set of polygons.
+         * The first vertex of each polygon is kept, the other vertices and
+         * the adjacencies are reversed. Polygons are updated in parallel,
+         * polygon edges are left unchanged.
+         * @param[in] polygons Indices of the polygons to reverse
+         */
+        void reverse_polygons( absl::Span< const index_t > polygons );
+
         /*!
          * Compute all the adjacencies between the surface polygons
          */
@@ -176,6 +204,11 @@ namespace geode
     private:
         void update_polygon_adjacencies( absl::Span< const index_t > old2new );
 
+        void reset_point_dependencies(
+            index_t first_vertex, index_t nb_vertices ) final;
+
+        void release_point_dependencies() final;
+
         void do_delete_vertices( const std::vector< bool >& to_delete,
             absl::Span< const index_t > old2new ) final;
 
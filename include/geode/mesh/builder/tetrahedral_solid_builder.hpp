@@ -63,6 +63,19 @@ namespace geode
          */
         index_t create_tetrahedra( index_t nb );
 
+        /*!
+         * Create new tetrahedra from their four vertices.
+         * Storage is resized once, connectivity is copied (in parallel for
+         * OpenGeode meshes) and vertex links, facets and edges are updated
+         * in a single pass.
+         * Adjacencies are not computed, as for create_tetrahedron.
+         * Vertex indices are checked before the mesh is modified.
+         * @param[in] tetrahedra The four vertices of each tetrahedron
+         * @return the index of the first created tetrahedron
+         */
+        index_t create_tetrahedra(
+            absl::Span< const std::array< index_t, 4 > > tetrahedra );
+
         /*!
          * Reserve storage for new tetrahedra without creating them.
          * @param[in] nb Number of tetrahedra to reserve
@@ -83,6 +96,9 @@ namespace geode
 
         virtual void do_create_tetrahedra( index_t nb ) = 0;
 
+        virtual void do_create_tetrahedra( index_t first_tetrahedron,
+            absl::Span< const std::array< index_t, 4 > > tetrahedra );
+
     private:
         TetrahedralSolid< dimension >& tetrahedral_solid_;
     };
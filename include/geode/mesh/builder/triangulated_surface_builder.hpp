@@ -68,6 +68,19 @@ namespace geode
          */
         index_t create_triangles( index_t nb );
 
+        /*!
+         * Create new triangles from their three vertices.
+         * Storage is resized once, connectivity is copied (in parallel for
+         * OpenGeode meshes) and vertex links and edges are updated in a
+         * single pass.
+         * Adjacencies are not computed, as for create_triangle.
+         * Vertex indices are checked before the mesh is modified.
+         * @param[in] triangles The three vertices of each triangle
+         * @return the index of the first created triangle
+         */
+        index_t create_triangles(
+            absl::Span< const std::array< index_t, 3 > > triangles );
+
         /*!
          * Reserve storage for new triangles without creating them.
          * @param[in] nb Number of triangles to reserve
@@ -89,6 +102,9 @@ namespace geode
 
         virtual void do_create_triangles( index_t nb ) = 0;
 
+        virtual void do_create_triangles( index_t first_triangle,
+            absl::Span< const std::array< index_t, 3 > > triangles );
+
     private:
         TriangulatedSurface< dimension >& triangulated_surface_;
     };
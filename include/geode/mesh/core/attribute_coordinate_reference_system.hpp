@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/pimpl.hpp>
 
 #include <geode/mesh/common.hpp>
@@ -67,6 +69,15 @@ namespace geode
 
         [[nodiscard]] index_t nb_points() const;
 
+        /*!
+         * Contiguous storage of all the points.
+         * @warning The returned view is invalidated when points are added or
+         * removed.
+         */
+        [[nodiscard]] absl::Span< const Point< dimension > > points() const;
+
+        [[nodiscard]] absl::Span< Point< dimension > > modifiable_points();
+
     protected:
         AttributeCoordinateReferenceSystem();
 
@@ -77,4 +88,4 @@ namespace geode
         IMPLEMENTATION_MEMBER( impl_ );
     };
     ALIAS_1D_AND_2D_AND_3D( AttributeCoordinateReferenceSystem );
-} // namespace geode
\ No newline at end of file
+} // namespace geode
\ No newline at end of file
@@ -25,6 +25,9 @@
 
 #include <absl/container/flat_hash_map.h>
 
+#include <async++.h>
+
+#include <geode/basic/algorithm.hpp>
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/common.hpp>
 #include <geode/basic/detail/mapping_after_deletion.hpp>
@@ -36,6 +39,47 @@ namespace geode
 {
     namespace detail
     {
+        /*!
+         * Gather in parallel the facets of consecutive elements, ordered by
+         * element and then by facet order within each element.
+         * @param[in] element_facets Function returning the facets of one
+         * element
+         */
+        template < typename VertexContainer, typename ElementFacets >
+        [[nodiscard]] std::vector< VertexContainer > gather_element_facets(
+            index_t nb_elements, const ElementFacets& element_facets )
+        {
+            constexpr index_t CHUNK_SIZE{ 4096 };
+            const auto nb_chunks =
+                ( nb_elements + CHUNK_SIZE - 1 ) / CHUNK_SIZE;
+            std::vector< std::vector< VertexContainer > > chunks( nb_chunks );
+            async::parallel_for( async::irange( index_t{ 0 }, nb_chunks ),
+                [&chunks, &element_facets, nb_elements]( index_t chunk ) {
+                    const auto begin = chunk * CHUNK_SIZE;
+                    const auto end =
+                        std::min( begin + CHUNK_SIZE, nb_elements );
+                    for( const auto element : Range{ begin, end } )
+                    {
+                        for( auto&& facet : element_facets( element ) )
+                        {
+                            chunks[chunk].emplace_back( std::move( facet ) );
+                        }
+                    }
+                } );
+            std::vector< index_t > offsets( nb_chunks + 1, 0 );
+            for( const auto chunk : Range{ nb_chunks } )
+            {
+                offsets[chunk + 1] = offsets[chunk] + chunks[chunk].size();
+            }
+            std::vector< VertexContainer > facets( offsets.back() );
+            async::parallel_for( async::irange( index_t{ 0 }, nb_chunks ),
+                [&chunks, &offsets, &facets]( index_t chunk ) {
+                    absl::c_move( chunks[chunk],
+                        facets.begin() + offsets[chunk] );
+                } );
+            return facets;
+        }
+
         template < typename VertexContainer >
         class FacetStorage
         {
@@ -92,6 +136,106 @@ namespace geode
                 return id;
             }
 
+            /*!
+             * Add several facets at once. Facet identifiers and counters are
+             * the same as when calling add_facet on each facet in order.
+             * Facets are sorted in parallel to find duplicates, then new
+             * facets are stored in a single pass.
+             */
+            void add_facets( std::vector< VertexContainer > facets )
+            {
+                const auto nb_facets = static_cast< index_t >( facets.size() );
+                if( nb_facets == 0 )
+                {
+                    return;
+                }
+                async::parallel_for( async::irange( index_t{ 0 }, nb_facets ),
+                    [&facets]( index_t f ) {
+                        facets[f] =
+                            TypedVertexCycle{ std::move( facets[f] ) }
+                                .vertices();
+                    } );
+                std::vector< index_t > order( nb_facets );
+                absl::c_iota( order, 0 );
+                parallel_sort( order.begin(), order.end(),
+                    [&facets]( index_t lhs, index_t rhs ) {
+                        if( facets[lhs] != facets[rhs] )
+                        {
+                            return facets[lhs] < facets[rhs];
+                        }
+                        return lhs < rhs;
+                    } );
+                std::vector< index_t > group_starts{ 0 };
+                for( const auto f : Range{ 1, nb_facets } )
+                {
+                    if( facets[order[f]] != facets[order[f - 1]] )
+                    {
+                        group_starts.push_back( f );
+                    }
+                }
+                const auto nb_groups =
+                    static_cast< index_t >( group_starts.size() );
+                group_starts.push_back( nb_facets );
+                std::vector< index_t > group_ids( nb_groups, NO_ID );
+                async::parallel_for( async::irange( index_t{ 0 }, nb_groups ),
+                    [this, &facets, &order, &group_starts, &group_ids](
+                        index_t group ) {
+                        const auto first = order[group_starts[group]];
+                        const auto it = facet_indices_.find(
+                            TypedVertexCycle{ facets[first] } );
+                        if( it != facet_indices_.end() )
+                        {
+                            group_ids[group] = it->second;
+                        }
+                    } );
+                std::vector< index_t > new_groups;
+                for( const auto group : Range{ nb_groups } )
+                {
+                    if( group_ids[group] == NO_ID )
+                    {
+                        new_groups.push_back( group );
+                    }
+                }
+                parallel_sort( new_groups.begin(), new_groups.end(),
+                    [&order, &group_starts]( index_t lhs, index_t rhs ) {
+                        return order[group_starts[lhs]]
+                               < order[group_starts[rhs]];
+                    } );
+                const auto first_new_id =
+                    static_cast< index_t >( facet_indices_.size() );
+                const auto nb_new_facets =
+                    static_cast< index_t >( new_groups.size() );
+                facet_attribute_manager_.resize( first_new_id + nb_new_facets );
+                for( const auto rank : Range{ nb_new_facets } )
+                {
+                    group_ids[new_groups[rank]] = first_new_id + rank;
+                }
+                async::parallel_for( async::irange( index_t{ 0 }, nb_groups ),
+                    [this, &facets, &order, &group_starts, &group_ids,
+                        first_new_id]( index_t group ) {
+                        const auto id = group_ids[group];
+                        const auto count =
+                            group_starts[group + 1] - group_starts[group];
+                        if( id < first_new_id )
+                        {
+                            counter_->set_value(
+                                id, counter_->value( id ) + count );
+                            return;
+                        }
+                        counter_->set_value( id, count );
+                        vertices_->set_value(
+                            id, facets[order[group_starts[group]]] );
+                    } );
+                facet_indices_.reserve( first_new_id + nb_new_facets );
+                for( const auto rank : Range{ nb_new_facets } )
+                {
+                    const auto group = new_groups[rank];
+                    facet_indices_.try_emplace(
+                        TypedVertexCycle{ facets[order[group_starts[group]]] },
+                        first_new_id + rank );
+                }
+            }
+
             void remove_facet( TypedVertexCycle vertices )
             {
                 const auto it = facet_indices_.find( vertices );
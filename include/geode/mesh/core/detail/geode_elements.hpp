@@ -81,5 +81,50 @@ namespace geode
         static constexpr std::array< std::array< geode::local_index_t, 2 >, 8 >
             PYRAMID_EDGE_VERTICES{ { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 },
                 { 0, 4 }, { 1, 4 }, { 2, 4 }, { 3, 4 } } };
+
+        /*!
+         * Flat local connectivity of a standard solid element.
+         * Vertices of facet f are stored in facet_vertices between
+         * facet_ptr[f] and facet_ptr[f + 1].
+         */
+        struct SolidElementTable
+        {
+            local_index_t nb_vertices;
+            local_index_t nb_facets;
+            std::array< local_index_t, 7 > facet_ptr;
+            std::array< local_index_t, 24 > facet_vertices;
+            local_index_t nb_edges;
+            std::array< std::array< local_index_t, 2 >, 12 > edge_vertices;
+        };
+
+        /*!
+         * Element tables indexed by HybridSolid::Type value:
+         * unknown, tetrahedron, hexahedron, prism and pyramid.
+         * Orderings match the *_FACET_VERTICES and *_EDGE_VERTICES arrays.
+         */
+        static constexpr std::array< SolidElementTable, 5 >
+            SOLID_ELEMENT_TABLES{ {
+                { 0, 0, {}, {}, 0, {} },
+                { 4, 4, { 0, 3, 6, 9, 12 },
+                    { 1, 3, 2, 0, 2, 3, 3, 1, 0, 0, 1, 2 }, 6,
+                    { { { 0, 1 }, { 0, 2 }, { 0, 3 }, { 1, 2 }, { 1, 3 },
+                        { 2, 3 } } } },
+                { 8, 6, { 0, 4, 8, 12, 16, 20, 24 },
+                    { 0, 4, 5, 1, 2, 6, 7, 3, 0, 3, 7, 4, 1, 5, 6, 2, 0, 1,
+                        2, 3, 4, 7, 6, 5 },
+                    12,
+                    { { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 }, { 4, 5 },
+                        { 5, 6 }, { 6, 7 }, { 7, 4 }, { 0, 4 }, { 1, 5 },
+                        { 2, 6 }, { 3, 7 } } } },
+                { 6, 5, { 0, 3, 6, 10, 14, 18 },
+                    { 0, 1, 2, 3, 5, 4, 0, 3, 4, 1, 1, 4, 5, 2, 0, 2, 5, 3 },
+                    9,
+                    { { { 0, 1 }, { 1, 2 }, { 2, 0 }, { 3, 4 }, { 4, 5 },
+                        { 5, 3 }, { 0, 3 }, { 1, 4 }, { 2, 5 } } } },
+                { 5, 5, { 0, 4, 7, 10, 13, 16 },
+                    { 0, 1, 2, 3, 0, 4, 1, 1, 4, 2, 2, 4, 3, 0, 3, 4 }, 8,
+                    { { { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 }, { 0, 4 },
+                        { 1, 4 }, { 2, 4 }, { 3, 4 } } } },
+            } };
     } // namespace detail
 } // namespace geode
@@ -82,6 +82,18 @@ namespace geode
             return native_extension_static();
         }
 
+        /*!
+         * Contiguous storage of the vertices of all the polygons.
+         * Vertices of polygon p are stored between polygons_vertices_offsets
+         * [p] and [p+1].
+         * @warning The returned view is invalidated when polygons are added
+         * or removed.
+         */
+        [[nodiscard]] absl::Span< const index_t > polygons_vertices() const;
+
+        [[nodiscard]] absl::Span< const index_t >
+            polygons_vertices_offsets() const;
+
     public:
         void set_vertex( index_t vertex_id,
             Point< dimension > point,
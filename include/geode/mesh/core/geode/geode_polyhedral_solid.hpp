@@ -132,6 +132,12 @@ namespace geode
         std::optional< index_t > get_polyhedron_adjacent(
             const PolyhedronFacet& polyhedron_facet ) const override;
 
+        PolyhedronEdgesVertices polyhedron_edges_vertices(
+            index_t polyhedron ) const final;
+
+        PolyhedronFacetsVertices polyhedron_facets_vertices(
+            index_t polyhedron ) const final;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
@@ -84,6 +84,14 @@ namespace geode
             return native_extension_static();
         }
 
+        /*!
+         * Contiguous storage of the four vertices of each tetrahedron.
+         * @warning The returned view is invalidated when tetrahedra are added
+         * or removed.
+         */
+        [[nodiscard]] absl::Span< const std::array< index_t, 4 > >
+            tetrahedra_vertices() const;
+
     public:
         void set_vertex( index_t vertex_id,
             Point< dimension > point,
@@ -100,6 +108,10 @@ namespace geode
         void add_tetrahedron(
             const std::array< index_t, 4 >& vertices, OGTetrahedralSolidKey );
 
+        void add_tetrahedra( index_t first_tetrahedron,
+            absl::Span< const std::array< index_t, 4 > > tetrahedra,
+            OGTetrahedralSolidKey );
+
     private:
         friend class bitsery::Access;
         template < typename Archive >
@@ -85,6 +85,14 @@ namespace geode
             return native_extension_static();
         }
 
+        /*!
+         * Contiguous storage of the three vertices of each triangle.
+         * @warning The returned view is invalidated when triangles are added
+         * or removed.
+         */
+        [[nodiscard]] absl::Span< const std::array< index_t, 3 > >
+            triangles_vertices() const;
+
     public:
         void set_vertex( index_t vertex_id,
             Point< dimension > point,
@@ -101,6 +109,10 @@ namespace geode
         void add_triangle( const std::array< index_t, 3 >& vertices,
             OGTriangulatedSurfaceKey );
 
+        void add_triangles( index_t first_triangle,
+            absl::Span< const std::array< index_t, 3 > > triangles,
+            OGTriangulatedSurfaceKey );
+
     private:
         friend class bitsery::Access;
         template < typename Archive >
@@ -58,6 +58,12 @@ namespace geode
                     EdgesVertexCycle{ std::move( edge_vertices ) } );
             }
 
+            void find_or_create_edges(
+                std::vector< std::array< index_t, 2 > > edges_vertices )
+            {
+                this->add_facets( std::move( edges_vertices ) );
+            }
+
             [[nodiscard]] const std::array< index_t, 2 >& edge_vertices(
                 const index_t edge_id ) const
             {
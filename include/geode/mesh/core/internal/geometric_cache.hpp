@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <async++.h>
+
+#include <geode/basic/range.hpp>
+
+namespace geode
+{
+    namespace internal
+    {
+        /*!
+         * Geometric values of mesh elements, owned by the mesh implementation
+         * and never serialized. Each value is stored with the element
+         * vertices used to compute it, values of modified elements are not
+         * returned. Values are only written when the cache is enabled, the
+         * queries do not modify it and can be called concurrently.
+         * A generation is stored for each vertex when its point is set: a
+         * value is outdated when one of its vertices is more recent.
+         */
+        template < typename Geometry, typename Vertices >
+        class GeometricCache
+        {
+        public:
+            [[nodiscard]] bool is_enabled() const
+            {
+                return enabled_;
+            }
+
+            /*!
+             * Compute in parallel the values that are missing or outdated.
+             * @param[in] element_vertices Return the vertices of an element
+             * @param[in] compute_geometry Return the geometry of an element
+             */
+            template < typename ElementVertices, typename ComputeGeometry >
+            void enable( index_t nb_elements,
+                index_t nb_vertices,
+                const ElementVertices& element_vertices,
+                const ComputeGeometry& compute_geometry )
+            {
+                enabled_ = true;
+                entries_.resize( nb_elements );
+                resize_vertex_generations( nb_vertices );
+                const auto generation = generation_.load();
+                async::parallel_for( async::irange( index_t{ 0 }, nb_elements ),
+                    [&]( const index_t element_id ) {
+                        auto vertices = element_vertices( element_id );
+                        if( geometry( element_id, vertices ) )
+                        {
+                            return;
+                        }
+                        auto& entry = entries_[element_id];
+                        entry.geometry = compute_geometry( element_id );
+                        entry.vertices = std::move( vertices );
+                        entry.generation = generation;
+                    } );
+            }
+
+            void disable()
+            {
+                enabled_ = false;
+                entries_.clear();
+                entries_.shrink_to_fit();
+                vertex_generations_.clear();
+                vertex_generations_.shrink_to_fit();
+            }
+
+            void reset_element( index_t element_id )
+            {
+                if( element_id < entries_.size() )
+                {
+                    entries_[element_id].generation = NO_GENERATION;
+                }
+            }
+
+            /*!
+             * Outdate the values of the elements around the given vertices.
+             * Can be called concurrently.
+             */
+            void reset_vertices( index_t first_vertex, index_t nb_vertices )
+            {
+                const auto nb_stored_vertices =
+                    static_cast< index_t >( vertex_generations_.size() );
+                if( first_vertex >= nb_stored_vertices )
+                {
+                    return;
+                }
+                const auto generation = ++generation_;
+                for( const auto vertex_id : Range{ first_vertex,
+                         std::min( first_vertex + nb_vertices,
+                             nb_stored_vertices ) } )
+                {
+                    vertex_generations_[vertex_id] = generation;
+                }
+            }
+
+            /*!
+             * Outdate all the values
+             */
+            void reset()
+            {
+                reset_generation_ = ++generation_;
+            }
+
+            /*!
+             * Return nullptr if the cache is disabled or outdated for the
+             * element
+             * @param[in] vertices Current vertices of the element
+             */
+            [[nodiscard]] const Geometry* geometry(
+                index_t element_id, const Vertices& vertices ) const
+            {
+                if( element_id >= entries_.size() )
+                {
+                    return nullptr;
+                }
+                const auto& entry = entries_[element_id];
+                if( entry.generation == NO_GENERATION
+                    || entry.generation < reset_generation_
+                    || entry.vertices != vertices )
+                {
+                    return nullptr;
+                }
+                for( const auto vertex_id : vertices )
+                {
+                    if( vertex_id >= vertex_generations_.size()
+                        || vertex_generations_[vertex_id] > entry.generation )
+                    {
+                        return nullptr;
+                    }
+                }
+                return &entry.geometry;
+            }
+
+        private:
+            using Generation = std::uint64_t;
+            static constexpr auto NO_GENERATION =
+                std::numeric_limits< Generation >::max();
+
+            struct Entry
+            {
+                Geometry geometry;
+                Vertices vertices;
+                Generation generation{ NO_GENERATION };
+            };
+
+            void resize_vertex_generations( index_t nb_vertices )
+            {
+                if( nb_vertices == vertex_generations_.size() )
+                {
+                    return;
+                }
+                std::vector< std::atomic< Generation > > vertex_generations(
+                    nb_vertices );
+                for( const auto vertex_id : Range{ nb_vertices } )
+                {
+                    vertex_generations[vertex_id] =
+                        vertex_id < vertex_generations_.size()
+                            ? vertex_generations_[vertex_id].load()
+                            : 0;
+                }
+                vertex_generations_ = std::move( vertex_generations );
+            }
+
+        private:
+            bool enabled_{ false };
+            std::vector< Entry > entries_;
+            std::vector< std::atomic< Generation > > vertex_generations_;
+            std::atomic< Generation > generation_{ 0 };
+            std::atomic< Generation > reset_generation_{ 0 };
+        };
+    } // namespace internal
+} // namespace geode
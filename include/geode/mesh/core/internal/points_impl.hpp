@@ -65,6 +65,16 @@ namespace geode
                 return points_->size();
             }
 
+            [[nodiscard]] absl::Span< const Point< dimension > > points() const
+            {
+                return points_->values();
+            }
+
+            [[nodiscard]] absl::Span< Point< dimension > > modifiable_points()
+            {
+                return points_->modifiable_values();
+            }
+
             [[nodiscard]] std::string_view attribute_name() const
             {
                 return points_->name();
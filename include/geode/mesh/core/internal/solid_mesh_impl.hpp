@@ -23,8 +23,12 @@
 
 #pragma once
 
+#include <absl/container/inlined_vector.h>
+
 #include <geode/basic/bitsery_archive.hpp>
 
+#include <geode/geometry/vector.hpp>
+
 #include <geode/mesh/core/solid_mesh.hpp>
 
 namespace geode
@@ -67,5 +71,18 @@ namespace geode
             PolyhedraAroundVertex polyhedra;
             bool vertex_is_on_border{ true };
         };
+
+        template < index_t dimension >
+        struct PolyhedronGeometryImpl
+        {
+            Point< dimension > barycenter;
+            double volume{ 0 };
+            /*!
+             * Null vector when the facet normal is undefined
+             */
+            absl::InlinedVector< Vector3D, 6 > facet_normals;
+            Point< dimension > bounding_box_min;
+            Point< dimension > bounding_box_max;
+        };
     } // namespace internal
 } // namespace geode
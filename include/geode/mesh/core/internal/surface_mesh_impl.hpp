@@ -25,6 +25,8 @@
 
 #include <geode/basic/bitsery_archive.hpp>
 
+#include <geode/geometry/vector.hpp>
+
 #include <geode/mesh/core/surface_mesh.hpp>
 
 namespace geode
@@ -67,5 +69,18 @@ namespace geode
             PolygonsAroundVertex polygons;
             bool vertex_is_on_border{ true };
         };
+
+        template < index_t dimension >
+        struct PolygonGeometryImpl
+        {
+            Point< dimension > barycenter;
+            double area{ 0 };
+            /*!
+             * Null vector when the normal is undefined and for 2D polygons
+             */
+            Vector3D normal;
+            Point< dimension > bounding_box_min;
+            Point< dimension > bounding_box_max;
+        };
     } // namespace internal
 } // namespace geode
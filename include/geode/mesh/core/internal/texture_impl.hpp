@@ -23,6 +23,10 @@
 
 #pragma once
 
+#include <cmath>
+
+#include <async++.h>
+
 #include <geode/mesh/core/texture2d.hpp>
 
 #include <geode/basic/attribute_manager.hpp>
@@ -31,6 +35,8 @@
 #include <geode/geometry/point.hpp>
 
 #include <geode/image/core/raster_image.hpp>
+#include <geode/image/core/raster_image_sampling.hpp>
+#include <geode/image/core/rgb_color.hpp>
 
 namespace geode
 {
@@ -54,6 +60,66 @@ namespace geode
             void set_image( RasterImage< dimension >&& image )
             {
                 image_ = std::move( image );
+                mipmaps_.clear();
+            }
+
+            void build_mipmaps()
+            {
+                mipmaps_ = build_raster_image_mipmaps( image_ );
+            }
+
+            [[nodiscard]] index_t nb_mipmap_levels() const
+            {
+                return static_cast< index_t >( mipmaps_.size() ) + 1;
+            }
+
+            [[nodiscard]] const RasterImage< dimension >& mipmap(
+                index_t level ) const
+            {
+                OPENGEODE_EXCEPTION( level < nb_mipmap_levels(),
+                    "[Texture::mipmap] Level ", level, " does not exist" );
+                if( level == 0 )
+                {
+                    return image_;
+                }
+                return mipmaps_[level - 1];
+            }
+
+            [[nodiscard]] RGBColor texture_value(
+                const Point< dimension >& coordinates, double level ) const
+            {
+                check_level( level );
+                ImageCoordinates< dimension > image_coordinates;
+                for( const auto d : LRange{ dimension } )
+                {
+                    image_coordinates[d] = coordinates.value( d );
+                }
+                const auto lower_level = static_cast< index_t >( level );
+                const auto lower_color = raster_image_value< dimension >(
+                    mipmap( lower_level ), image_coordinates );
+                const auto upper_weight = level - lower_level;
+                if( upper_weight == 0 )
+                {
+                    return lower_color;
+                }
+                const auto upper_color = raster_image_value< dimension >(
+                    mipmap( lower_level + 1 ), image_coordinates );
+                return blend( lower_color, upper_color, upper_weight );
+            }
+
+            [[nodiscard]] std::vector< RGBColor > texture_values(
+                absl::Span< const Point< dimension > > coordinates,
+                double level ) const
+            {
+                check_level( level );
+                std::vector< RGBColor > values( coordinates.size() );
+                async::parallel_for(
+                    async::irange( size_t{ 0 }, coordinates.size() ),
+                    [this, &coordinates, &values, level]( size_t point ) {
+                        values[point] =
+                            texture_value( coordinates[point], level );
+                    } );
+                return values;
             }
 
         protected:
@@ -95,6 +161,29 @@ namespace geode
             TextureImpl() = default;
 
         private:
+            void check_level( double level ) const
+            {
+                OPENGEODE_EXCEPTION(
+                    level >= 0 && level <= nb_mipmap_levels() - 1,
+                    "[Texture::texture_value] Level ", level,
+                    " is outside the mipmap pyramid" );
+            }
+
+            static RGBColor blend( const RGBColor& lower,
+                const RGBColor& upper,
+                double upper_weight )
+            {
+                const auto channel = [upper_weight]( local_index_t lower_value,
+                                         local_index_t upper_value ) {
+                    return static_cast< local_index_t >( std::round(
+                        ( 1 - upper_weight ) * lower_value
+                        + upper_weight * upper_value ) );
+                };
+                return { channel( lower.red(), upper.red() ),
+                    channel( lower.green(), upper.green() ),
+                    channel( lower.blue(), upper.blue() ) };
+            }
+
             template < typename Archive >
             void serialize( Archive& archive )
             {
@@ -108,6 +197,7 @@ namespace geode
 
         private:
             RasterImage< dimension > image_;
+            std::vector< RasterImage< dimension > > mipmaps_;
             std::shared_ptr< VariableAttribute< ElementTextureCoordinates > >
                 coordinates_;
         };
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <geode/basic/range.hpp>
+
+#include <geode/mesh/common.hpp>
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+
+namespace geode
+{
+    /*!
+     * Iterate over the vertices of a polygon without building a container.
+     * Example:
+     *    for( const auto vertex_id : PolygonVerticesRange{ mesh, polygon } )
+     *    {
+     *      // do something
+     *    }
+     */
+    template < index_t dimension >
+    class PolygonVerticesRange : public BaseRange< local_index_t >
+    {
+    public:
+        PolygonVerticesRange(
+            const SurfaceMesh< dimension >& mesh, index_t polygon_id )
+            : BaseRange< local_index_t >(
+                  0, mesh.nb_polygon_vertices( polygon_id ) ),
+              mesh_( mesh ),
+              polygon_id_( polygon_id )
+        {
+        }
+
+        [[nodiscard]] const PolygonVerticesRange& begin() const
+        {
+            return *this;
+        }
+
+        [[nodiscard]] const PolygonVerticesRange& end() const
+        {
+            return *this;
+        }
+
+        [[nodiscard]] index_t operator*() const
+        {
+            return mesh_.polygon_vertex( { polygon_id_, this->current() } );
+        }
+
+    private:
+        const SurfaceMesh< dimension >& mesh_;
+        index_t polygon_id_;
+    };
+
+    /*!
+     * Iterate over the vertices of a polyhedron without building a
+     * container.
+     * Example:
+     *    for( const auto vertex_id :
+     *        PolyhedronVerticesRange{ mesh, polyhedron } )
+     *    {
+     *      // do something
+     *    }
+     */
+    template < index_t dimension >
+    class PolyhedronVerticesRange : public BaseRange< local_index_t >
+    {
+    public:
+        PolyhedronVerticesRange(
+            const SolidMesh< dimension >& mesh, index_t polyhedron_id )
+            : BaseRange< local_index_t >(
+                  0, mesh.nb_polyhedron_vertices( polyhedron_id ) ),
+              mesh_( mesh ),
+              polyhedron_id_( polyhedron_id )
+        {
+        }
+
+        [[nodiscard]] const PolyhedronVerticesRange& begin() const
+        {
+            return *this;
+        }
+
+        [[nodiscard]] const PolyhedronVerticesRange& end() const
+        {
+            return *this;
+        }
+
+        [[nodiscard]] index_t operator*() const
+        {
+            return mesh_.polyhedron_vertex(
+                { polyhedron_id_, this->current() } );
+        }
+
+    private:
+        const SolidMesh< dimension >& mesh_;
+        index_t polyhedron_id_;
+    };
+
+    /*!
+     * Iterate over the vertices of a polyhedron facet without building a
+     * container.
+     * Example:
+     *    for( const auto vertex_id :
+     *        PolyhedronFacetVerticesRange{ mesh, polyhedron_facet } )
+     *    {
+     *      // do something
+     *    }
+     */
+    template < index_t dimension >
+    class PolyhedronFacetVerticesRange : public BaseRange< local_index_t >
+    {
+    public:
+        PolyhedronFacetVerticesRange( const SolidMesh< dimension >& mesh,
+            const PolyhedronFacet& polyhedron_facet )
+            : BaseRange< local_index_t >(
+                  0, mesh.nb_polyhedron_facet_vertices( polyhedron_facet ) ),
+              mesh_( mesh ),
+              polyhedron_facet_( polyhedron_facet )
+        {
+        }
+
+        [[nodiscard]] const PolyhedronFacetVerticesRange& begin() const
+        {
+            return *this;
+        }
+
+        [[nodiscard]] const PolyhedronFacetVerticesRange& end() const
+        {
+            return *this;
+        }
+
+        [[nodiscard]] index_t operator*() const
+        {
+            return mesh_.polyhedron_facet_vertex(
+                { polyhedron_facet_, this->current() } );
+        }
+
+    private:
+        const SolidMesh< dimension >& mesh_;
+        PolyhedronFacet polyhedron_facet_;
+    };
+} // namespace geode
@@ -104,6 +104,10 @@ namespace geode
             return find_or_create_edge( std::move( edge_vertices ) );
         }
 
+        void find_or_create_edges(
+            std::vector< std::array< index_t, 2 > > edges_vertices,
+            SolidEdgesKey );
+
         void overwrite_edges(
             const SolidEdges< dimension >& from, SolidEdgesKey );
 
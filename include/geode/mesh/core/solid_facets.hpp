@@ -98,6 +98,10 @@ namespace geode
             return find_or_create_facet( std::move( facet_vertices ) );
         }
 
+        void find_or_create_facets(
+            std::vector< PolyhedronFacetVertices > facets_vertices,
+            SolidFacetsKey );
+
         void overwrite_facets(
             const SolidFacets< dimension >& from, SolidFacetsKey );
 
@@ -435,6 +435,13 @@ namespace geode
          */
         [[nodiscard]] double polyhedron_volume( index_t polyhedron_id ) const;
 
+        /*!
+         * Return the bounding box of a polyhedron
+         * @param[in] polyhedron_id Index of a polyhedron
+         */
+        [[nodiscard]] BoundingBox< dimension > polyhedron_bounding_box(
+            index_t polyhedron_id ) const;
+
         /*!
          * Return the area of a given PolyhedronFacet.
          * @param[in] polyhedron_facet Local index of facet in polyhedron.
@@ -573,6 +580,24 @@ namespace geode
 
         [[nodiscard]] const SolidFacets< dimension >& facets() const;
 
+        [[nodiscard]] bool is_geometric_cache_enabled() const;
+
+        /*!
+         * Store polyhedron barycenters, volumes, facet normals and bounding
+         * boxes in the mesh, outside of its attributes, computed in parallel.
+         * Polyhedron geometric queries then return the stored values, they do
+         * not modify the cache. Builders outdate the polyhedra whose vertices
+         * are modified, and the polyhedra around the vertices whose points
+         * are set: queries compute outdated values directly until this
+         * function is called again, which only computes the outdated values.
+         * The cache is disabled when the active CRS is switched or deleted,
+         * or when write access to it is given (e.g. NumPy views of points).
+         * The cache is not serialized.
+         */
+        void enable_geometric_cache() const;
+
+        void disable_geometric_cache() const;
+
         /*!
          * Access to the manager of attributes associated with polyhedra.
          */
@@ -600,6 +625,13 @@ namespace geode
 
         void reset_polyhedra_around_vertex( index_t vertex_id, SolidMeshKey );
 
+        void reset_polyhedron_geometry( index_t polyhedron_id, SolidMeshKey );
+
+        void reset_vertices_geometry(
+            index_t first_vertex, index_t nb_vertices, SolidMeshKey );
+
+        void reset_geometric_cache( SolidMeshKey );
+
         [[nodiscard]] SolidEdges< dimension >& edges( SolidMeshKey );
 
         void copy_edges( const SolidMesh< dimension >& solid, SolidMeshKey );
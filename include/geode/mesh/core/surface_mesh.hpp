@@ -350,6 +350,13 @@ namespace geode
          */
         [[nodiscard]] double polygon_area( index_t polygon_id ) const;
 
+        /*!
+         * Return the bounding box of a polygon
+         * @param[in] polygon_id Index of a polygon
+         */
+        [[nodiscard]] BoundingBox< dimension > polygon_bounding_box(
+            index_t polygon_id ) const;
+
         /*!
          * Return the normal of a polygon
          */
@@ -423,6 +430,25 @@ namespace geode
 
         [[nodiscard]] const SurfaceEdges< dimension >& edges() const;
 
+        [[nodiscard]] bool is_geometric_cache_enabled() const;
+
+        /*!
+         * Store polygon barycenters, areas, normals and bounding boxes in the
+         * mesh, outside of its attributes, computed in parallel. Polygon
+         * geometric queries then return the stored values, they do not
+         * modify the cache.
+         * Builders outdate the polygons whose vertices are modified, and the
+         * polygons around the vertices whose points are set: queries compute
+         * outdated values directly until this function is called again,
+         * which only computes the outdated values.
+         * The cache is disabled when the active CRS is switched or deleted,
+         * or when write access to it is given (e.g. NumPy views of points).
+         * The cache is not serialized.
+         */
+        void enable_geometric_cache() const;
+
+        void disable_geometric_cache() const;
+
         /*!
          * Access to the manager of attributes associated with polygons.
          */
@@ -450,6 +476,13 @@ namespace geode
 
         void reset_polygons_around_vertex( index_t vertex_id, SurfaceMeshKey );
 
+        void reset_polygon_geometry( index_t polygon_id, SurfaceMeshKey );
+
+        void reset_vertices_geometry(
+            index_t first_vertex, index_t nb_vertices, SurfaceMeshKey );
+
+        void reset_geometric_cache( SurfaceMeshKey );
+
         [[nodiscard]] SurfaceEdges< dimension >& edges( SurfaceMeshKey );
 
         void copy_edges(
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/basic/pimpl.hpp>
 
 #include <geode/mesh/common.hpp>
@@ -36,6 +38,7 @@ namespace geode
     ALIAS_1D( Point );
     ALIAS_1D( RasterImage );
     class AttributeManager;
+    class RGBColor;
 } // namespace geode
 
 namespace geode
@@ -55,6 +58,35 @@ namespace geode
 
         void set_image( RasterImage1D&& image );
 
+        /*!
+         * Compute the mipmap pyramid of the current image, cells of each
+         * level are computed in parallel. The pyramid is dropped when the
+         * image is set again and is not serialized.
+         */
+        void build_mipmaps();
+
+        /*!
+         * Number of pyramid levels, level 0 being the image itself.
+         */
+        [[nodiscard]] index_t nb_mipmap_levels() const;
+
+        [[nodiscard]] const RasterImage1D& mipmap( index_t level ) const;
+
+        /*!
+         * Color at the given texture coordinates, normalized between 0 and 1
+         * across the image. Colors are linearly interpolated between cells,
+         * and between the two nearest pyramid levels when \param level is
+         * fractional.
+         */
+        [[nodiscard]] RGBColor texture_value(
+            const Point1D& coordinates, double level ) const;
+
+        /*!
+         * Same as texture_value for many coordinates, computed in parallel.
+         */
+        [[nodiscard]] std::vector< RGBColor > texture_values(
+            absl::Span< const Point1D > coordinates, double level ) const;
+
         [[nodiscard]] const Point1D& texture_coordinates(
             const EdgeVertex& vertex ) const;
 
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <geode/basic/attribute.hpp>
+#include <geode/basic/bricked_array.hpp>
+
+#include <geode/mesh/common.hpp>
+#include <geode/mesh/core/grid.hpp>
+
+namespace geode
+{
+    /*!
+     * Copy a grid cell attribute into a BrickedArray, to be saved with
+     * save_bricked_array and read back brick by brick.
+     * @param[in] default_value Value stored in the brick cells outside the
+     * grid.
+     */
+    template < typename T, index_t dimension >
+    [[nodiscard]] BrickedArray< T, dimension > bricked_cell_attribute(
+        const Grid< dimension >& grid,
+        const ReadOnlyAttribute< T >& attribute,
+        T default_value )
+    {
+        std::array< index_t, dimension > cells_number;
+        for( const auto d : LRange{ dimension } )
+        {
+            cells_number[d] = grid.nb_cells_in_direction( d );
+        }
+        return build_bricked_array< dimension >( cells_number,
+            std::move( default_value ),
+            [&grid, &attribute](
+                const typename Grid< dimension >::CellIndices& cell ) {
+                return attribute.value( grid.cell_index( cell ) );
+            } );
+    }
+
+    /*!
+     * Copy a grid vertex attribute into a BrickedArray, one array cell per
+     * grid vertex.
+     * @param[in] default_value Value stored in the brick cells outside the
+     * grid.
+     */
+    template < typename T, index_t dimension >
+    [[nodiscard]] BrickedArray< T, dimension > bricked_vertex_attribute(
+        const Grid< dimension >& grid,
+        const ReadOnlyAttribute< T >& attribute,
+        T default_value )
+    {
+        std::array< index_t, dimension > vertices_number;
+        for( const auto d : LRange{ dimension } )
+        {
+            vertices_number[d] = grid.nb_vertices_in_direction( d );
+        }
+        return build_bricked_array< dimension >( vertices_number,
+            std::move( default_value ),
+            [&grid, &attribute](
+                const typename Grid< dimension >::VertexIndices& vertex ) {
+                return attribute.value( grid.vertex_index( vertex ) );
+            } );
+    }
+} // namespace geode
@@ -34,5 +34,28 @@ namespace geode
         bool polygons_intersection_detection( const Mesh& mesh,
             const PolygonVertices& polygon,
             const PolygonVertices& other_polygon );
+
+        /*!
+         * Detect the intersection between two polygons belonging to two
+         * different meshes, i.e. polygons without any shared vertex.
+         * Touching polygons are considered as intersecting.
+         */
+        template < typename Mesh >
+        bool polygons_intersection_detection( const Mesh& mesh,
+            const PolygonVertices& polygon,
+            const Mesh& other_mesh,
+            const PolygonVertices& other_polygon );
+
+        /*!
+         * Detect the intersection between two polygons belonging to two
+         * conformal meshes: colocated vertices are considered as shared.
+         * Polygons touching only on these vertices or on the edge between
+         * them are not considered as intersecting.
+         */
+        template < typename Mesh >
+        bool conformal_polygons_intersection_detection( const Mesh& mesh,
+            const PolygonVertices& polygon,
+            const Mesh& other_mesh,
+            const PolygonVertices& other_polygon );
     } // namespace detail
 } // namespace geode
\ No newline at end of file
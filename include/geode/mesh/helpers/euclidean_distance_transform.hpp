@@ -29,6 +29,7 @@
 
 #include <geode/mesh/common.hpp>
 #include <geode/mesh/core/grid.hpp>
+#include <geode/mesh/helpers/rasterize.hpp>
 
 namespace geode
 {
@@ -58,4 +59,14 @@ namespace geode
             absl::Span< const typename Grid< dimension >::CellIndices >
                 grid_cell_ids,
             std::string_view distance_map_name );
+
+    /*!
+     * Same as above with objects rasterized as runs of cells, as given by
+     * rasterize_closed_surface_runs. Runs are never expanded to cells.
+     */
+    template < index_t dimension >
+    [[nodiscard]] std::shared_ptr< VariableAttribute< double > >
+        euclidean_distance_transform( const Grid< dimension >& grid,
+            absl::Span< const GridCellRun< dimension > > grid_cell_runs,
+            std::string_view distance_map_name );
 } // namespace geode
\ No newline at end of file
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/mesh/common.hpp>
 
 namespace geode
@@ -44,6 +46,24 @@ namespace geode
         compute_solid_scalar_function_gradient(
             const SolidMesh3D& mesh, std::string_view scalar_function_name );
 
+    /*!
+     * Compute the gradients of several scalar functions in a single pass
+     * over the mesh vertices.
+     * Vertex neighbourhoods and distance weights are shared between the
+     * functions, and vertices are processed in parallel.
+     * @return Names of the created gradient attributes, in the order of the
+     * given scalar functions.
+     */
+    template < index_t dimension >
+    [[nodiscard]] std::vector< std::string >
+        compute_surface_scalar_functions_gradients(
+            const SurfaceMesh< dimension >& mesh,
+            absl::Span< const std::string_view > scalar_function_names );
+
+    [[nodiscard]] std::vector< std::string > opengeode_mesh_api
+        compute_solid_scalar_functions_gradients( const SolidMesh3D& mesh,
+            absl::Span< const std::string_view > scalar_function_names );
+
     namespace internal
     {
         template < index_t dimension >
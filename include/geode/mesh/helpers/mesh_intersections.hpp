@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <geode/mesh/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( SurfaceMesh );
+    FORWARD_DECLARATION_DIMENSION_CLASS( TetrahedralSolid );
+    ALIAS_3D( TetrahedralSolid );
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Pair of intersecting mesh elements.
+     * For a self-intersection, the first index is the smallest one.
+     * For an intersection between two meshes, the first index refers to
+     * the first given mesh and the second index to the other one.
+     */
+    using ElementsIntersection = std::array< index_t, 2 >;
+
+    /*!
+     * Find all the pairs of intersecting polygons within a surface.
+     * Polygons sharing vertices are only reported if they intersect
+     * elsewhere than on their common vertices/edge.
+     * Candidate pairs are found by an AABBTree traversal run in parallel.
+     * @return Sorted list of intersecting polygon pairs.
+     */
+    template < index_t dimension >
+    [[nodiscard]] std::vector< ElementsIntersection >
+        surface_self_intersections( const SurfaceMesh< dimension >& mesh );
+
+    /*!
+     * Find all the pairs of intersecting polygons between two surfaces.
+     * The surfaces are considered as independent: touching polygons are
+     * reported as intersecting, including polygons sharing colocated
+     * vertices. Use conformal_surfaces_intersections for surfaces sharing
+     * boundaries, e.g. BRep surfaces.
+     * @return Sorted list of (polygon in mesh, polygon in other_mesh) pairs.
+     */
+    template < index_t dimension >
+    [[nodiscard]] std::vector< ElementsIntersection > surfaces_intersections(
+        const SurfaceMesh< dimension >& mesh,
+        const SurfaceMesh< dimension >& other_mesh );
+
+    /*!
+     * Find all the pairs of intersecting polygons between two surfaces.
+     * The surfaces are considered as conformal: colocated vertices are
+     * considered as shared, polygons touching only on these vertices or on
+     * the edge between them are not reported.
+     * @return Sorted list of (polygon in mesh, polygon in other_mesh) pairs.
+     */
+    template < index_t dimension >
+    [[nodiscard]] std::vector< ElementsIntersection >
+        conformal_surfaces_intersections( const SurfaceMesh< dimension >& mesh,
+            const SurfaceMesh< dimension >& other_mesh );
+
+    /*!
+     * Find all the pairs of intersecting tetrahedra within a solid.
+     * Tetrahedra sharing vertices are only reported if they intersect
+     * elsewhere than on their common vertices/edge/facet.
+     * @return Sorted list of intersecting tetrahedron pairs.
+     */
+    [[nodiscard]] std::vector< ElementsIntersection > opengeode_mesh_api
+        tetrahedral_solid_self_intersections( const TetrahedralSolid3D& mesh );
+
+    /*!
+     * Find all the pairs of intersecting tetrahedra between two solids.
+     * The solids are considered as independent: touching tetrahedra are
+     * reported as intersecting, including tetrahedra sharing colocated
+     * vertices. Use conformal_tetrahedral_solids_intersections for solids
+     * sharing boundaries.
+     * @return Sorted list of (tetrahedron in mesh, tetrahedron in
+     * other_mesh) pairs.
+     */
+    [[nodiscard]] std::vector< ElementsIntersection > opengeode_mesh_api
+        tetrahedral_solids_intersections( const TetrahedralSolid3D& mesh,
+            const TetrahedralSolid3D& other_mesh );
+
+    /*!
+     * Find all the pairs of intersecting tetrahedra between two solids.
+     * The solids are considered as conformal: colocated vertices are
+     * considered as shared, tetrahedra touching only on these
+     * vertices/edge/facet are not reported.
+     * @return Sorted list of (tetrahedron in mesh, tetrahedron in
+     * other_mesh) pairs.
+     */
+    [[nodiscard]] std::vector< ElementsIntersection > opengeode_mesh_api
+        conformal_tetrahedral_solids_intersections(
+            const TetrahedralSolid3D& mesh,
+            const TetrahedralSolid3D& other_mesh );
+} // namespace geode
@@ -23,6 +23,10 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
+#include <geode/basic/attribute.hpp>
+
 #include <geode/mesh/common.hpp>
 #include <geode/mesh/core/grid.hpp>
 
@@ -32,13 +36,44 @@ namespace geode
     FORWARD_DECLARATION_DIMENSION_CLASS( Segment );
     FORWARD_DECLARATION_DIMENSION_CLASS( Triangle );
     FORWARD_DECLARATION_DIMENSION_CLASS( TriangulatedSurface );
+    FORWARD_DECLARATION_DIMENSION_CLASS( TetrahedralSolid );
     ALIAS_3D( Grid );
     ALIAS_3D( TriangulatedSurface );
+    ALIAS_3D( TetrahedralSolid );
     class Tetrahedron;
 } // namespace geode
 
 namespace geode
 {
+    enum struct RASTERIZATION_VALUE
+    {
+        // Smallest id of the elements painting the cell, NO_ID if none
+        element_id,
+        // Number of elements painting the cell
+        nb_elements
+    };
+
+    /*!
+     * Run of consecutive grid cells along the first grid direction:
+     * cells first_cell, first_cell + (1, 0, ...), ... up to nb_cells cells.
+     * Cells of a run have consecutive cell indices in the grid.
+     */
+    template < index_t dimension >
+    struct GridCellRun
+    {
+        typename Grid< dimension >::CellIndices first_cell;
+        index_t nb_cells;
+    };
+    ALIAS_2D_AND_3D( GridCellRun );
+
+    /*!
+     * Merge the given cells into runs along the first grid direction.
+     * Duplicated cells are ignored.
+     */
+    template < index_t dimension >
+    [[nodiscard]] std::vector< GridCellRun< dimension > > grid_cell_runs(
+        absl::Span< const typename Grid< dimension >::CellIndices > cells );
+
     template < index_t dimension >
     [[nodiscard]] std::vector< typename Grid< dimension >::CellIndices >
         rasterize_segment( const Grid< dimension >& grid,
@@ -61,4 +96,50 @@ namespace geode
     [[nodiscard]] std::vector< Grid3D::CellIndices >
         opengeode_mesh_api rasterize_closed_surface(
             const Grid3D& grid, const TriangulatedSurface3D& closed_surface );
+
+    /*!
+     * Same as rasterize_tetrahedron but returns the painted cells as runs,
+     * one per interval of cells along the first grid direction.
+     */
+    [[nodiscard]] std::vector< GridCellRun3D >
+        opengeode_mesh_api rasterize_tetrahedron_runs(
+            const Grid3D& grid, const Tetrahedron& tetrahedron );
+
+    /*!
+     * Same as rasterize_closed_surface but returns the painted cells as runs,
+     * one per interval of cells along the first grid direction.
+     * The output size depends on the surface complexity instead of the
+     * enclosed volume.
+     */
+    [[nodiscard]] std::vector< GridCellRun3D >
+        opengeode_mesh_api rasterize_closed_surface_runs(
+            const Grid3D& grid, const TriangulatedSurface3D& closed_surface );
+
+    /*!
+     * Rasterize every tetrahedron of the solid (see rasterize_tetrahedron)
+     * into a grid cell attribute.
+     * Each tetrahedron is rasterized once, in parallel, and its cells are
+     * split into grid tiles. Tiles are then painted in parallel, each one in
+     * increasing tetrahedron id order, so the result does not depend on the
+     * scheduling.
+     * @param[in] attribute_name Name of the created cell attribute. An
+     * existing attribute with this name is replaced.
+     * @param[in] value Value stored in each cell.
+     */
+    [[nodiscard]] std::shared_ptr< VariableAttribute< index_t > >
+        opengeode_mesh_api rasterize_tetrahedral_solid( const Grid3D& grid,
+            const TetrahedralSolid3D& solid,
+            std::string_view attribute_name,
+            RASTERIZATION_VALUE value );
+
+    /*!
+     * Rasterize every triangle of the surface (see
+     * conservative_rasterize_triangle) into a grid cell attribute.
+     * Same parallel scheme as rasterize_tetrahedral_solid.
+     */
+    [[nodiscard]] std::shared_ptr< VariableAttribute< index_t > >
+        opengeode_mesh_api rasterize_triangulated_surface( const Grid3D& grid,
+            const TriangulatedSurface3D& surface,
+            std::string_view attribute_name,
+            RASTERIZATION_VALUE value );
 } // namespace geode
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <optional>
+
+#include <geode/basic/attribute.hpp>
+
+#include <geode/mesh/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Grid );
+    FORWARD_DECLARATION_DIMENSION_CLASS( TriangulatedSurface );
+    ALIAS_3D( Grid );
+    ALIAS_3D( TriangulatedSurface );
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * API function for computing the signed distance from every cell
+     * barycenter of a grid to a closed surface: negative inside the surface,
+     * positive outside.
+     * Distances are exact point-to-triangle distances computed with an AABB
+     * tree, the sign is given by rasterize_closed_surface_runs.
+     *
+     * @param[in] grid Regular grid on which the signed distance map is
+     * computed. The surface should be included in the grid.
+     * @param[in] closed_surface Closed surface to which distances are computed.
+     * @param[in] distance_map_name Name of the attribute to store the map on
+     * the \param grid. An existing attribute with this name is replaced.
+     * @param[in] narrow_band If given, exact distances are only computed for
+     * cells closer than this distance to the surface (selected with a
+     * euclidean distance transform of the rasterized surface). Other cells are
+     * set to +/- narrow_band.
+     * @exception OpenGeodeException if the narrow band is not strictly
+     * positive.
+     * @return the created attribute
+     */
+    [[nodiscard]] std::shared_ptr< VariableAttribute< double > >
+        opengeode_mesh_api signed_distance_transform( const Grid3D& grid,
+            const TriangulatedSurface3D& closed_surface,
+            std::string_view distance_map_name,
+            std::optional< double > narrow_band = std::nullopt );
+} // namespace geode
@@ -57,6 +57,17 @@ namespace geode
                 unique_vertices,
             const ComponentType& type );
 
+    template < index_t dimension >
+    [[nodiscard]] ComponentMeshVertexGeneric< dimension >
+        component_mesh_vertex_generic(
+            absl::Span< const ComponentMeshVerticesRange > unique_vertices );
+
+    template < index_t dimension >
+    [[nodiscard]] ComponentMeshVertexGeneric< dimension >
+        component_mesh_vertex_generic(
+            absl::Span< const ComponentMeshVerticesRange > unique_vertices,
+            const ComponentType& type );
+
     using ComponentMeshVertexPairs = ComponentMeshVertexGeneric< 2 >;
     [[nodiscard]] ComponentMeshVertexPairs opengeode_model_api
         component_mesh_vertex_pairs(
@@ -67,6 +78,15 @@ namespace geode
             absl::Span< const ComponentMeshVertex > unique_vertices0,
             absl::Span< const ComponentMeshVertex > unique_vertices1,
             const ComponentType& type );
+    [[nodiscard]] ComponentMeshVertexPairs opengeode_model_api
+        component_mesh_vertex_pairs(
+            const ComponentMeshVerticesRange& unique_vertices0,
+            const ComponentMeshVerticesRange& unique_vertices1 );
+    [[nodiscard]] ComponentMeshVertexPairs opengeode_model_api
+        component_mesh_vertex_pairs(
+            const ComponentMeshVerticesRange& unique_vertices0,
+            const ComponentMeshVerticesRange& unique_vertices1,
+            const ComponentType& type );
 
     using ComponentMeshVertexTriplets = ComponentMeshVertexGeneric< 3 >;
     [[nodiscard]] ComponentMeshVertexTriplets opengeode_model_api
@@ -80,6 +100,17 @@ namespace geode
             absl::Span< const ComponentMeshVertex > unique_vertices1,
             absl::Span< const ComponentMeshVertex > unique_vertices2,
             const ComponentType& type );
+    [[nodiscard]] ComponentMeshVertexTriplets opengeode_model_api
+        component_mesh_vertex_triplets(
+            const ComponentMeshVerticesRange& unique_vertices0,
+            const ComponentMeshVerticesRange& unique_vertices1,
+            const ComponentMeshVerticesRange& unique_vertices2 );
+    [[nodiscard]] ComponentMeshVertexTriplets opengeode_model_api
+        component_mesh_vertex_triplets(
+            const ComponentMeshVerticesRange& unique_vertices0,
+            const ComponentMeshVerticesRange& unique_vertices1,
+            const ComponentMeshVerticesRange& unique_vertices2,
+            const ComponentType& type );
 
     template < index_t dimension, typename... UniqueVertices >
     [[nodiscard]] ComponentMeshVertexGeneric< dimension >
@@ -23,6 +23,11 @@
 
 #pragma once
 
+#include <functional>
+#include <vector>
+
+#include <absl/types/span.h>
+
 #include <geode/basic/pimpl.hpp>
 
 #include <geode/model/representation/core/mapping.hpp>
@@ -45,6 +50,16 @@ namespace geode
 
         ModelCopyMapping concatenate( const Model& other_model );
 
+        /*!
+         * Concatenate several models at once.
+         * Component meshes of all the models are copied in parallel and
+         * unique vertices are assigned in one bulk operation.
+         * @return The mapping of each given model, in the same order.
+         */
+        std::vector< ModelCopyMapping > concatenate(
+            absl::Span< const std::reference_wrapper< const Model > >
+                other_models );
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
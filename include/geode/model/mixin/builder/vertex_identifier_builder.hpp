@@ -77,6 +77,22 @@ namespace geode
         void set_unique_vertex(
             ComponentMeshVertex component_vertex_id, index_t unique_vertex_id );
 
+        /*!
+         * Identify all the vertices of a component to existing unique vertices.
+         * @param[in] component_id Component owning the vertices.
+         * @param[in] unique_vertices Unique vertex index of each component
+         * mesh vertex. NO_ID unsets the component vertex.
+         */
+        void set_unique_vertices( const ComponentID& component_id,
+            absl::Span< const index_t > unique_vertices );
+
+        /*!
+         * Identify the vertices of several components at once.
+         * Components are processed in parallel.
+         */
+        void set_unique_vertices(
+            absl::Span< const ComponentUniqueVertices > components_vertices );
+
         /*!
          * Remove a component vertex to its unique vertex index.
          * @param[in] component_vertex_id Index of the vertex in the component.
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <absl/container/inlined_vector.h>
+
+#include <geode/basic/bitsery_archive.hpp>
+
+#include <geode/model/common.hpp>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Compact identification of a vertex in a geometric component.
+         * The component is given by its dense index in the VertexIdentifier
+         * instead of its ComponentID.
+         */
+        struct CompactComponentVertex
+        {
+            [[nodiscard]] bool operator==(
+                const CompactComponentVertex& other ) const
+            {
+                return component == other.component && vertex == other.vertex;
+            }
+
+            template < typename Archive >
+            void serialize( Archive& archive )
+            {
+                archive.ext( *this,
+                    Growable< Archive, CompactComponentVertex >{
+                        { []( Archive& a, CompactComponentVertex& value ) {
+                            a.value4b( value.component );
+                            a.value4b( value.vertex );
+                        } } } );
+            }
+
+            index_t component{ NO_ID };
+            index_t vertex{ NO_ID };
+        };
+
+        /*!
+         * Most unique vertices are shared by very few component vertices:
+         * they are stored inline without any heap allocation.
+         */
+        using CompactComponentVertices =
+            absl::InlinedVector< CompactComponentVertex, 2 >;
+    } // namespace detail
+} // namespace geode
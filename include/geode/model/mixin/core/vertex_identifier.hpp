@@ -6,9 +6,11 @@
 
 #include <geode/basic/passkey.hpp>
 #include <geode/basic/pimpl.hpp>
+#include <geode/basic/range.hpp>
 
 #include <geode/model/common.hpp>
 #include <geode/model/mixin/core/component_type.hpp>
+#include <geode/model/mixin/core/detail/compact_component_vertex.hpp>
 
 namespace geode
 {
@@ -49,6 +51,86 @@ namespace geode
         ComponentMeshVertex();
     };
 
+    /*!
+     * Reference to a vertex in a geometric component, valid as long as the
+     * VertexIdentifier it comes from is not modified.
+     */
+    struct ComponentMeshVertexRef
+    {
+        [[nodiscard]] ComponentMeshVertex component_mesh_vertex() const
+        {
+            return { component_id, vertex };
+        }
+
+        const ComponentID& component_id;
+        index_t vertex;
+    };
+
+    /*!
+     * Iterate over the component vertices identified with a unique vertex
+     * directly on the VertexIdentifier storage, without building a container.
+     * The range is invalidated by any modification of the VertexIdentifier.
+     * Example:
+     *    for( const auto& cmv :
+     *        identifier.component_mesh_vertices_range( unique_vertex ) )
+     *    {
+     *      // do something with cmv.component_id and cmv.vertex
+     *    }
+     */
+    class ComponentMeshVerticesRange : public BaseRange< index_t >
+    {
+    public:
+        ComponentMeshVerticesRange(
+            absl::Span< const detail::CompactComponentVertex > vertices,
+            absl::Span< const ComponentID > components )
+            : BaseRange< index_t >( 0, vertices.size() ),
+              vertices_( vertices ),
+              components_( components )
+        {
+        }
+
+        [[nodiscard]] const ComponentMeshVerticesRange& begin() const
+        {
+            return *this;
+        }
+
+        [[nodiscard]] const ComponentMeshVerticesRange& end() const
+        {
+            return *this;
+        }
+
+        [[nodiscard]] ComponentMeshVertexRef operator*() const
+        {
+            const auto& compact_vertex = vertices_[this->current()];
+            return { components_[compact_vertex.component],
+                compact_vertex.vertex };
+        }
+
+        [[nodiscard]] index_t size() const
+        {
+            return static_cast< index_t >( vertices_.size() );
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return vertices_.empty();
+        }
+
+    private:
+        absl::Span< const detail::CompactComponentVertex > vertices_;
+        absl::Span< const ComponentID > components_;
+    };
+
+    /*!
+     * Unique vertex index of each vertex of a geometric component.
+     * NO_ID means the component vertex is not identified.
+     */
+    struct ComponentUniqueVertices
+    {
+        ComponentID component_id;
+        absl::Span< const index_t > unique_vertices;
+    };
+
     /*!
      * This class identifies groups of geometric component vertices
      * as unique vertices.
@@ -70,9 +152,20 @@ namespace geode
         /*!
          * Return the component vertices identified with an unique vertex.
          * @param[in] unique_vertex_id Indice of the unique vertex.
+         * @note The vertices are stored compactly and copied on each call,
+         * prefer component_mesh_vertices_range in loops.
          */
-        [[nodiscard]] const std::vector< ComponentMeshVertex >&
+        [[nodiscard]] std::vector< ComponentMeshVertex >
             component_mesh_vertices( index_t unique_vertex_id ) const;
+
+        /*!
+         * Iterate over the component vertices identified with an unique
+         * vertex without any allocation.
+         * @param[in] unique_vertex_id Indice of the unique vertex.
+         */
+        [[nodiscard]] ComponentMeshVerticesRange component_mesh_vertices_range(
+            index_t unique_vertex_id ) const;
+
         /*!
          * Return the unique vertex index of a given component vertex.
          * @param[in] component_vertex Vertex index in a geometric component.
@@ -137,6 +230,24 @@ namespace geode
             index_t unique_vertex_id,
             BuilderKey );
 
+        /*!
+         * Identify all the vertices of a component to existing unique vertices.
+         * @param[in] component_id Component owning the vertices.
+         * @param[in] unique_vertices Unique vertex index of each component
+         * mesh vertex. NO_ID unsets the component vertex.
+         */
+        void set_unique_vertices( const ComponentID& component_id,
+            absl::Span< const index_t > unique_vertices,
+            BuilderKey );
+
+        /*!
+         * Identify the vertices of several components at once.
+         * Components are processed in parallel.
+         */
+        void set_unique_vertices(
+            absl::Span< const ComponentUniqueVertices > components_vertices,
+            BuilderKey );
+
         /*!
          * Remove a component vertex to its unique vertex index.
          * @param[in] component_vertex_id Index of the vertex in the component.
@@ -25,6 +25,9 @@
 
 #include <async++.h>
 
+#include <absl/container/fixed_array.h>
+#include <absl/types/span.h>
+
 #include <geode/basic/range.hpp>
 #include <geode/basic/uuid.hpp>
 
@@ -43,6 +46,7 @@
 #include <geode/model/mixin/core/model_boundary.hpp>
 #include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/mixin/core/surface_collection.hpp>
+#include <geode/model/mixin/core/vertex_identifier.hpp>
 #include <geode/model/representation/core/mapping.hpp>
 
 namespace geode
@@ -354,27 +358,107 @@ namespace geode
             }
         }
 
+        /*!
+         * Unique vertices of a component mesh to copy into another model
+         */
+        struct UniqueVerticesCopy
+        {
+            const VertexIdentifier& from;
+            ComponentID component_from;
+            ComponentID component_to;
+            index_t nb_vertices;
+            index_t first_new_unique_vertex_id;
+        };
+
+        template < typename Range >
+        void add_unique_vertices_copies( const VertexIdentifier& from,
+            Range&& range,
+            const Mapping& mapping,
+            index_t first_new_unique_vertex_id,
+            std::vector< UniqueVerticesCopy >& copies )
+        {
+            for( const auto& component : range )
+            {
+                const auto& component_id = component.component_id();
+                copies.push_back( { from, component_id,
+                    { component_id.type(), mapping.in2out( component.id() ) },
+                    component.mesh().nb_vertices(),
+                    first_new_unique_vertex_id } );
+            }
+        }
+
+        template < typename ModelFrom >
+        void add_model_unique_vertices_copies( const ModelFrom& from,
+            const ModelCopyMapping& mapping,
+            index_t first_new_unique_vertex_id,
+            std::vector< UniqueVerticesCopy >& copies )
+        {
+            static constexpr auto dimension = ModelFrom::dim;
+            add_unique_vertices_copies( from, from.corners(),
+                mapping.at( Corner< dimension >::component_type_static() ),
+                first_new_unique_vertex_id, copies );
+            add_unique_vertices_copies( from, from.lines(),
+                mapping.at( Line< dimension >::component_type_static() ),
+                first_new_unique_vertex_id, copies );
+            add_unique_vertices_copies( from, from.surfaces(),
+                mapping.at( Surface< dimension >::component_type_static() ),
+                first_new_unique_vertex_id, copies );
+            if constexpr( dimension == 3 )
+            {
+                add_unique_vertices_copies( from, from.blocks(),
+                    mapping.at( Block< dimension >::component_type_static() ),
+                    first_new_unique_vertex_id, copies );
+            }
+        }
+
+        /*!
+         * Compute the new unique vertices of each component in parallel and
+         * assign them in one bulk operation
+         */
+        template < typename BuilderTo >
+        void copy_unique_vertices(
+            absl::Span< const UniqueVerticesCopy > copies,
+            BuilderTo& builder_to )
+        {
+            absl::FixedArray< std::vector< index_t > > unique_vertices(
+                copies.size() );
+            async::parallel_for( async::irange( index_t{ 0 },
+                                     static_cast< index_t >( copies.size() ) ),
+                [&copies, &unique_vertices]( index_t c ) {
+                    const auto& copy = copies[c];
+                    auto& values = unique_vertices[c];
+                    values.resize( copy.nb_vertices, NO_ID );
+                    for( const auto v : Range{ copy.nb_vertices } )
+                    {
+                        const auto unique_vertex =
+                            copy.from.unique_vertex( { copy.component_from, v } );
+                        if( unique_vertex != NO_ID )
+                        {
+                            values[v] =
+                                copy.first_new_unique_vertex_id + unique_vertex;
+                        }
+                    }
+                } );
+            std::vector< ComponentUniqueVertices > components;
+            components.reserve( copies.size() );
+            for( const auto c : Indices{ copies } )
+            {
+                components.push_back(
+                    { copies[c].component_to, unique_vertices[c] } );
+            }
+            builder_to.set_unique_vertices( components );
+        }
+
         template < typename Model, typename BuilderTo >
         void copy_vertex_identifier_components( const Model& from,
             BuilderTo& builder_to,
             index_t first_new_unique_vertex_id,
             const ModelCopyMapping& mapping )
         {
-            async::parallel_for(
-                async::irange( index_t{ 0 }, from.nb_unique_vertices() ),
-                [&from, &builder_to, &first_new_unique_vertex_id, &mapping](
-                    index_t v ) {
-                    for( const auto& mesh_vertex :
-                        from.component_mesh_vertices( v ) )
-                    {
-                        const auto& type = mesh_vertex.component_id.type();
-                        builder_to.set_unique_vertex(
-                            { { type, mapping.at( type ).in2out(
-                                          mesh_vertex.component_id.id() ) },
-                                mesh_vertex.vertex },
-                            first_new_unique_vertex_id + v );
-                    }
-                } );
+            std::vector< UniqueVerticesCopy > copies;
+            add_model_unique_vertices_copies(
+                from, mapping, first_new_unique_vertex_id, copies );
+            copy_unique_vertices( copies, builder_to );
         }
     } // namespace detail
 } // namespace geode
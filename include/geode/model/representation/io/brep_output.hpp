@@ -27,6 +27,8 @@
 #include <string_view>
 #include <vector>
 
+#include <async++.h>
+
 #include <geode/basic/factory.hpp>
 #include <geode/basic/output.hpp>
 
@@ -48,6 +50,14 @@ namespace geode
     std::vector< std::string > opengeode_model_api save_brep(
         const BRep& brep, std::string_view filename );
 
+    /*!
+     * Save a clone of the BRep in a background task, see save_async.
+     * The clone is made before returning, the BRep can then be modified.
+     */
+    [[nodiscard]] async::task< std::vector< std::string > >
+        opengeode_model_api save_brep_async(
+            const BRep& brep, std::string_view filename );
+
     class BRepOutput : public Output< BRep >
     {
     protected:
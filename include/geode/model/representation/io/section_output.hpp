@@ -27,6 +27,8 @@
 #include <string_view>
 #include <vector>
 
+#include <async++.h>
+
 #include <geode/basic/factory.hpp>
 #include <geode/basic/output.hpp>
 
@@ -48,6 +50,14 @@ namespace geode
     std::vector< std::string > opengeode_model_api save_section(
         const Section& section, std::string_view filename );
 
+    /*!
+     * Save a clone of the Section in a background task, see save_async.
+     * The clone is made before returning, the Section can then be modified.
+     */
+    [[nodiscard]] async::task< std::vector< std::string > >
+        opengeode_model_api save_section_async(
+            const Section& section, std::string_view filename );
+
     class SectionOutput : public Output< Section >
     {
     protected:
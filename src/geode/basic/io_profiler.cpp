@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/io_profiler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/strings/str_cat.h>
+#include <absl/time/clock.h>
+
+#include <geode/basic/pimpl_impl.hpp>
+
+namespace geode
+{
+    index_t IOProfile::nb_threads() const
+    {
+        index_t nb{ 0 };
+        for( const auto& stage : stages )
+        {
+            nb = std::max( nb, stage.thread + 1 );
+        }
+        return nb;
+    }
+
+    double IOProfile::thread_utilization() const
+    {
+        const auto nb = nb_threads();
+        if( nb == 0 || duration <= absl::ZeroDuration() )
+        {
+            return 0;
+        }
+        using Interval = std::pair< absl::Duration, absl::Duration >;
+        std::vector< std::vector< Interval > > intervals( nb );
+        for( const auto& stage : stages )
+        {
+            intervals[stage.thread].emplace_back(
+                stage.start, stage.start + stage.duration );
+        }
+        auto busy = absl::ZeroDuration();
+        for( auto& thread_intervals : intervals )
+        {
+            std::sort( thread_intervals.begin(), thread_intervals.end() );
+            auto current_end = absl::ZeroDuration();
+            for( const auto& [begin, end] : thread_intervals )
+            {
+                const auto real_begin = std::max( begin, current_end );
+                if( end > real_begin )
+                {
+                    busy += end - real_begin;
+                    current_end = end;
+                }
+            }
+        }
+        const auto available = duration * static_cast< int >( nb );
+        return std::min( 1., absl::FDivDuration( busy, available ) );
+    }
+
+    std::string IOProfile::string() const
+    {
+        auto message = absl::StrCat( name, ": ",
+            absl::FormatDuration( duration ), ", ", bytes, " bytes, ",
+            nb_threads(), " thread(s), ",
+            static_cast< int >( 100 * thread_utilization() ),
+            "% thread utilization" );
+        for( const auto& stage : stages )
+        {
+            absl::StrAppend( &message, "\n    ", stage.name, " [thread ",
+                stage.thread, "] ", absl::FormatDuration( stage.duration ) );
+            if( stage.bytes != 0 )
+            {
+                absl::StrAppend( &message, ", ", stage.bytes, " bytes" );
+            }
+        }
+        return message;
+    }
+
+    class IOProfiler::Impl
+    {
+    public:
+        void set_hook( Hook hook )
+        {
+            const std::lock_guard< std::mutex > locking{ lock_ };
+            enabled_ = static_cast< bool >( hook );
+            hook_ = std::move( hook );
+        }
+
+        bool is_enabled() const
+        {
+            return enabled_;
+        }
+
+        absl::Time begin_stage( IOProfileStage& stage )
+        {
+            const auto now = absl::Now();
+            const std::lock_guard< std::mutex > locking{ lock_ };
+            stage.top_level = nb_running_stages_ == 0;
+            if( stage.top_level )
+            {
+                start_ = now;
+                profile_ = IOProfile{};
+                threads_.clear();
+            }
+            nb_running_stages_++;
+            return now;
+        }
+
+        void end_stage( IOProfileStage stage, absl::Time start )
+        {
+            const auto now = absl::Now();
+            Hook hook;
+            IOProfile profile;
+            {
+                const std::lock_guard< std::mutex > locking{ lock_ };
+                nb_running_stages_--;
+                stage.start = start - start_;
+                stage.duration = now - start;
+                stage.thread =
+                    threads_
+                        .try_emplace( std::this_thread::get_id(),
+                            static_cast< index_t >( threads_.size() ) )
+                        .first->second;
+                if( stage.top_level )
+                {
+                    profile_.name = stage.name;
+                    profile_.bytes = stage.bytes;
+                }
+                profile_.stages.emplace_back( std::move( stage ) );
+                if( nb_running_stages_ != 0 )
+                {
+                    return;
+                }
+                profile_.duration = now - start_;
+                profile = std::move( profile_ );
+                hook = hook_;
+            }
+            if( hook )
+            {
+                hook( profile );
+            }
+        }
+
+    private:
+        std::mutex lock_;
+        std::atomic< bool > enabled_{ false };
+        Hook hook_;
+        index_t nb_running_stages_{ 0 };
+        absl::Time start_;
+        IOProfile profile_;
+        absl::flat_hash_map< std::thread::id, index_t > threads_;
+    };
+
+    IOProfiler::IOProfiler() = default;
+
+    IOProfiler::~IOProfiler() = default;
+
+    void IOProfiler::set_hook( Hook hook )
+    {
+        instance().impl_->set_hook( std::move( hook ) );
+    }
+
+    bool IOProfiler::is_enabled()
+    {
+        return instance().impl_->is_enabled();
+    }
+
+    absl::Time IOProfiler::begin_stage( IOProfileStage& stage )
+    {
+        return instance().impl_->begin_stage( stage );
+    }
+
+    void IOProfiler::end_stage( IOProfileStage stage, absl::Time start )
+    {
+        instance().impl_->end_stage( std::move( stage ), start );
+    }
+
+    IOProfiler& IOProfiler::instance()
+    {
+        static IOProfiler profiler;
+        return profiler;
+    }
+
+    class IOProfileScope::Impl
+    {
+    public:
+        explicit Impl( std::string_view name )
+            : active_{ IOProfiler::is_enabled() }
+        {
+            if( active_ )
+            {
+                stage_.name = to_string( name );
+                start_ = IOProfiler::begin_stage( stage_ );
+            }
+        }
+
+        ~Impl()
+        {
+            if( active_ )
+            {
+                IOProfiler::end_stage( std::move( stage_ ), start_ );
+            }
+        }
+
+        void add_bytes( std::uintmax_t bytes )
+        {
+            stage_.bytes += bytes;
+        }
+
+        void add_file_bytes( std::string_view filename )
+        {
+            if( !active_ )
+            {
+                return;
+            }
+            const std::filesystem::path path{ to_string( filename ) };
+            std::error_code error;
+            if( !std::filesystem::is_directory( path, error ) )
+            {
+                add_regular_file_bytes( path );
+                return;
+            }
+            for( const auto& file :
+                std::filesystem::recursive_directory_iterator( path, error ) )
+            {
+                add_regular_file_bytes( file.path() );
+            }
+        }
+
+    private:
+        void add_regular_file_bytes( const std::filesystem::path& path )
+        {
+            std::error_code error;
+            const auto size = std::filesystem::file_size( path, error );
+            if( !error )
+            {
+                stage_.bytes += size;
+            }
+        }
+
+    private:
+        bool active_;
+        IOProfileStage stage_;
+        absl::Time start_;
+    };
+
+    IOProfileScope::IOProfileScope( std::string_view name ) : impl_{ name } {}
+
+    IOProfileScope::~IOProfileScope() = default;
+
+    void IOProfileScope::add_bytes( std::uintmax_t bytes )
+    {
+        impl_->add_bytes( bytes );
+    }
+
+    void IOProfileScope::add_file_bytes( std::string_view filename )
+    {
+        impl_->add_file_bytes( filename );
+    }
+} // namespace geode
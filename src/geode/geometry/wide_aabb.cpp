@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geometry/wide_aabb.hpp>
+
+#include <geode/geometry/point.hpp>
+
+namespace geode
+{
+    template < index_t dimension >
+    WideAABBTree< dimension >::WideAABBTree() = default;
+
+    template < index_t dimension >
+    WideAABBTree< dimension >::WideAABBTree(
+        absl::Span< const BoundingBox< dimension > > bboxes )
+        : impl_{ bboxes }
+    {
+    }
+
+    template < index_t dimension >
+    WideAABBTree< dimension >::WideAABBTree( WideAABBTree&& ) noexcept =
+        default;
+    template < index_t dimension >
+    WideAABBTree< dimension >::~WideAABBTree() = default;
+
+    template < index_t dimension >
+    WideAABBTree< dimension >& WideAABBTree< dimension >::operator=(
+        WideAABBTree&& ) noexcept = default;
+
+    template < index_t dimension >
+    index_t WideAABBTree< dimension >::nb_bboxes() const
+    {
+        return impl_->nb_bboxes();
+    }
+
+    template < index_t dimension >
+    const BoundingBox< dimension >&
+        WideAABBTree< dimension >::bounding_box() const
+    {
+        OPENGEODE_EXCEPTION( impl_->nb_bboxes() != 0,
+            "[WideAABBTree::bounding_box] Cannot return "
+            "the bounding_box of an empty WideAABBTree." );
+        return impl_->bounding_box();
+    }
+
+    template < index_t dimension >
+    std::size_t WideAABBTree< dimension >::memory_size() const
+    {
+        return impl_->memory_size();
+    }
+
+    template < index_t dimension >
+    std::vector< index_t > WideAABBTree< dimension >::containing_boxes(
+        const Point< dimension >& query ) const
+    {
+        if( nb_bboxes() == 0 )
+        {
+            return {};
+        }
+        std::vector< index_t > result;
+        std::mutex mutex;
+        auto action = [&result, &mutex]( index_t box ) {
+            std::lock_guard< std::mutex > lock( mutex );
+            result.push_back( box );
+            return false;
+        };
+        impl_->box_intersect_recursive(
+            impl_->to_float_box( query ), Impl::ROOT_INDEX, 0, action );
+        return result;
+    }
+
+    template class opengeode_geometry_api WideAABBTree< 2 >;
+    template class opengeode_geometry_api WideAABBTree< 3 >;
+} // namespace geode
@@ -27,10 +27,15 @@
 
 #include <geode/image/core/bitsery_archive.hpp>
 #include <geode/image/core/raster_image.hpp>
+#include <geode/image/core/typed_raster_image.hpp>
 #include <geode/image/io/geode/geode_bitsery_raster_input.hpp>
 #include <geode/image/io/geode/geode_bitsery_raster_output.hpp>
+#include <geode/image/io/geode/geode_bitsery_typed_raster_input.hpp>
+#include <geode/image/io/geode/geode_bitsery_typed_raster_output.hpp>
 #include <geode/image/io/raster_image_input.hpp>
 #include <geode/image/io/raster_image_output.hpp>
+#include <geode/image/io/typed_raster_image_input.hpp>
+#include <geode/image/io/typed_raster_image_output.hpp>
 
 #define BITSERY_INPUT_RASTER_REGISTER_XD( dimension )                          \
     geode::RasterImageInputFactory##dimension##D::register_creator<            \
@@ -50,13 +55,35 @@
     BITSERY_OUTPUT_RASTER_REGISTER_XD( 2 );                                    \
     BITSERY_OUTPUT_RASTER_REGISTER_XD( 3 )
 
+#define BITSERY_TYPED_RASTER_REGISTER_XD( Pixel, dimension )                   \
+    geode::TypedRasterImageInputFactory< Pixel, dimension >::register_creator< \
+        geode::OpenGeodeTypedRasterImageInput< Pixel, dimension > >(           \
+        geode::TypedRasterImage< Pixel,                                        \
+            dimension >::native_extension_static() );                          \
+    geode::TypedRasterImageOutputFactory< Pixel,                               \
+        dimension >::register_creator<                                         \
+        geode::OpenGeodeTypedRasterImageOutput< Pixel, dimension > >(          \
+        geode::TypedRasterImage< Pixel,                                        \
+            dimension >::native_extension_static() )
+
+#define BITSERY_TYPED_RASTER_REGISTER_2D_3D( Pixel )                           \
+    BITSERY_TYPED_RASTER_REGISTER_XD( Pixel, 2 );                              \
+    BITSERY_TYPED_RASTER_REGISTER_XD( Pixel, 3 )
+
 namespace geode
 {
+    using Float3 = std::array< float, 3 >;
+
     OPENGEODE_LIBRARY_IMPLEMENTATION( OpenGeodeImage )
     {
         OpenGeodeBasicLibrary::initialize();
         BITSERY_INPUT_RASTER_REGISTER_2D_3D();
         BITSERY_OUTPUT_RASTER_REGISTER_2D_3D();
+        BITSERY_TYPED_RASTER_REGISTER_2D_3D( std::uint8_t );
+        BITSERY_TYPED_RASTER_REGISTER_2D_3D( std::uint16_t );
+        BITSERY_TYPED_RASTER_REGISTER_2D_3D( float );
+        BITSERY_TYPED_RASTER_REGISTER_2D_3D( double );
+        BITSERY_TYPED_RASTER_REGISTER_2D_3D( Float3 );
         BitseryExtensions::register_functions(
             register_image_serialize_pcontext,
             register_image_deserialize_pcontext );
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/image/core/raster_image_sampling.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <async++.h>
+
+#include <geode/basic/range.hpp>
+
+#include <geode/image/core/raster_image.hpp>
+#include <geode/image/core/rgb_color.hpp>
+
+namespace
+{
+    using Channels = std::array< double, 3 >;
+
+    void add_color(
+        Channels& channels, const geode::RGBColor& color, double weight )
+    {
+        channels[0] += weight * color.red();
+        channels[1] += weight * color.green();
+        channels[2] += weight * color.blue();
+    }
+
+    geode::local_index_t to_channel( double value )
+    {
+        return static_cast< geode::local_index_t >(
+            std::clamp( std::round( value ), 0., 255. ) );
+    }
+
+    geode::RGBColor to_color( const Channels& channels )
+    {
+        return { to_channel( channels[0] ), to_channel( channels[1] ),
+            to_channel( channels[2] ) };
+    }
+
+    template < geode::index_t dimension >
+    geode::RasterImage< dimension > downsample(
+        const geode::RasterImage< dimension >& image )
+    {
+        std::array< geode::index_t, dimension > cells_number;
+        for( const auto d : geode::LRange{ dimension } )
+        {
+            cells_number[d] = ( image.nb_cells_in_direction( d ) + 1 ) / 2;
+        }
+        geode::RasterImage< dimension > coarse{ cells_number };
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, coarse.nb_cells() ),
+            [&image, &coarse]( geode::index_t cell ) {
+                const auto coarse_indices = coarse.cell_indices( cell );
+                Channels channels{ 0, 0, 0 };
+                geode::index_t nb_children{ 0 };
+                for( const auto child : geode::Range{ 1u << dimension } )
+                {
+                    auto indices = coarse_indices;
+                    bool inside{ true };
+                    for( const auto d : geode::LRange{ dimension } )
+                    {
+                        indices[d] = 2 * indices[d] + ( ( child >> d ) & 1 );
+                        inside = inside
+                                 && indices[d]
+                                        < image.nb_cells_in_direction( d );
+                    }
+                    if( !inside )
+                    {
+                        continue;
+                    }
+                    add_color(
+                        channels, image.color( image.cell_index( indices ) ),
+                        1 );
+                    nb_children++;
+                }
+                for( auto& channel : channels )
+                {
+                    channel /= nb_children;
+                }
+                coarse.set_color( cell, to_color( channels ) );
+            } );
+        return coarse;
+    }
+
+    template < geode::index_t dimension >
+    bool is_single_cell( const geode::RasterImage< dimension >& image )
+    {
+        for( const auto d : geode::LRange{ dimension } )
+        {
+            if( image.nb_cells_in_direction( d ) > 1 )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    std::vector< RasterImage< dimension > > build_raster_image_mipmaps(
+        const RasterImage< dimension >& image )
+    {
+        std::vector< RasterImage< dimension > > mipmaps;
+        const auto* level = &image;
+        while( level->nb_cells() > 0 && !is_single_cell( *level ) )
+        {
+            mipmaps.emplace_back( downsample( *level ) );
+            level = &mipmaps.back();
+        }
+        return mipmaps;
+    }
+
+    template < index_t dimension >
+    RGBColor raster_image_value( const RasterImage< dimension >& image,
+        const ImageCoordinates< dimension >& coordinates )
+    {
+        OPENGEODE_EXCEPTION( image.nb_cells() > 0,
+            "[raster_image_value] Image should not be empty" );
+        std::array< index_t, dimension > lower;
+        std::array< index_t, dimension > upper;
+        std::array< double, dimension > upper_weight;
+        for( const auto d : LRange{ dimension } )
+        {
+            const auto nb_cells = image.nb_cells_in_direction( d );
+            const auto position =
+                std::clamp( coordinates[d] * nb_cells - 0.5, 0.,
+                    static_cast< double >( nb_cells - 1 ) );
+            lower[d] = static_cast< index_t >( position );
+            upper[d] = std::min( lower[d] + 1, nb_cells - 1 );
+            upper_weight[d] = position - lower[d];
+        }
+        Channels channels{ 0, 0, 0 };
+        for( const auto corner : Range{ 1u << dimension } )
+        {
+            auto indices = lower;
+            double weight{ 1 };
+            for( const auto d : LRange{ dimension } )
+            {
+                if( ( corner >> d ) & 1 )
+                {
+                    indices[d] = upper[d];
+                    weight *= upper_weight[d];
+                }
+                else
+                {
+                    weight *= 1 - upper_weight[d];
+                }
+            }
+            if( weight > 0 )
+            {
+                add_color(
+                    channels, image.color( image.cell_index( indices ) ),
+                    weight );
+            }
+        }
+        return to_color( channels );
+    }
+
+    template < index_t dimension >
+    std::vector< RGBColor > raster_image_values(
+        const RasterImage< dimension >& image,
+        absl::Span< const ImageCoordinates< dimension > > coordinates )
+    {
+        std::vector< RGBColor > values( coordinates.size() );
+        async::parallel_for(
+            async::irange( size_t{ 0 }, coordinates.size() ),
+            [&image, &coordinates, &values]( size_t point ) {
+                values[point] =
+                    raster_image_value( image, coordinates[point] );
+            } );
+        return values;
+    }
+
+    template opengeode_image_api std::vector< RasterImage< 1 > >
+        build_raster_image_mipmaps< 1 >( const RasterImage< 1 >& );
+    template opengeode_image_api RGBColor raster_image_value< 1 >(
+        const RasterImage< 1 >&, const ImageCoordinates< 1 >& );
+    template opengeode_image_api std::vector< RGBColor >
+        raster_image_values< 1 >( const RasterImage< 1 >&,
+            absl::Span< const ImageCoordinates< 1 > > );
+
+    template opengeode_image_api std::vector< RasterImage< 2 > >
+        build_raster_image_mipmaps< 2 >( const RasterImage< 2 >& );
+    template opengeode_image_api RGBColor raster_image_value< 2 >(
+        const RasterImage< 2 >&, const ImageCoordinates< 2 >& );
+    template opengeode_image_api std::vector< RGBColor >
+        raster_image_values< 2 >( const RasterImage< 2 >&,
+            absl::Span< const ImageCoordinates< 2 > > );
+
+    template opengeode_image_api std::vector< RasterImage< 3 > >
+        build_raster_image_mipmaps< 3 >( const RasterImage< 3 >& );
+    template opengeode_image_api RGBColor raster_image_value< 3 >(
+        const RasterImage< 3 >&, const ImageCoordinates< 3 >& );
+    template opengeode_image_api std::vector< RGBColor >
+        raster_image_values< 3 >( const RasterImage< 3 >&,
+            absl::Span< const ImageCoordinates< 3 > > );
+} // namespace geode
@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/image/core/typed_raster_image.hpp>
+
+#include <cstdint>
+
+#include <absl/strings/str_cat.h>
+
+#include <geode/basic/bitsery_archive.hpp>
+#include <geode/basic/internal/array_impl.hpp>
+#include <geode/basic/pimpl_impl.hpp>
+
+namespace
+{
+    template < typename Pixel >
+    struct PixelName;
+
+    template <>
+    struct PixelName< std::uint8_t >
+    {
+        static constexpr std::string_view name{ "uint8" };
+    };
+
+    template <>
+    struct PixelName< std::uint16_t >
+    {
+        static constexpr std::string_view name{ "uint16" };
+    };
+
+    template <>
+    struct PixelName< float >
+    {
+        static constexpr std::string_view name{ "float" };
+    };
+
+    template <>
+    struct PixelName< double >
+    {
+        static constexpr std::string_view name{ "double" };
+    };
+
+    template <>
+    struct PixelName< std::array< float, 3 > >
+    {
+        static constexpr std::string_view name{ "float3" };
+    };
+
+    template < typename Archive, typename Channel >
+    void serialize_channel( Archive& archive, Channel& channel )
+    {
+        if constexpr( sizeof( Channel ) == 1 )
+        {
+            archive.value1b( channel );
+        }
+        else if constexpr( sizeof( Channel ) == 2 )
+        {
+            archive.value2b( channel );
+        }
+        else if constexpr( sizeof( Channel ) == 4 )
+        {
+            archive.value4b( channel );
+        }
+        else
+        {
+            archive.value8b( channel );
+        }
+    }
+
+    template < typename Archive, typename Pixel >
+    void serialize_pixels( Archive& archive, std::vector< Pixel >& pixels )
+    {
+        if constexpr( !std::is_arithmetic_v< Pixel > )
+        {
+            archive.container( pixels, pixels.max_size(),
+                []( Archive& a, Pixel& pixel ) {
+                    for( auto& channel : pixel )
+                    {
+                        serialize_channel( a, channel );
+                    }
+                } );
+        }
+        else if constexpr( sizeof( Pixel ) == 1 )
+        {
+            archive.container1b( pixels, pixels.max_size() );
+        }
+        else if constexpr( sizeof( Pixel ) == 2 )
+        {
+            archive.container2b( pixels, pixels.max_size() );
+        }
+        else if constexpr( sizeof( Pixel ) == 4 )
+        {
+            archive.container4b( pixels, pixels.max_size() );
+        }
+        else
+        {
+            archive.container8b( pixels, pixels.max_size() );
+        }
+    }
+} // namespace
+
+namespace geode
+{
+    template < typename Pixel, index_t dimension >
+    class TypedRasterImage< Pixel, dimension >::Impl
+        : public internal::ArrayImpl< dimension >
+    {
+        friend class bitsery::Access;
+
+    public:
+        const Pixel& value( index_t index ) const
+        {
+            OPENGEODE_ASSERT( index < values_.size(),
+                "[TypedRasterImage::value] Accessing a "
+                "cell that does not exist" );
+            return values_[index];
+        }
+
+        void set_value( index_t index, Pixel value )
+        {
+            OPENGEODE_ASSERT( index < values_.size(),
+                "[TypedRasterImage::set_value] Accessing a "
+                "cell that does not exist" );
+            values_[index] = std::move( value );
+        }
+
+        absl::Span< const Pixel > values() const
+        {
+            return values_;
+        }
+
+        absl::Span< Pixel > modifiable_values()
+        {
+            return absl::MakeSpan( values_ );
+        }
+
+        void resize( index_t nb_cells )
+        {
+            values_.resize( nb_cells );
+        }
+
+        void copy_values( const Impl& impl )
+        {
+            values_ = impl.values_;
+        }
+
+    private:
+        template < typename Archive >
+        void serialize( Archive& archive )
+        {
+            archive.ext( *this,
+                Growable< Archive, Impl >{ { []( Archive& a, Impl& impl ) {
+                    a.ext( impl, bitsery::ext::BaseClass<
+                                     internal::ArrayImpl< dimension > >{} );
+                    serialize_pixels( a, impl.values_ );
+                } } } );
+        }
+
+    private:
+        std::vector< Pixel > values_;
+    };
+
+    template < typename Pixel, index_t dimension >
+    TypedRasterImage< Pixel, dimension >::TypedRasterImage() = default;
+
+    template < typename Pixel, index_t dimension >
+    TypedRasterImage< Pixel, dimension >::~TypedRasterImage() = default;
+
+    template < typename Pixel, index_t dimension >
+    TypedRasterImage< Pixel, dimension >::TypedRasterImage(
+        std::array< index_t, dimension > cells_number )
+        : CellArray< dimension >{ std::move( cells_number ) }
+    {
+        impl_->resize( this->nb_cells() );
+    }
+
+    template < typename Pixel, index_t dimension >
+    TypedRasterImage< Pixel, dimension >::TypedRasterImage(
+        TypedRasterImage&& ) noexcept = default;
+
+    template < typename Pixel, index_t dimension >
+    TypedRasterImage< Pixel, dimension >&
+        TypedRasterImage< Pixel, dimension >::operator=(
+            TypedRasterImage&& ) noexcept = default;
+
+    template < typename Pixel, index_t dimension >
+    std::string TypedRasterImage< Pixel, dimension >::native_extension_static()
+    {
+        static const auto extension =
+            absl::StrCat( "og_img", dimension, "d_", PixelName< Pixel >::name );
+        return extension;
+    }
+
+    template < typename Pixel, index_t dimension >
+    index_t TypedRasterImage< Pixel, dimension >::cell_index(
+        const CellIndices& index ) const
+    {
+        return impl_->cell_index( *this, index );
+    }
+
+    template < typename Pixel, index_t dimension >
+    auto TypedRasterImage< Pixel, dimension >::cell_indices(
+        index_t index ) const -> CellIndices
+    {
+        return impl_->cell_indices( *this, index );
+    }
+
+    template < typename Pixel, index_t dimension >
+    const Pixel& TypedRasterImage< Pixel, dimension >::value(
+        index_t index ) const
+    {
+        return impl_->value( index );
+    }
+
+    template < typename Pixel, index_t dimension >
+    void TypedRasterImage< Pixel, dimension >::set_value(
+        index_t index, Pixel value )
+    {
+        impl_->set_value( index, std::move( value ) );
+    }
+
+    template < typename Pixel, index_t dimension >
+    absl::Span< const Pixel >
+        TypedRasterImage< Pixel, dimension >::values() const
+    {
+        return impl_->values();
+    }
+
+    template < typename Pixel, index_t dimension >
+    absl::Span< Pixel >
+        TypedRasterImage< Pixel, dimension >::modifiable_values()
+    {
+        return impl_->modifiable_values();
+    }
+
+    template < typename Pixel, index_t dimension >
+    TypedRasterImage< Pixel, dimension >
+        TypedRasterImage< Pixel, dimension >::clone() const
+    {
+        TypedRasterImage< Pixel, dimension > image;
+        image.copy( *this );
+        image.impl_->copy_values( *impl_ );
+        return image;
+    }
+
+    template < typename Pixel, index_t dimension >
+    template < typename Archive >
+    void TypedRasterImage< Pixel, dimension >::serialize( Archive& archive )
+    {
+        archive.ext( *this,
+            Growable< Archive, TypedRasterImage >{
+                { []( Archive& a, TypedRasterImage& raster ) {
+                    a.ext( raster,
+                        bitsery::ext::BaseClass< CellArray< dimension > >{} );
+                    a.object( raster.impl_ );
+                } } } );
+    }
+
+    using Float3 = std::array< float, 3 >;
+
+#define TYPED_RASTER_IMAGE_INSTANTIATION( Pixel, dimension )                   \
+    template class opengeode_image_api TypedRasterImage< Pixel, dimension >;   \
+    template opengeode_image_api void                                          \
+        TypedRasterImage< Pixel, dimension >::serialize< Serializer >(         \
+            Serializer& );                                                     \
+    template opengeode_image_api void                                          \
+        TypedRasterImage< Pixel, dimension >::serialize< Deserializer >(       \
+            Deserializer& )
+
+    TYPED_RASTER_IMAGE_INSTANTIATION( std::uint8_t, 2 );
+    TYPED_RASTER_IMAGE_INSTANTIATION( std::uint8_t, 3 );
+    TYPED_RASTER_IMAGE_INSTANTIATION( std::uint16_t, 2 );
+    TYPED_RASTER_IMAGE_INSTANTIATION( std::uint16_t, 3 );
+    TYPED_RASTER_IMAGE_INSTANTIATION( float, 2 );
+    TYPED_RASTER_IMAGE_INSTANTIATION( float, 3 );
+    TYPED_RASTER_IMAGE_INSTANTIATION( double, 2 );
+    TYPED_RASTER_IMAGE_INSTANTIATION( double, 3 );
+    TYPED_RASTER_IMAGE_INSTANTIATION( Float3, 2 );
+    TYPED_RASTER_IMAGE_INSTANTIATION( Float3, 3 );
+} // namespace geode
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/image/io/typed_raster_image_input.hpp>
+
+#include <string_view>
+
+#include <absl/strings/str_cat.h>
+
+#include <geode/basic/detail/geode_input_impl.hpp>
+
+#include <geode/image/core/typed_raster_image.hpp>
+
+namespace geode
+{
+    template < typename Pixel, index_t dimension >
+    TypedRasterImage< Pixel, dimension > load_typed_raster_image(
+        std::string_view filename )
+    {
+        const auto type = absl::StrCat( "TypedRasterImage", dimension, "D" );
+        try
+        {
+            auto raster = detail::geode_object_input_impl<
+                TypedRasterImageInputFactory< Pixel, dimension > >(
+                type, filename );
+            Logger::info( type, " has: ", raster.nb_cells(), " cells" );
+            return raster;
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            throw OpenGeodeException{
+                "Cannot load TypedRasterImage from file: ", filename
+            };
+        }
+    }
+
+    template < typename Pixel, index_t dimension >
+    bool is_typed_raster_image_loadable( std::string_view filename )
+    {
+        const auto input = detail::geode_object_input_reader<
+            TypedRasterImageInputFactory< Pixel, dimension > >( filename );
+        return input->is_loadable();
+    }
+
+    using Float3 = std::array< float, 3 >;
+
+#define TYPED_RASTER_IMAGE_INPUT_INSTANTIATION( Pixel, dimension )             \
+    template opengeode_image_api TypedRasterImage< Pixel, dimension >          \
+        load_typed_raster_image< Pixel, dimension >( std::string_view );       \
+    template opengeode_image_api bool                                          \
+        is_typed_raster_image_loadable< Pixel, dimension >( std::string_view )
+
+    TYPED_RASTER_IMAGE_INPUT_INSTANTIATION( std::uint8_t, 2 );
+    TYPED_RASTER_IMAGE_INPUT_INSTANTIATION( std::uint8_t, 3 );
+    TYPED_RASTER_IMAGE_INPUT_INSTANTIATION( std::uint16_t, 2 );
+    TYPED_RASTER_IMAGE_INPUT_INSTANTIATION( std::uint16_t, 3 );
+    TYPED_RASTER_IMAGE_INPUT_INSTANTIATION( float, 2 );
+    TYPED_RASTER_IMAGE_INPUT_INSTANTIATION( float, 3 );
+    TYPED_RASTER_IMAGE_INPUT_INSTANTIATION( double, 2 );
+    TYPED_RASTER_IMAGE_INPUT_INSTANTIATION( double, 3 );
+    TYPED_RASTER_IMAGE_INPUT_INSTANTIATION( Float3, 2 );
+    TYPED_RASTER_IMAGE_INPUT_INSTANTIATION( Float3, 3 );
+} // namespace geode
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/image/io/typed_raster_image_output.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <absl/strings/str_cat.h>
+
+#include <geode/basic/detail/geode_output_impl.hpp>
+
+#include <geode/image/core/typed_raster_image.hpp>
+
+namespace geode
+{
+    template < typename Pixel, index_t dimension >
+    std::vector< std::string > save_typed_raster_image(
+        const TypedRasterImage< Pixel, dimension >& raster,
+        std::string_view filename )
+    {
+        const auto type = absl::StrCat( "TypedRasterImage", dimension, "D" );
+        try
+        {
+            return detail::geode_object_output_impl<
+                TypedRasterImageOutputFactory< Pixel, dimension > >(
+                type, raster, filename );
+        }
+        catch( const OpenGeodeException& e )
+        {
+            Logger::error( e.what() );
+            print_available_extensions<
+                TypedRasterImageOutputFactory< Pixel, dimension > >( type );
+            throw OpenGeodeException{
+                "Cannot save TypedRasterImage in file: ", filename
+            };
+        }
+    }
+
+    template < typename Pixel, index_t dimension >
+    bool is_typed_raster_image_saveable(
+        const TypedRasterImage< Pixel, dimension >& raster,
+        std::string_view filename )
+    {
+        const auto output = detail::geode_object_output_writer<
+            TypedRasterImageOutputFactory< Pixel, dimension > >( filename );
+        return output->is_saveable( raster );
+    }
+
+    using Float3 = std::array< float, 3 >;
+
+#define TYPED_RASTER_IMAGE_OUTPUT_INSTANTIATION( Pixel, dimension )            \
+    template opengeode_image_api std::vector< std::string >                    \
+        save_typed_raster_image< Pixel, dimension >(                           \
+            const TypedRasterImage< Pixel, dimension >&, std::string_view );   \
+    template opengeode_image_api bool                                          \
+        is_typed_raster_image_saveable< Pixel, dimension >(                    \
+            const TypedRasterImage< Pixel, dimension >&, std::string_view )
+
+    TYPED_RASTER_IMAGE_OUTPUT_INSTANTIATION( std::uint8_t, 2 );
+    TYPED_RASTER_IMAGE_OUTPUT_INSTANTIATION( std::uint8_t, 3 );
+    TYPED_RASTER_IMAGE_OUTPUT_INSTANTIATION( std::uint16_t, 2 );
+    TYPED_RASTER_IMAGE_OUTPUT_INSTANTIATION( std::uint16_t, 3 );
+    TYPED_RASTER_IMAGE_OUTPUT_INSTANTIATION( float, 2 );
+    TYPED_RASTER_IMAGE_OUTPUT_INSTANTIATION( float, 3 );
+    TYPED_RASTER_IMAGE_OUTPUT_INSTANTIATION( double, 2 );
+    TYPED_RASTER_IMAGE_OUTPUT_INSTANTIATION( double, 3 );
+    TYPED_RASTER_IMAGE_OUTPUT_INSTANTIATION( Float3, 2 );
+    TYPED_RASTER_IMAGE_OUTPUT_INSTANTIATION( Float3, 3 );
+} // namespace geode
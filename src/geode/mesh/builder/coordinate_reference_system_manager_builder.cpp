@@ -40,6 +40,7 @@ namespace geode
     void CoordinateReferenceSystemManagerBuilder<
         dimension >::delete_coordinate_reference_system( std::string_view name )
     {
+        notify_active_points_change( name );
         crs_manager_.delete_coordinate_reference_system( name, {} );
     }
 
@@ -48,6 +49,7 @@ namespace geode
         set_active_coordinate_reference_system( std::string_view name )
     {
         crs_manager_.set_active_coordinate_reference_system( name, {} );
+        notify_active_points_change( name );
     }
 
     template < index_t dimension >
@@ -55,6 +57,8 @@ namespace geode
         CoordinateReferenceSystemManagerBuilder<
             dimension >::active_coordinate_reference_system()
     {
+        notify_active_points_change(
+            crs_manager_.active_coordinate_reference_system_name() );
         return crs_manager_.modifiable_active_coordinate_reference_system( {} );
     }
 
@@ -63,9 +67,21 @@ namespace geode
         CoordinateReferenceSystemManagerBuilder<
             dimension >::coordinate_reference_system( std::string_view name )
     {
+        notify_active_points_change( name );
         return crs_manager_.modifiable_coordinate_reference_system( name, {} );
     }
 
+    template < index_t dimension >
+    void CoordinateReferenceSystemManagerBuilder<
+        dimension >::notify_active_points_change( std::string_view name )
+    {
+        if( active_points_hook_
+            && name == crs_manager_.active_coordinate_reference_system_name() )
+        {
+            active_points_hook_();
+        }
+    }
+
     template class opengeode_mesh_api
         CoordinateReferenceSystemManagerBuilder< 1 >;
     template class opengeode_mesh_api
@@ -23,21 +23,47 @@
 
 #include <geode/mesh/builder/coordinate_reference_system_managers_builder.hpp>
 
+#include <async++.h>
+
 #include <geode/geometry/point.hpp>
 
 #include <geode/mesh/builder/coordinate_reference_system_manager_builder.hpp>
+#include <geode/mesh/core/coordinate_reference_system.hpp>
 #include <geode/mesh/core/coordinate_reference_system_managers.hpp>
 
 namespace geode
 {
+    template < index_t dimension >
+    template < index_t crs_dimension >
+    CoordinateReferenceSystemManagerBuilder< crs_dimension >
+        CoordinateReferenceSystemManagersBuilder< dimension >::
+            coordinate_reference_system_manager_builder(
+                CoordinateReferenceSystemManager< crs_dimension >&
+                    crs_manager )
+    {
+        if constexpr( crs_dimension == dimension )
+        {
+            return CoordinateReferenceSystemManagerBuilder< crs_dimension >{
+                crs_manager, [this] {
+                    release_point_dependencies();
+                }
+            };
+        }
+        else
+        {
+            return CoordinateReferenceSystemManagerBuilder< crs_dimension >{
+                crs_manager
+            };
+        }
+    }
+
     template < index_t dimension >
     CoordinateReferenceSystemManagerBuilder1D
         CoordinateReferenceSystemManagersBuilder<
             dimension >::coordinate_reference_system_manager_builder1D()
     {
-        return CoordinateReferenceSystemManagerBuilder1D{
-            crs_managers_.coordinate_reference_system_manager1D( {} )
-        };
+        return coordinate_reference_system_manager_builder(
+            crs_managers_.coordinate_reference_system_manager1D( {} ) );
     }
 
     template < index_t dimension >
@@ -45,9 +71,8 @@ namespace geode
         CoordinateReferenceSystemManagersBuilder<
             dimension >::coordinate_reference_system_manager_builder2D()
     {
-        return CoordinateReferenceSystemManagerBuilder2D{
-            crs_managers_.coordinate_reference_system_manager2D( {} )
-        };
+        return coordinate_reference_system_manager_builder(
+            crs_managers_.coordinate_reference_system_manager2D( {} ) );
     }
 
     template < index_t dimension >
@@ -55,9 +80,8 @@ namespace geode
         CoordinateReferenceSystemManagersBuilder<
             dimension >::coordinate_reference_system_manager_builder3D()
     {
-        return CoordinateReferenceSystemManagerBuilder3D{
-            crs_managers_.coordinate_reference_system_manager3D( {} )
-        };
+        return coordinate_reference_system_manager_builder(
+            crs_managers_.coordinate_reference_system_manager3D( {} ) );
     }
 
     template < index_t dimension >
@@ -65,9 +89,8 @@ namespace geode
         CoordinateReferenceSystemManagersBuilder<
             dimension >::main_coordinate_reference_system_manager_builder()
     {
-        return CoordinateReferenceSystemManagerBuilder< dimension >{
-            crs_managers_.main_coordinate_reference_system_manager( {} )
-        };
+        return coordinate_reference_system_manager_builder(
+            crs_managers_.main_coordinate_reference_system_manager( {} ) );
     }
 
     template < index_t dimension >
@@ -75,6 +98,26 @@ namespace geode
         index_t vertex, Point< dimension > point )
     {
         crs_managers_.set_point( vertex, std::move( point ), {} );
+        reset_point_dependencies( vertex, 1 );
+    }
+
+    template < index_t dimension >
+    void CoordinateReferenceSystemManagersBuilder< dimension >::set_points(
+        index_t first_vertex, absl::Span< const Point< dimension > > points )
+    {
+        // Not through main_coordinate_reference_system_manager_builder:
+        // modified points are reset below
+        CoordinateReferenceSystemManagerBuilder< dimension > crs_builder{
+            crs_managers_.main_coordinate_reference_system_manager( {} )
+        };
+        auto& crs = crs_builder.active_coordinate_reference_system();
+        async::parallel_for( async::irange( index_t{ 0 },
+                                 static_cast< index_t >( points.size() ) ),
+            [&crs, &points, first_vertex]( index_t p ) {
+                crs.set_point( first_vertex + p, points[p] );
+            } );
+        reset_point_dependencies(
+            first_vertex, static_cast< index_t >( points.size() ) );
     }
 
     template class opengeode_mesh_api
@@ -57,6 +57,16 @@ namespace geode
         return added_vertex;
     }
 
+    template < index_t dimension >
+    index_t EdgedCurveBuilder< dimension >::create_points(
+        absl::Span< const Point< dimension > > points )
+    {
+        const auto first_vertex = edged_curve_.nb_vertices();
+        create_vertices( points.size() );
+        this->set_points( first_vertex, points );
+        return first_vertex;
+    }
+
     template < index_t dimension >
     void EdgedCurveBuilder< dimension >::copy(
         const EdgedCurve< dimension >& edged_curve )
@@ -102,6 +102,15 @@ namespace geode
         // Operation is directly handled by the AttributeManager
     }
 
+    template < index_t dimension >
+    void OpenGeodeTetrahedralSolidBuilder< dimension >::do_create_tetrahedra(
+        index_t first_tetrahedron,
+        absl::Span< const std::array< index_t, 4 > > tetrahedra )
+    {
+        geode_tetrahedral_solid_.add_tetrahedra(
+            first_tetrahedron, tetrahedra, {} );
+    }
+
     template < index_t dimension >
     void OpenGeodeTetrahedralSolidBuilder< dimension >::
         do_set_polyhedron_adjacent(
@@ -101,6 +101,15 @@ namespace geode
         // Operation is directly handled by the AttributeManager
     }
 
+    template < index_t dimension >
+    void OpenGeodeTriangulatedSurfaceBuilder< dimension >::do_create_triangles(
+        index_t first_triangle,
+        absl::Span< const std::array< index_t, 3 > > triangles )
+    {
+        geode_triangulated_surface_.add_triangles(
+            first_triangle, triangles, {} );
+    }
+
     template < index_t dimension >
     void OpenGeodeTriangulatedSurfaceBuilder<
         dimension >::do_set_polygon_adjacent( const PolygonEdge& polygon_edge,
@@ -56,6 +56,16 @@ namespace geode
         return added_vertex;
     }
 
+    template < index_t dimension >
+    index_t PointSetBuilder< dimension >::create_points(
+        absl::Span< const Point< dimension > > points )
+    {
+        const auto first_vertex = point_set_.nb_vertices();
+        create_vertices( points.size() );
+        this->set_points( first_vertex, points );
+        return first_vertex;
+    }
+
     template < index_t dimension >
     void PointSetBuilder< dimension >::copy(
         const PointSet< dimension >& point_set )
@@ -47,6 +47,13 @@ namespace geode
         return edges_->find_or_create_edge( std::move( edge_vertices ), {} );
     }
 
+    template < index_t dimension >
+    void SolidEdgesBuilder< dimension >::find_or_create_edges(
+        std::vector< std::array< index_t, 2 > > edges_vertices )
+    {
+        edges_->find_or_create_edges( std::move( edges_vertices ), {} );
+    }
+
     template < index_t dimension >
     void SolidEdgesBuilder< dimension >::remove_edge(
         std::array< index_t, 2 > edge_vertices )
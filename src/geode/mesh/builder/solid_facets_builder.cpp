@@ -45,6 +45,13 @@ namespace geode
         return facets_->find_or_create_facet( std::move( facet_vertices ), {} );
     }
 
+    template < index_t dimension >
+    void SolidFacetsBuilder< dimension >::find_or_create_facets(
+        std::vector< PolyhedronFacetVertices > facets_vertices )
+    {
+        facets_->find_or_create_facets( std::move( facets_vertices ), {} );
+    }
+
     template < index_t dimension >
     std::vector< index_t >
         SolidFacetsBuilder< dimension >::delete_isolated_facets()
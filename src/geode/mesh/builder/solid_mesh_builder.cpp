@@ -30,6 +30,7 @@
 #include <geode/mesh/builder/mesh_builder_factory.hpp>
 #include <geode/mesh/builder/solid_edges_builder.hpp>
 #include <geode/mesh/builder/solid_facets_builder.hpp>
+#include <geode/mesh/core/detail/facet_storage.hpp>
 #include <geode/mesh/core/detail/vertex_cycle.hpp>
 #include <geode/mesh/core/solid_edges.hpp>
 #include <geode/mesh/core/solid_facets.hpp>
@@ -399,6 +400,8 @@ namespace geode
                     solid_mesh_, *this, polyhedron_around, new_vertex_id );
             }
             update_polyhedron_vertex( polyhedron_around, new_vertex_id );
+            solid_mesh_.reset_polyhedron_geometry(
+                polyhedron_around.polyhedron_id, {} );
         }
         reset_polyhedra_around_vertex( old_vertex_id );
     }
@@ -441,6 +444,21 @@ namespace geode
                 solid_mesh_, *this, polyhedron_vertex, new_vertex_id );
         }
         update_polyhedron_vertex( polyhedron_vertex, new_vertex_id );
+        solid_mesh_.reset_polyhedron_geometry(
+            polyhedron_vertex.polyhedron_id, {} );
+    }
+
+    template < index_t dimension >
+    void SolidMeshBuilder< dimension >::reset_point_dependencies(
+        index_t first_vertex, index_t nb_vertices )
+    {
+        solid_mesh_.reset_vertices_geometry( first_vertex, nb_vertices, {} );
+    }
+
+    template < index_t dimension >
+    void SolidMeshBuilder< dimension >::release_point_dependencies()
+    {
+        solid_mesh_.disable_geometric_cache();
     }
 
     template < index_t dimension >
@@ -448,6 +466,7 @@ namespace geode
         absl::Span< const index_t > old2new )
     {
         check_no_polyhedron_to_delete( solid_mesh_, old2new );
+        solid_mesh_.reset_geometric_cache( {} );
         update_polyhedron_around_vertices_from_vertices(
             solid_mesh_, *this, old2new );
         for( const auto p : Range{ solid_mesh_.nb_polyhedra() } )
@@ -779,6 +798,16 @@ namespace geode
         return added_vertex;
     }
 
+    template < index_t dimension >
+    index_t SolidMeshBuilder< dimension >::create_points(
+        absl::Span< const Point< dimension > > points )
+    {
+        const auto first_vertex = solid_mesh_.nb_vertices();
+        create_vertices( points.size() );
+        this->set_points( first_vertex, points );
+        return first_vertex;
+    }
+
     template < index_t dimension >
     void SolidMeshBuilder< dimension >::update_polyhedron_info(
         index_t polyhedron_id, absl::Span< const index_t > vertices )
@@ -810,6 +839,41 @@ namespace geode
         }
     }
 
+    template < index_t dimension >
+    void SolidMeshBuilder< dimension >::update_polyhedra_info(
+        index_t first_polyhedron, index_t nb_polyhedra )
+    {
+        const auto end = first_polyhedron + nb_polyhedra;
+        for( const auto polyhedron_id : Range{ first_polyhedron, end } )
+        {
+            for( const auto v : LRange{
+                     solid_mesh_.nb_polyhedron_vertices( polyhedron_id ) } )
+            {
+                const PolyhedronVertex polyhedron_vertex{ polyhedron_id, v };
+                this->associate_polyhedron_vertex_to_vertex( polyhedron_vertex,
+                    solid_mesh_.polyhedron_vertex( polyhedron_vertex ) );
+            }
+        }
+        if( solid_mesh_.are_facets_enabled() )
+        {
+            this->facets_builder().find_or_create_facets(
+                detail::gather_element_facets< PolyhedronFacetVertices >(
+                    nb_polyhedra, [this, first_polyhedron]( index_t p ) {
+                        return solid_mesh_.polyhedron_facets_vertices(
+                            first_polyhedron + p );
+                    } ) );
+        }
+        if( solid_mesh_.are_edges_enabled() )
+        {
+            this->edges_builder().find_or_create_edges(
+                detail::gather_element_facets< std::array< index_t, 2 > >(
+                    nb_polyhedra, [this, first_polyhedron]( index_t p ) {
+                        return solid_mesh_.polyhedron_edges_vertices(
+                            first_polyhedron + p );
+                    } ) );
+        }
+    }
+
     template < index_t dimension >
     void SolidMeshBuilder< dimension >::update_polyhedron_adjacencies(
         absl::Span< const index_t > old2new )
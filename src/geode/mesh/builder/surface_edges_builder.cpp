@@ -92,6 +92,13 @@ namespace geode
         return edges_->find_or_create_edge( std::move( edge_vertices ), {} );
     }
 
+    template < index_t dimension >
+    void SurfaceEdgesBuilder< dimension >::find_or_create_edges(
+        std::vector< std::array< index_t, 2 > > edges_vertices )
+    {
+        edges_->find_or_create_edges( std::move( edges_vertices ), {} );
+    }
+
     template class opengeode_mesh_api SurfaceEdgesBuilder< 2 >;
     template class opengeode_mesh_api SurfaceEdgesBuilder< 3 >;
 } // namespace geode
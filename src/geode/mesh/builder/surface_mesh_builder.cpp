@@ -23,6 +23,8 @@
 
 #include <geode/mesh/builder/surface_mesh_builder.hpp>
 
+#include <async++.h>
+
 #include <geode/basic/attribute_manager.hpp>
 
 #include <geode/geometry/point.hpp>
@@ -364,6 +366,39 @@ namespace geode
         return added_polygon;
     }
 
+    template < index_t dimension >
+    index_t SurfaceMeshBuilder< dimension >::create_polygons(
+        absl::Span< const index_t > vertices,
+        absl::Span< const index_t > offsets )
+    {
+        if( offsets.size() < 2 )
+        {
+            return NO_ID;
+        }
+        const auto nb_vertices = surface_mesh_.nb_vertices();
+        for( const auto p : Range{ offsets.size() - 1 } )
+        {
+            const auto begin = offsets[p];
+            const auto end = offsets[p + 1];
+            OPENGEODE_EXCEPTION(
+                begin <= end && end - begin >= 3 && end <= vertices.size(),
+                "[SurfaceMeshBuilder::create_polygons] Invalid polygon ", p );
+            for( const auto v : Range{ begin, end } )
+            {
+                OPENGEODE_EXCEPTION( vertices[v] < nb_vertices,
+                    "[SurfaceMeshBuilder::create_polygons] Vertex ",
+                    vertices[v], " does not exist (nb=", nb_vertices, ")" );
+            }
+        }
+        const auto first_polygon = surface_mesh_.nb_polygons();
+        for( const auto p : Range{ offsets.size() - 1 } )
+        {
+            create_polygon(
+                vertices.subspan( offsets[p], offsets[p + 1] - offsets[p] ) );
+        }
+        return first_polygon;
+    }
+
     template < index_t dimension >
     void SurfaceMeshBuilder< dimension >::reset_polygons_around_vertex(
         index_t vertex_id )
@@ -412,6 +447,8 @@ namespace geode
                     old_vertex_id, new_vertex_id );
             }
             update_polygon_vertex( polygon_around, new_vertex_id );
+            surface_mesh_.reset_polygon_geometry(
+                polygon_around.polygon_id, {} );
         }
         reset_polygons_around_vertex( old_vertex_id );
     }
@@ -453,6 +490,20 @@ namespace geode
                 new_vertex_id );
         }
         update_polygon_vertex( polygon_vertex, new_vertex_id );
+        surface_mesh_.reset_polygon_geometry( polygon_vertex.polygon_id, {} );
+    }
+
+    template < index_t dimension >
+    void SurfaceMeshBuilder< dimension >::reset_point_dependencies(
+        index_t first_vertex, index_t nb_vertices )
+    {
+        surface_mesh_.reset_vertices_geometry( first_vertex, nb_vertices, {} );
+    }
+
+    template < index_t dimension >
+    void SurfaceMeshBuilder< dimension >::release_point_dependencies()
+    {
+        surface_mesh_.disable_geometric_cache();
     }
 
     template < index_t dimension >
@@ -460,6 +511,7 @@ namespace geode
         absl::Span< const index_t > old2new )
     {
         check_no_polygon_to_delete( surface_mesh_, old2new );
+        surface_mesh_.reset_geometric_cache( {} );
         update_polygon_around_vertices( surface_mesh_, *this, old2new );
         for( const auto p : Range{ surface_mesh_.nb_polygons() } )
         {
@@ -549,6 +601,64 @@ namespace geode
         do_unset_polygon_adjacent( polygon_edge );
     }
 
+    template < index_t dimension >
+    void SurfaceMeshBuilder< dimension >::reverse_polygons(
+        absl::Span< const index_t > polygons )
+    {
+        async::parallel_for( async::irange( size_t{ 0 }, polygons.size() ),
+            [this, &polygons]( size_t index ) {
+                const auto polygon_id = polygons[index];
+                check_polygon_id( surface_mesh_, polygon_id );
+                const auto nb_vertices =
+                    surface_mesh_.nb_polygon_vertices( polygon_id );
+                absl::FixedArray< index_t > vertices( nb_vertices );
+                absl::FixedArray< std::optional< index_t > > adjacents(
+                    nb_vertices );
+                for( const auto v : LRange{ nb_vertices } )
+                {
+                    vertices[v] = surface_mesh_.polygon_vertex(
+                        { polygon_id, v } );
+                    adjacents[v] =
+                        surface_mesh_.polygon_adjacent( { polygon_id, v } );
+                }
+                std::reverse( vertices.begin() + 1, vertices.end() );
+                absl::c_reverse( adjacents );
+                for( const auto v : LRange{ nb_vertices } )
+                {
+                    do_set_polygon_vertex( { polygon_id, v }, vertices[v] );
+                    if( adjacents[v] )
+                    {
+                        do_set_polygon_adjacent(
+                            { polygon_id, v }, adjacents[v].value() );
+                    }
+                    else
+                    {
+                        do_unset_polygon_adjacent( { polygon_id, v } );
+                    }
+                }
+                surface_mesh_.reset_polygon_geometry( polygon_id, {} );
+            } );
+        for( const auto polygon_id : polygons )
+        {
+            for( const auto v :
+                LRange{ surface_mesh_.nb_polygon_vertices( polygon_id ) } )
+            {
+                const PolygonVertex polygon_vertex{ polygon_id, v };
+                const auto vertex_id =
+                    surface_mesh_.polygon_vertex( polygon_vertex );
+                const auto polygon_around =
+                    surface_mesh_.polygon_around_vertex( vertex_id );
+                if( polygon_around
+                    && polygon_around->polygon_id == polygon_id )
+                {
+                    associate_polygon_vertex_to_vertex(
+                        polygon_vertex, vertex_id );
+                }
+                reset_polygons_around_vertex( vertex_id );
+            }
+        }
+    }
+
     template < index_t dimension >
     void SurfaceMeshBuilder< dimension >::compute_polygon_adjacencies()
     {
@@ -719,6 +829,16 @@ namespace geode
         return added_vertex;
     }
 
+    template < index_t dimension >
+    index_t SurfaceMeshBuilder< dimension >::create_points(
+        absl::Span< const Point< dimension > > points )
+    {
+        const auto first_vertex = surface_mesh_.nb_vertices();
+        create_vertices( points.size() );
+        this->set_points( first_vertex, points );
+        return first_vertex;
+    }
+
     template < geode::index_t dimension >
     void SurfaceMeshBuilder< dimension >::update_polygon_adjacencies(
         absl::Span< const geode::index_t > old2new )
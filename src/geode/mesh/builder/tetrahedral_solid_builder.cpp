@@ -66,6 +66,17 @@ namespace geode
         do_create_tetrahedron( tetrahedron_vertices );
     }
 
+    template < index_t dimension >
+    void TetrahedralSolidBuilder< dimension >::do_create_tetrahedra(
+        index_t /*first_tetrahedron*/,
+        absl::Span< const std::array< index_t, 4 > > tetrahedra )
+    {
+        for( const auto& tetrahedron : tetrahedra )
+        {
+            do_create_tetrahedron( tetrahedron );
+        }
+    }
+
     template < index_t dimension >
     index_t TetrahedralSolidBuilder< dimension >::create_tetrahedron(
         const std::array< index_t, 4 >& vertices )
@@ -107,6 +118,30 @@ namespace geode
         return added_tetra;
     }
 
+    template < index_t dimension >
+    index_t TetrahedralSolidBuilder< dimension >::create_tetrahedra(
+        absl::Span< const std::array< index_t, 4 > > tetrahedra )
+    {
+        const auto nb_vertices = tetrahedral_solid_.nb_vertices();
+        for( const auto& tetrahedron : tetrahedra )
+        {
+            for( const auto vertex : tetrahedron )
+            {
+                OPENGEODE_EXCEPTION( vertex < nb_vertices,
+                    "[TetrahedralSolidBuilder::create_tetrahedra] Vertex ",
+                    vertex, " does not exist (nb=", nb_vertices, ")" );
+            }
+        }
+        const auto added_tetra = tetrahedral_solid_.nb_polyhedra();
+        const auto nb_tetrahedra = static_cast< index_t >( tetrahedra.size() );
+        reserve_tetrahedra( nb_tetrahedra );
+        tetrahedral_solid_.polyhedron_attribute_manager().resize(
+            added_tetra + nb_tetrahedra );
+        do_create_tetrahedra( added_tetra, tetrahedra );
+        this->update_polyhedra_info( added_tetra, nb_tetrahedra );
+        return added_tetra;
+    }
+
     template < index_t dimension >
     void TetrahedralSolidBuilder< dimension >::copy(
         const TetrahedralSolid< dimension >& tetrahedral_solid )
@@ -29,6 +29,7 @@
 
 #include <geode/mesh/builder/mesh_builder_factory.hpp>
 #include <geode/mesh/builder/surface_edges_builder.hpp>
+#include <geode/mesh/core/detail/facet_storage.hpp>
 #include <geode/mesh/core/triangulated_surface.hpp>
 
 namespace geode
@@ -61,6 +62,17 @@ namespace geode
         do_create_triangle( triangle_vertices );
     }
 
+    template < index_t dimension >
+    void TriangulatedSurfaceBuilder< dimension >::do_create_triangles(
+        index_t /*first_triangle*/,
+        absl::Span< const std::array< index_t, 3 > > triangles )
+    {
+        for( const auto& triangle : triangles )
+        {
+            do_create_triangle( triangle );
+        }
+    }
+
     template < index_t dimension >
     index_t TriangulatedSurfaceBuilder< dimension >::create_triangle(
         const std::array< index_t, 3 >& vertices )
@@ -98,6 +110,50 @@ namespace geode
         return added_triangle;
     }
 
+    template < index_t dimension >
+    index_t TriangulatedSurfaceBuilder< dimension >::create_triangles(
+        absl::Span< const std::array< index_t, 3 > > triangles )
+    {
+        const auto nb_vertices = triangulated_surface_.nb_vertices();
+        for( const auto& triangle : triangles )
+        {
+            for( const auto vertex : triangle )
+            {
+                OPENGEODE_EXCEPTION( vertex < nb_vertices,
+                    "[TriangulatedSurfaceBuilder::create_triangles] Vertex ",
+                    vertex, " does not exist (nb=", nb_vertices, ")" );
+            }
+        }
+        const auto added_triangle = triangulated_surface_.nb_polygons();
+        const auto nb_triangles = static_cast< index_t >( triangles.size() );
+        triangulated_surface_.polygon_attribute_manager().resize(
+            added_triangle + nb_triangles );
+        do_create_triangles( added_triangle, triangles );
+        for( const auto t : Indices{ triangles } )
+        {
+            local_index_t vertex_id{ 0 };
+            for( const auto& vertex : triangles[t] )
+            {
+                this->associate_polygon_vertex_to_vertex(
+                    { added_triangle + t, vertex_id++ }, vertex );
+            }
+        }
+        if( triangulated_surface_.are_edges_enabled() )
+        {
+            this->edges_builder().find_or_create_edges(
+                detail::gather_element_facets< std::array< index_t, 2 > >(
+                    nb_triangles, [&triangles]( index_t t ) {
+                        const auto& vertices = triangles[t];
+                        return std::array< std::array< index_t, 2 >, 3 >{
+                            { { vertices[0], vertices[1] },
+                                { vertices[1], vertices[2] },
+                                { vertices[2], vertices[0] } }
+                        };
+                    } ) );
+        }
+        return added_triangle;
+    }
+
     template < index_t dimension >
     void TriangulatedSurfaceBuilder< dimension >::reserve_triangles(
         index_t nb )
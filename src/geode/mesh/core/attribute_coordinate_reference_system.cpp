@@ -115,6 +115,20 @@ namespace geode
         return impl_->nb_points();
     }
 
+    template < index_t dimension >
+    absl::Span< const Point< dimension > >
+        AttributeCoordinateReferenceSystem< dimension >::points() const
+    {
+        return impl_->points();
+    }
+
+    template < index_t dimension >
+    absl::Span< Point< dimension > >
+        AttributeCoordinateReferenceSystem< dimension >::modifiable_points()
+    {
+        return impl_->modifiable_points();
+    }
+
     template < index_t dimension >
     template < typename Archive >
     void AttributeCoordinateReferenceSystem< dimension >::serialize(
@@ -140,4 +154,4 @@ namespace geode
         opengeode_mesh_api, AttributeCoordinateReferenceSystem< 2 > );
     SERIALIZE_BITSERY_ARCHIVE(
         opengeode_mesh_api, AttributeCoordinateReferenceSystem< 3 > );
-} // namespace geode
\ No newline at end of file
+} // namespace geode
\ No newline at end of file
@@ -49,45 +49,6 @@ namespace
         geode::HybridSolid3D::Type::UNKNOWN,
         geode::HybridSolid3D::Type::HEXAHEDRON,
     };
-
-    template < typename Data >
-    geode::PolyhedronEdgesVertices polyhedron_edges_vertices(
-        const geode::HybridSolid3D& mesh,
-        geode::index_t polyhedron,
-        const Data& data )
-    {
-        geode::PolyhedronEdgesVertices result;
-        result.reserve( data.size() );
-        for( const auto& edge : data )
-        {
-            result.emplace_back( std::array< geode::index_t, 2 >{
-                mesh.polyhedron_vertex( { polyhedron, edge[0] } ),
-                mesh.polyhedron_vertex( { polyhedron, edge[1] } ) } );
-        }
-        return result;
-    }
-
-    template < typename Data >
-    geode::PolyhedronFacetsVertices polyhedron_facets_vertices(
-        const geode::HybridSolid3D& mesh,
-        geode::index_t polyhedron,
-        const Data& data )
-    {
-        geode::PolyhedronFacetsVertices result;
-        result.reserve( data.size() );
-        for( const auto& facet : data )
-        {
-            geode::PolyhedronFacetVertices facet_vertices;
-            facet_vertices.reserve( facet.size() );
-            for( const auto v : facet )
-            {
-                facet_vertices.push_back(
-                    mesh.polyhedron_vertex( { polyhedron, v } ) );
-            }
-            result.emplace_back( std::move( facet_vertices ) );
-        }
-        return result;
-    }
 } // namespace
 
 namespace geode
@@ -132,25 +93,9 @@ namespace geode
         local_index_t get_nb_polyhedron_facet_vertices(
             const PolyhedronFacet& polyhedron_facet ) const
         {
-            switch( polyhedron_type( polyhedron_facet.polyhedron_id ) )
-            {
-                case Type::TETRAHEDRON:
-                    return 3;
-                case Type::HEXAHEDRON:
-                    return 4;
-                case Type::PRISM:
-                    return detail::PRISM_FACET_VERTICES[polyhedron_facet
-                                                            .facet_id]
-                        .size();
-                case Type::PYRAMID:
-                    return detail::PYRAMID_FACET_VERTICES[polyhedron_facet
-                                                              .facet_id]
-                        .size();
-                case Type::UNKNOWN:
-                    throw OpenGeodeException(
-                        "[HybridSolid] Unknown polyhedron type" );
-            }
-            return 0;
+            const auto& table = element_table( polyhedron_facet.polyhedron_id );
+            return table.facet_ptr[polyhedron_facet.facet_id + 1]
+                   - table.facet_ptr[polyhedron_facet.facet_id];
         }
 
         std::optional< index_t > get_polyhedron_adjacent(
@@ -183,70 +128,31 @@ namespace geode
         PolyhedronVertex get_polyhedron_facet_vertex_id(
             const PolyhedronFacetVertex& polyhedron_facet_vertex ) const
         {
-            const auto polyhedron_id =
-                polyhedron_facet_vertex.polyhedron_facet.polyhedron_id;
-            const auto facet_id =
-                polyhedron_facet_vertex.polyhedron_facet.facet_id;
-            const auto vertex_id = polyhedron_facet_vertex.vertex_id;
-            switch( polyhedron_type( polyhedron_id ) )
-            {
-                case Type::TETRAHEDRON:
-                    return {
-                        polyhedron_id,
-                        detail::TETRAHEDRON_FACET_VERTICES[facet_id][vertex_id]
-                    };
-                case Type::HEXAHEDRON:
-                    return {
-                        polyhedron_id,
-                        detail::HEXAHEDRON_FACET_VERTICES[facet_id][vertex_id]
-                    };
-                case Type::PRISM:
-                    return { polyhedron_id,
-                        detail::PRISM_FACET_VERTICES[facet_id][vertex_id] };
-                case Type::PYRAMID:
-                    return { polyhedron_id,
-                        detail::PYRAMID_FACET_VERTICES[facet_id][vertex_id] };
-                case Type::UNKNOWN:
-                    throw OpenGeodeException(
-                        "[HybridSolid] Unknown polyhedron type" );
-            }
-            return {};
+            const auto& facet = polyhedron_facet_vertex.polyhedron_facet;
+            const auto& table = element_table( facet.polyhedron_id );
+            return { facet.polyhedron_id,
+                table.facet_vertices[table.facet_ptr[facet.facet_id]
+                                     + polyhedron_facet_vertex.vertex_id] };
         }
 
         void add_tetrahedron( const std::array< index_t, 4 >& vertices )
         {
-            add_vertices( vertices );
-            polyhedron_adjacent_ptr_.push_back(
-                polyhedron_adjacent_ptr_.back() + 4 );
-            polyhedron_adjacents_.resize(
-                polyhedron_adjacent_ptr_.back(), NO_ID );
+            add_polyhedron( vertices, Type::TETRAHEDRON );
         }
 
         void add_hexahedron( const std::array< index_t, 8 >& vertices )
         {
-            add_vertices( vertices );
-            polyhedron_adjacent_ptr_.push_back(
-                polyhedron_adjacent_ptr_.back() + 6 );
-            polyhedron_adjacents_.resize(
-                polyhedron_adjacent_ptr_.back(), NO_ID );
+            add_polyhedron( vertices, Type::HEXAHEDRON );
         }
 
         void add_prism( const std::array< index_t, 6 >& vertices )
         {
-            add_vertices( vertices );
-            polyhedron_adjacent_ptr_.push_back(
-                polyhedron_adjacent_ptr_.back() + 5 );
-            polyhedron_adjacents_.resize(
-                polyhedron_adjacent_ptr_.back(), NO_ID );
+            add_polyhedron( vertices, Type::PRISM );
         }
 
         void add_pyramid( const std::array< index_t, 5 >& vertices )
         {
-            add_vertices( vertices );
-            polyhedron_adjacent_ptr_.push_back(
-                polyhedron_adjacent_ptr_.back() + 5 );
-            polyhedron_adjacents_.resize(
-                polyhedron_adjacent_ptr_.back(), NO_ID );
+            add_polyhedron( vertices, Type::PYRAMID );
         }
 
         void remove_polyhedra( const std::vector< bool >& to_delete )
@@ -261,6 +167,7 @@ namespace geode
                     offset++;
                     continue;
                 }
+                polyhedron_types_[p - offset] = polyhedron_types_[p];
                 const auto nb_vertices = get_nb_polyhedron_vertices( p );
                 for( const auto v : LRange{ nb_vertices } )
                 {
@@ -291,59 +198,48 @@ namespace geode
             polyhedron_adjacents_.erase(
                 polyhedron_adjacents_.begin() + adjacent_index,
                 polyhedron_adjacents_.end() );
+            polyhedron_types_.erase(
+                polyhedron_types_.end() - offset, polyhedron_types_.end() );
         }
 
         PolyhedronEdgesVertices polyhedron_edges_vertices(
-            const HybridSolid< dimension >& solid, index_t polyhedron ) const
+            index_t polyhedron ) const
         {
-            switch( polyhedron_type( polyhedron ) )
+            const auto& table = element_table( polyhedron );
+            const auto* vertices =
+                &polyhedron_vertices_[starting_vertex_index( polyhedron )];
+            PolyhedronEdgesVertices result( table.nb_edges );
+            for( const auto e : LRange{ table.nb_edges } )
             {
-                case Type::TETRAHEDRON:
-                    return ::polyhedron_edges_vertices(
-                        solid, polyhedron, detail::TETRAHEDRON_EDGE_VERTICES );
-                case Type::HEXAHEDRON:
-                    return ::polyhedron_edges_vertices(
-                        solid, polyhedron, detail::HEXAHEDRON_EDGE_VERTICES );
-                case Type::PRISM:
-                    return ::polyhedron_edges_vertices(
-                        solid, polyhedron, detail::PRISM_EDGE_VERTICES );
-                case Type::PYRAMID:
-                    return ::polyhedron_edges_vertices(
-                        solid, polyhedron, detail::PYRAMID_EDGE_VERTICES );
-                case Type::UNKNOWN:
-                    throw OpenGeodeException(
-                        "[HybridSolid] Unknown polyhedron type" );
+                result[e] = { vertices[table.edge_vertices[e][0]],
+                    vertices[table.edge_vertices[e][1]] };
             }
-            return {};
+            return result;
         }
 
         PolyhedronFacetsVertices polyhedron_facets_vertices(
-            const HybridSolid< dimension >& solid, index_t polyhedron ) const
+            index_t polyhedron ) const
         {
-            switch( polyhedron_type( polyhedron ) )
+            const auto& table = element_table( polyhedron );
+            const auto* vertices =
+                &polyhedron_vertices_[starting_vertex_index( polyhedron )];
+            PolyhedronFacetsVertices result( table.nb_facets );
+            for( const auto f : LRange{ table.nb_facets } )
             {
-                case Type::TETRAHEDRON:
-                    return ::polyhedron_facets_vertices(
-                        solid, polyhedron, detail::TETRAHEDRON_FACET_VERTICES );
-                case Type::HEXAHEDRON:
-                    return ::polyhedron_facets_vertices(
-                        solid, polyhedron, detail::HEXAHEDRON_FACET_VERTICES );
-                case Type::PRISM:
-                    return ::polyhedron_facets_vertices(
-                        solid, polyhedron, detail::PRISM_FACET_VERTICES );
-                case Type::PYRAMID:
-                    return ::polyhedron_facets_vertices(
-                        solid, polyhedron, detail::PYRAMID_FACET_VERTICES );
-                case Type::UNKNOWN:
-                    throw OpenGeodeException(
-                        "[HybridSolid] Unknown polyhedron type" );
+                auto& facet_vertices = result[f];
+                for( const auto v :
+                    LRange{ table.facet_ptr[f], table.facet_ptr[f + 1] } )
+                {
+                    facet_vertices.push_back(
+                        vertices[table.facet_vertices[v]] );
+                }
             }
-            return {};
+            return result;
         }
 
         Type polyhedron_type( index_t polyhedron_id ) const
         {
-            return TYPES[get_nb_polyhedron_vertices( polyhedron_id )];
+            return polyhedron_types_[polyhedron_id];
         }
 
         void permute_polyhedra( absl::Span< const index_t > permutation )
@@ -362,6 +258,14 @@ namespace geode
             }
             polyhedron_vertices_ = std::move( new_polyhedron_vertices );
 
+            std::vector< Type > new_polyhedron_types;
+            new_polyhedron_types.reserve( polyhedron_types_.size() );
+            for( const auto old_p : permutation )
+            {
+                new_polyhedron_types.push_back( polyhedron_types_[old_p] );
+            }
+            polyhedron_types_ = std::move( new_polyhedron_types );
+
             std::vector< index_t > new_polyhedron_vertex_ptr;
             new_polyhedron_vertex_ptr.reserve( polyhedron_vertex_ptr_.size() );
             new_polyhedron_vertex_ptr.push_back( 0 );
@@ -409,6 +313,7 @@ namespace geode
             polyhedron_vertex_ptr_ = impl.polyhedron_vertex_ptr_;
             polyhedron_adjacents_ = impl.polyhedron_adjacents_;
             polyhedron_adjacent_ptr_ = impl.polyhedron_adjacent_ptr_;
+            polyhedron_types_ = impl.polyhedron_types_;
         }
 
     private:
@@ -418,26 +323,73 @@ namespace geode
         void serialize( Archive& archive )
         {
             archive.ext( *this,
-                Growable< Archive, Impl >{ { []( Archive& a, Impl& impl ) {
-                    a.container4b( impl.polyhedron_vertices_,
-                        impl.polyhedron_vertices_.max_size() );
-                    a.container4b( impl.polyhedron_vertex_ptr_,
-                        impl.polyhedron_vertex_ptr_.max_size() );
-                    a.container4b( impl.polyhedron_adjacents_,
-                        impl.polyhedron_adjacents_.max_size() );
-                    a.container4b( impl.polyhedron_adjacent_ptr_,
-                        impl.polyhedron_adjacent_ptr_.max_size() );
-                    a.ext( impl, bitsery::ext::BaseClass<
-                                     internal::PointsImpl< dimension > >{} );
-                } } } );
+                Growable< Archive, Impl >{
+                    { []( Archive& a, Impl& impl ) {
+                         a.container4b( impl.polyhedron_vertices_,
+                             impl.polyhedron_vertices_.max_size() );
+                         a.container4b( impl.polyhedron_vertex_ptr_,
+                             impl.polyhedron_vertex_ptr_.max_size() );
+                         a.container4b( impl.polyhedron_adjacents_,
+                             impl.polyhedron_adjacents_.max_size() );
+                         a.container4b( impl.polyhedron_adjacent_ptr_,
+                             impl.polyhedron_adjacent_ptr_.max_size() );
+                         a.ext( impl,
+                             bitsery::ext::BaseClass<
+                                 internal::PointsImpl< dimension > >{} );
+                         impl.compute_polyhedron_types();
+                     },
+                        []( Archive& a, Impl& impl ) {
+                            a.container4b( impl.polyhedron_vertices_,
+                                impl.polyhedron_vertices_.max_size() );
+                            a.container4b( impl.polyhedron_vertex_ptr_,
+                                impl.polyhedron_vertex_ptr_.max_size() );
+                            a.container4b( impl.polyhedron_adjacents_,
+                                impl.polyhedron_adjacents_.max_size() );
+                            a.container4b( impl.polyhedron_adjacent_ptr_,
+                                impl.polyhedron_adjacent_ptr_.max_size() );
+                            a.container1b( impl.polyhedron_types_,
+                                impl.polyhedron_types_.max_size() );
+                            a.ext( impl,
+                                bitsery::ext::BaseClass<
+                                    internal::PointsImpl< dimension > >{} );
+                        } } } );
         }
 
-        void add_vertices( absl::Span< const index_t > vertices )
+        void compute_polyhedron_types()
+        {
+            const auto nb_polyhedra = polyhedron_vertex_ptr_.size() - 1;
+            polyhedron_types_.resize( nb_polyhedra );
+            for( const auto p : Range{ nb_polyhedra } )
+            {
+                polyhedron_types_[p] = TYPES[get_nb_polyhedron_vertices( p )];
+            }
+        }
+
+        void add_polyhedron( absl::Span< const index_t > vertices, Type type )
         {
             polyhedron_vertices_.insert(
                 polyhedron_vertices_.end(), vertices.begin(), vertices.end() );
             polyhedron_vertex_ptr_.push_back(
                 polyhedron_vertex_ptr_.back() + vertices.size() );
+            polyhedron_types_.push_back( type );
+            polyhedron_adjacent_ptr_.push_back(
+                polyhedron_adjacent_ptr_.back()
+                + element_table( type ).nb_facets );
+            polyhedron_adjacents_.resize(
+                polyhedron_adjacent_ptr_.back(), NO_ID );
+        }
+
+        const detail::SolidElementTable& element_table(
+            index_t polyhedron ) const
+        {
+            return element_table( polyhedron_types_[polyhedron] );
+        }
+
+        static const detail::SolidElementTable& element_table( Type type )
+        {
+            OPENGEODE_EXCEPTION( type != Type::UNKNOWN,
+                "[HybridSolid] Unknown polyhedron type" );
+            return detail::SOLID_ELEMENT_TABLES[static_cast< index_t >( type )];
         }
 
         index_t get_polyhedron_adjacent_impl(
@@ -464,6 +416,8 @@ namespace geode
 
         std::vector< index_t > polyhedron_adjacents_;
         std::vector< index_t > polyhedron_adjacent_ptr_;
+
+        std::vector< Type > polyhedron_types_;
     }; // namespace geode
 
     template < index_t dimension >
@@ -600,7 +554,7 @@ namespace geode
         OpenGeodeHybridSolid< dimension >::polyhedron_edges_vertices(
             index_t polyhedron ) const
     {
-        return impl_->polyhedron_edges_vertices( *this, polyhedron );
+        return impl_->polyhedron_edges_vertices( polyhedron );
     }
 
     template < index_t dimension >
@@ -608,7 +562,7 @@ namespace geode
         OpenGeodeHybridSolid< dimension >::polyhedron_facets_vertices(
             index_t polyhedron ) const
     {
-        return impl_->polyhedron_facets_vertices( *this, polyhedron );
+        return impl_->polyhedron_facets_vertices( polyhedron );
     }
 
     template < index_t dimension >
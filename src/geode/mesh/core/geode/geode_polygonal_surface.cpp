@@ -49,6 +49,16 @@ namespace geode
             polygon_ptr_.emplace_back( 0 );
         }
 
+        absl::Span< const index_t > polygons_vertices() const
+        {
+            return polygon_vertices_;
+        }
+
+        absl::Span< const index_t > polygons_vertices_offsets() const
+        {
+            return polygon_ptr_;
+        }
+
         index_t get_polygon_vertex( const PolygonVertex& polygon_vertex ) const
         {
             return polygon_vertices_[starting_index( polygon_vertex.polygon_id )
@@ -241,6 +251,21 @@ namespace geode
         impl_->set_point( vertex_id, std::move( point ) );
     }
 
+    template < index_t dimension >
+    absl::Span< const index_t >
+        OpenGeodePolygonalSurface< dimension >::polygons_vertices() const
+    {
+        return impl_->polygons_vertices();
+    }
+
+    template < index_t dimension >
+    absl::Span< const index_t >
+        OpenGeodePolygonalSurface< dimension >::polygons_vertices_offsets()
+            const
+    {
+        return impl_->polygons_vertices_offsets();
+    }
+
     template < index_t dimension >
     index_t OpenGeodePolygonalSurface< dimension >::get_polygon_vertex(
         const PolygonVertex& polygon_vertex ) const
@@ -121,6 +121,54 @@ namespace geode
             return { polyhedron_id, vertex_id };
         }
 
+        PolyhedronEdgesVertices polyhedron_edges_vertices(
+            index_t polyhedron ) const
+        {
+            const auto* vertices =
+                &polyhedron_vertices_[starting_vertex_index( polyhedron )];
+            PolyhedronEdgesVertices result;
+            for( const auto facet_id :
+                Range{ starting_adjacent_index( polyhedron ),
+                    starting_adjacent_index( polyhedron + 1 ) } )
+            {
+                const auto begin = starting_facet_index( facet_id );
+                const auto end = starting_facet_index( facet_id + 1 );
+                for( const auto v : Range{ begin, end } )
+                {
+                    const auto next = v + 1 == end ? begin : v + 1;
+                    const auto v0 = vertices[polyhedron_facets_[v]];
+                    const auto v1 = vertices[polyhedron_facets_[next]];
+                    if( v0 < v1 )
+                    {
+                        result.push_back( { v0, v1 } );
+                    }
+                }
+            }
+            return result;
+        }
+
+        PolyhedronFacetsVertices polyhedron_facets_vertices(
+            index_t polyhedron ) const
+        {
+            const auto* vertices =
+                &polyhedron_vertices_[starting_vertex_index( polyhedron )];
+            const auto first_facet = starting_adjacent_index( polyhedron );
+            PolyhedronFacetsVertices result(
+                get_nb_polyhedron_facets( polyhedron ) );
+            for( const auto f : Indices{ result } )
+            {
+                auto& facet_vertices = result[f];
+                for( const auto v :
+                    Range{ starting_facet_index( first_facet + f ),
+                        starting_facet_index( first_facet + f + 1 ) } )
+                {
+                    facet_vertices.push_back(
+                        vertices[polyhedron_facets_[v]] );
+                }
+            }
+            return result;
+        }
+
         void add_polyhedron( absl::Span< const index_t > vertices,
             absl::Span< const std::vector< local_index_t > > facets )
         {
@@ -481,6 +529,22 @@ namespace geode
         return impl_->get_polyhedron_facet_vertex_id( polyhedron_facet_vertex );
     }
 
+    template < index_t dimension >
+    PolyhedronEdgesVertices
+        OpenGeodePolyhedralSolid< dimension >::polyhedron_edges_vertices(
+            index_t polyhedron ) const
+    {
+        return impl_->polyhedron_edges_vertices( polyhedron );
+    }
+
+    template < index_t dimension >
+    PolyhedronFacetsVertices
+        OpenGeodePolyhedralSolid< dimension >::polyhedron_facets_vertices(
+            index_t polyhedron ) const
+    {
+        return impl_->polyhedron_facets_vertices( polyhedron );
+    }
+
     template < index_t dimension >
     void OpenGeodePolyhedralSolid< dimension >::set_polyhedron_vertex(
         const PolyhedronVertex& polyhedron_vertex,
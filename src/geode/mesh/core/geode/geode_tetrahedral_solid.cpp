@@ -26,6 +26,8 @@
 #include <array>
 #include <fstream>
 
+#include <async++.h>
+
 #include <bitsery/brief_syntax/array.h>
 
 #include <geode/basic/attribute_manager.hpp>
@@ -65,6 +67,12 @@ namespace geode
         {
         }
 
+        absl::Span< const std::array< index_t, 4 > >
+            tetrahedra_vertices() const
+        {
+            return tetrahedron_vertices_->values();
+        }
+
         index_t get_polyhedron_vertex(
             const PolyhedronVertex& polyhedron_vertex ) const
         {
@@ -123,6 +131,18 @@ namespace geode
                 solid.nb_polyhedra() - 1, vertices );
         }
 
+        void add_tetrahedra( index_t first_tetrahedron,
+            absl::Span< const std::array< index_t, 4 > > tetrahedra )
+        {
+            async::parallel_for(
+                async::irange(
+                    index_t{ 0 }, static_cast< index_t >( tetrahedra.size() ) ),
+                [this, first_tetrahedron, &tetrahedra]( index_t t ) {
+                    tetrahedron_vertices_->set_value(
+                        first_tetrahedron + t, tetrahedra[t] );
+                } );
+        }
+
     private:
         Impl() = default;
 
@@ -173,6 +193,13 @@ namespace geode
         impl_->set_point( vertex_id, std::move( point ) );
     }
 
+    template < index_t dimension >
+    absl::Span< const std::array< index_t, 4 > >
+        OpenGeodeTetrahedralSolid< dimension >::tetrahedra_vertices() const
+    {
+        return impl_->tetrahedra_vertices();
+    }
+
     template < index_t dimension >
     index_t OpenGeodeTetrahedralSolid< dimension >::get_polyhedron_vertex(
         const PolyhedronVertex& polyhedron_vertex ) const
@@ -231,6 +258,15 @@ namespace geode
         impl_->add_tetrahedron( *this, vertices );
     }
 
+    template < index_t dimension >
+    void OpenGeodeTetrahedralSolid< dimension >::add_tetrahedra(
+        index_t first_tetrahedron,
+        absl::Span< const std::array< index_t, 4 > > tetrahedra,
+        OGTetrahedralSolidKey )
+    {
+        impl_->add_tetrahedra( first_tetrahedron, tetrahedra );
+    }
+
     template < index_t dimension >
     void OpenGeodeTetrahedralSolid< dimension >::set_polyhedron_adjacent(
         const PolyhedronFacet& polyhedron_facet,
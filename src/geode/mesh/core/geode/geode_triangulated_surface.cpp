@@ -26,6 +26,8 @@
 #include <array>
 #include <fstream>
 
+#include <async++.h>
+
 #include <bitsery/brief_syntax/array.h>
 
 #include <geode/basic/attribute_manager.hpp>
@@ -62,6 +64,11 @@ namespace geode
         {
         }
 
+        absl::Span< const std::array< index_t, 3 > > triangles_vertices() const
+        {
+            return triangle_vertices_->values();
+        }
+
         index_t get_polygon_vertex( const PolygonVertex& polygon_vertex ) const
         {
             return triangle_vertices_->value( polygon_vertex.polygon_id )
@@ -109,6 +116,18 @@ namespace geode
                 surface.nb_polygons() - 1, vertices );
         }
 
+        void add_triangles( index_t first_triangle,
+            absl::Span< const std::array< index_t, 3 > > triangles )
+        {
+            async::parallel_for(
+                async::irange(
+                    index_t{ 0 }, static_cast< index_t >( triangles.size() ) ),
+                [this, first_triangle, &triangles]( index_t t ) {
+                    triangle_vertices_->set_value(
+                        first_triangle + t, triangles[t] );
+                } );
+        }
+
     private:
         Impl() = default;
 
@@ -157,6 +176,13 @@ namespace geode
         impl_->set_point( vertex_id, std::move( point ) );
     }
 
+    template < index_t dimension >
+    absl::Span< const std::array< index_t, 3 > >
+        OpenGeodeTriangulatedSurface< dimension >::triangles_vertices() const
+    {
+        return impl_->triangles_vertices();
+    }
+
     template < index_t dimension >
     index_t OpenGeodeTriangulatedSurface< dimension >::get_polygon_vertex(
         const PolygonVertex& polygon_vertex ) const
@@ -209,6 +235,15 @@ namespace geode
         impl_->add_triangle( *this, vertices );
     }
 
+    template < index_t dimension >
+    void OpenGeodeTriangulatedSurface< dimension >::add_triangles(
+        index_t first_triangle,
+        absl::Span< const std::array< index_t, 3 > > triangles,
+        OGTriangulatedSurfaceKey )
+    {
+        impl_->add_triangles( first_triangle, triangles );
+    }
+
     template < index_t dimension >
     void OpenGeodeTriangulatedSurface< dimension >::set_polygon_adjacent(
         const PolygonEdge& polygon_edge,
@@ -67,13 +67,11 @@ namespace geode
         Impl() = default;
         Impl( const SolidMesh< dimension >& solid )
         {
-            for( const auto p : Range{ solid.nb_polyhedra() } )
-            {
-                for( auto&& e : solid.polyhedron_edges_vertices( p ) )
-                {
-                    this->find_or_create_edge( std::move( e ) );
-                }
-            }
+            this->find_or_create_edges(
+                detail::gather_element_facets< std::array< index_t, 2 > >(
+                    solid.nb_polyhedra(), [&solid]( index_t p ) {
+                        return solid.polyhedron_edges_vertices( p );
+                    } ) );
         }
 
     private:
@@ -117,6 +115,13 @@ namespace geode
         return impl_->find_or_create_edge( std::move( edge_vertices ) );
     }
 
+    template < index_t dimension >
+    void SolidEdges< dimension >::find_or_create_edges(
+        std::vector< std::array< index_t, 2 > > edges_vertices, SolidEdgesKey )
+    {
+        impl_->find_or_create_edges( std::move( edges_vertices ) );
+    }
+
     template < index_t dimension >
     const std::array< index_t, 2 >& SolidEdges< dimension >::edge_vertices(
         index_t edge_id ) const
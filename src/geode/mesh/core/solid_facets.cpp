@@ -71,13 +71,11 @@ namespace geode
         Impl() = default;
         Impl( const SolidMesh< dimension >& solid )
         {
-            for( const auto p : Range{ solid.nb_polyhedra() } )
-            {
-                for( auto&& f : solid.polyhedron_facets_vertices( p ) )
-                {
-                    this->find_or_create_facet( std::move( f ) );
-                }
-            }
+            this->add_facets(
+                detail::gather_element_facets< PolyhedronFacetVertices >(
+                    solid.nb_polyhedra(), [&solid]( index_t p ) {
+                        return solid.polyhedron_facets_vertices( p );
+                    } ) );
         }
 
         std::optional< index_t > find_facet(
@@ -92,6 +90,12 @@ namespace geode
                 FacetsVertexCycle{ std::move( facet_vertices ) } );
         }
 
+        void find_or_create_facets(
+            std::vector< PolyhedronFacetVertices > facets_vertices )
+        {
+            this->add_facets( std::move( facets_vertices ) );
+        }
+
         const PolyhedronFacetVertices& get_facet_vertices(
             const index_t facet_id ) const
         {
@@ -186,6 +190,13 @@ namespace geode
         return impl_->find_or_create_facet( std::move( facet_vertices ) );
     }
 
+    template < index_t dimension >
+    void SolidFacets< dimension >::find_or_create_facets(
+        std::vector< PolyhedronFacetVertices > facets_vertices, SolidFacetsKey )
+    {
+        impl_->find_or_create_facets( std::move( facets_vertices ) );
+    }
+
     template < index_t dimension >
     const PolyhedronFacetVertices& SolidFacets< dimension >::facet_vertices(
         index_t facet_id ) const
@@ -50,7 +50,9 @@
 #include <geode/mesh/builder/triangulated_surface_builder.hpp>
 #include <geode/mesh/core/bitsery_archive.hpp>
 #include <geode/mesh/core/detail/vertex_cycle.hpp>
+#include <geode/mesh/core/internal/geometric_cache.hpp>
 #include <geode/mesh/core/internal/solid_mesh_impl.hpp>
+#include <geode/mesh/core/mesh_element_ranges.hpp>
 #include <geode/mesh/core/mesh_factory.hpp>
 #include <geode/mesh/core/polyhedral_solid.hpp>
 #include <geode/mesh/core/solid_edges.hpp>
@@ -315,6 +317,113 @@ namespace
         }
         return std::nullopt;
     }
+
+    template < geode::index_t dimension >
+    geode::Point< dimension > compute_polyhedron_barycenter(
+        const geode::SolidMesh< dimension >& mesh,
+        const geode::index_t polyhedron_id )
+    {
+        geode::Point< dimension > barycenter;
+        for( const auto vertex_id :
+            geode::PolyhedronVerticesRange{ mesh, polyhedron_id } )
+        {
+            barycenter = barycenter + mesh.point( vertex_id );
+        }
+        return barycenter / mesh.nb_polyhedron_vertices( polyhedron_id );
+    }
+
+    template < geode::index_t dimension >
+    double compute_polyhedron_volume( const geode::SolidMesh< dimension >& mesh,
+        const geode::index_t polyhedron_id )
+    {
+        if( mesh.nb_polyhedron_vertices( polyhedron_id ) < 4 )
+        {
+            return 0;
+        }
+        double volume{ 0 };
+        const auto first_pt_index =
+            mesh.polyhedron_vertex( { polyhedron_id, 0 } );
+        const auto& p0 = mesh.point( first_pt_index );
+        const auto facets_vertices =
+            mesh.polyhedron_facets_vertices( polyhedron_id );
+        for( const auto facet_id : geode::LIndices{ facets_vertices } )
+        {
+            const auto& facet_vertices = facets_vertices[facet_id];
+            if( absl::c_any_of( facet_vertices,
+                    [first_pt_index]( geode::index_t vertex_id ) {
+                        return vertex_id == first_pt_index;
+                    } ) )
+            {
+                continue;
+            }
+            for( const auto i : geode::LRange{ 2, facet_vertices.size() } )
+            {
+                const auto& p1 = mesh.point( facet_vertices[i - 2] );
+                const auto& p2 = mesh.point( facet_vertices[i - 1] );
+                const auto& p3 = mesh.point( facet_vertices[i] );
+                volume +=
+                    geode::tetrahedron_signed_volume( { p1, p2, p3, p0 } );
+            }
+        }
+        return volume;
+    }
+
+    template < geode::index_t dimension >
+    std::optional< geode::Vector3D > compute_polyhedron_facet_normal(
+        const geode::SolidMesh< dimension >& mesh,
+        const geode::PolyhedronFacet& polyhedron_facet )
+    {
+        geode::Vector3D normal;
+        const auto facet_vertices =
+            mesh.polyhedron_facet_vertices( polyhedron_facet );
+        const auto& p0 = mesh.point( facet_vertices[0] );
+        for( const auto v : geode::LRange{ 2,
+                 mesh.nb_polyhedron_facet_vertices( polyhedron_facet ) } )
+        {
+            const auto& p1 = mesh.point( facet_vertices[v - 1] );
+            const auto& p2 = mesh.point( facet_vertices[v] );
+            if( const auto triangle_normal =
+                    geode::Triangle3D{ p0, p1, p2 }.normal() )
+            {
+                normal += triangle_normal.value();
+            }
+        }
+        try
+        {
+            return normal.normalize();
+        }
+        catch( const geode::OpenGeodeException& /*unused*/ )
+        {
+            return std::nullopt;
+        }
+    }
+
+    template < geode::index_t dimension >
+    geode::internal::PolyhedronGeometryImpl< dimension >
+        compute_polyhedron_geometry( const geode::SolidMesh< dimension >& mesh,
+            const geode::index_t polyhedron_id )
+    {
+        geode::internal::PolyhedronGeometryImpl< dimension > geometry;
+        geometry.barycenter =
+            compute_polyhedron_barycenter( mesh, polyhedron_id );
+        geometry.volume = compute_polyhedron_volume( mesh, polyhedron_id );
+        for( const auto f :
+            geode::LRange{ mesh.nb_polyhedron_facets( polyhedron_id ) } )
+        {
+            geometry.facet_normals.push_back(
+                compute_polyhedron_facet_normal( mesh, { polyhedron_id, f } )
+                    .value_or( geode::Vector3D{} ) );
+        }
+        geode::BoundingBox< dimension > box;
+        for( const auto vertex_id :
+            geode::PolyhedronVerticesRange{ mesh, polyhedron_id } )
+        {
+            box.add_point( mesh.point( vertex_id ) );
+        }
+        geometry.bounding_box_min = box.min();
+        geometry.bounding_box_max = box.max();
+        return geometry;
+    }
 } // namespace
 
 namespace geode
@@ -501,6 +610,60 @@ namespace geode
                 vertex_id, polyhedron_vertex );
         }
 
+        bool is_geometric_cache_enabled() const
+        {
+            return geometric_cache_.is_enabled();
+        }
+
+        void enable_geometric_cache( const SolidMesh< dimension >& solid ) const
+        {
+            geometric_cache_.enable(
+                solid.nb_polyhedra(), solid.nb_vertices(),
+                [&solid]( const index_t polyhedron_id ) {
+                    return solid.polyhedron_vertices( polyhedron_id );
+                },
+                [&solid]( const index_t polyhedron_id ) {
+                    return compute_polyhedron_geometry( solid, polyhedron_id );
+                } );
+        }
+
+        void disable_geometric_cache() const
+        {
+            geometric_cache_.disable();
+        }
+
+        void reset_polyhedron_geometry( index_t polyhedron_id )
+        {
+            geometric_cache_.reset_element( polyhedron_id );
+        }
+
+        void reset_vertices_geometry(
+            index_t first_vertex, index_t nb_vertices )
+        {
+            geometric_cache_.reset_vertices( first_vertex, nb_vertices );
+        }
+
+        void reset_geometric_cache()
+        {
+            geometric_cache_.reset();
+        }
+
+        /*!
+         * Return nullptr if the cache is disabled or outdated for the
+         * polyhedron
+         */
+        const internal::PolyhedronGeometryImpl< dimension >*
+            polyhedron_geometry( const SolidMesh< dimension >& solid,
+                const index_t polyhedron_id ) const
+        {
+            if( !geometric_cache_.is_enabled() )
+            {
+                return nullptr;
+            }
+            return geometric_cache_.geometry(
+                polyhedron_id, solid.polyhedron_vertices( polyhedron_id ) );
+        }
+
         AttributeManager& polyhedron_attribute_manager() const
         {
             return polyhedron_attribute_manager_;
@@ -673,6 +836,10 @@ namespace geode
         mutable std::unique_ptr< SolidEdges< dimension > > edges_;
         mutable std::unique_ptr< SolidFacets< dimension > > facets_;
         mutable TextureStorage3D texture_storage_;
+        mutable internal::GeometricCache<
+            internal::PolyhedronGeometryImpl< dimension >,
+            PolyhedronVertices >
+            geometric_cache_;
     };
 
     template < index_t dimension >
@@ -755,14 +922,12 @@ namespace geode
     Point< dimension > SolidMesh< dimension >::polyhedron_barycenter(
         index_t polyhedron_id ) const
     {
-        Point< dimension > barycenter;
-        for( const auto v : LRange{ nb_polyhedron_vertices( polyhedron_id ) } )
+        if( const auto* geometry =
+                impl_->polyhedron_geometry( *this, polyhedron_id ) )
         {
-            barycenter =
-                barycenter
-                + this->point( polyhedron_vertex( { polyhedron_id, v } ) );
+            return geometry->barycenter;
         }
-        return barycenter / nb_polyhedron_vertices( polyhedron_id );
+        return compute_polyhedron_barycenter( *this, polyhedron_id );
     }
 
     template < index_t dimension >
@@ -811,34 +976,31 @@ namespace geode
     double SolidMesh< dimension >::polyhedron_volume(
         index_t polyhedron_id ) const
     {
-        if( nb_polyhedron_vertices( polyhedron_id ) < 4 )
+        if( const auto* geometry =
+                impl_->polyhedron_geometry( *this, polyhedron_id ) )
         {
-            return 0;
+            return geometry->volume;
         }
-        double volume{ 0 };
-        const auto first_pt_index = polyhedron_vertex( { polyhedron_id, 0 } );
-        const auto& p0 = this->point( first_pt_index );
-        const auto facets_vertices =
-            polyhedron_facets_vertices( polyhedron_id );
-        for( const auto facet_id : LIndices{ facets_vertices } )
+        return compute_polyhedron_volume( *this, polyhedron_id );
+    }
+
+    template < index_t dimension >
+    BoundingBox< dimension > SolidMesh< dimension >::polyhedron_bounding_box(
+        index_t polyhedron_id ) const
+    {
+        check_polyhedron_id( *this, polyhedron_id );
+        if( const auto* geometry =
+                impl_->polyhedron_geometry( *this, polyhedron_id ) )
         {
-            const auto& facet_vertices = facets_vertices[facet_id];
-            if( absl::c_any_of(
-                    facet_vertices, [first_pt_index]( index_t vertex_id ) {
-                        return vertex_id == first_pt_index;
-                    } ) )
-            {
-                continue;
-            }
-            for( const auto i : LRange{ 2, facet_vertices.size() } )
-            {
-                const auto& p1 = this->point( facet_vertices[i - 2] );
-                const auto& p2 = this->point( facet_vertices[i - 1] );
-                const auto& p3 = this->point( facet_vertices[i] );
-                volume += tetrahedron_signed_volume( { p1, p2, p3, p0 } );
-            }
+            return { geometry->bounding_box_min, geometry->bounding_box_max };
         }
-        return volume;
+        BoundingBox< dimension > box;
+        for( const auto vertex_id :
+            PolyhedronVerticesRange{ *this, polyhedron_id } )
+        {
+            box.add_point( this->point( vertex_id ) );
+        }
+        return box;
     }
 
     template < index_t dimension >
@@ -869,28 +1031,19 @@ namespace geode
     {
         check_polyhedron_facet_id(
             *this, polyhedron_facet.polyhedron_id, polyhedron_facet.facet_id );
-        Vector3D normal;
-        const auto facet_vertices =
-            polyhedron_facet_vertices( polyhedron_facet );
-        const auto& p0 = this->point( facet_vertices[0] );
-        for( const auto v :
-            LRange{ 2, nb_polyhedron_facet_vertices( polyhedron_facet ) } )
+        if( const auto* geometry =
+                impl_->polyhedron_geometry(
+                    *this, polyhedron_facet.polyhedron_id ) )
         {
-            const auto& p1 = this->point( facet_vertices[v - 1] );
-            const auto& p2 = this->point( facet_vertices[v] );
-            if( const auto triangle_normal = Triangle3D{ p0, p1, p2 }.normal() )
+            const auto& normal =
+                geometry->facet_normals[polyhedron_facet.facet_id];
+            if( normal == Vector3D{} )
             {
-                normal += triangle_normal.value();
+                return std::nullopt;
             }
+            return normal;
         }
-        try
-        {
-            return normal.normalize();
-        }
-        catch( const OpenGeodeException& /*unused*/ )
-        {
-            return std::nullopt;
-        }
+        return compute_polyhedron_facet_normal( *this, polyhedron_facet );
     }
 
     template < index_t dimension >
@@ -1325,6 +1478,26 @@ namespace geode
         impl_->reset_polyhedra_around_vertex( vertex_id );
     }
 
+    template < index_t dimension >
+    void SolidMesh< dimension >::reset_polyhedron_geometry(
+        index_t polyhedron_id, SolidMeshKey )
+    {
+        impl_->reset_polyhedron_geometry( polyhedron_id );
+    }
+
+    template < index_t dimension >
+    void SolidMesh< dimension >::reset_vertices_geometry(
+        index_t first_vertex, index_t nb_vertices, SolidMeshKey )
+    {
+        impl_->reset_vertices_geometry( first_vertex, nb_vertices );
+    }
+
+    template < index_t dimension >
+    void SolidMesh< dimension >::reset_geometric_cache( SolidMeshKey )
+    {
+        impl_->reset_geometric_cache();
+    }
+
     template < index_t dimension >
     local_index_t SolidMesh< dimension >::nb_polyhedron_vertices(
         index_t polyhedron_id ) const
@@ -1578,6 +1751,24 @@ namespace geode
         impl_->disable_facets();
     }
 
+    template < index_t dimension >
+    bool SolidMesh< dimension >::is_geometric_cache_enabled() const
+    {
+        return impl_->is_geometric_cache_enabled();
+    }
+
+    template < index_t dimension >
+    void SolidMesh< dimension >::enable_geometric_cache() const
+    {
+        impl_->enable_geometric_cache( *this );
+    }
+
+    template < index_t dimension >
+    void SolidMesh< dimension >::disable_geometric_cache() const
+    {
+        impl_->disable_geometric_cache();
+    }
+
     template < index_t dimension >
     const SolidFacets< dimension >& SolidMesh< dimension >::facets() const
     {
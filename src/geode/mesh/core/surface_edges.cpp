@@ -26,6 +26,8 @@
 #include <algorithm>
 #include <stack>
 
+#include <absl/container/inlined_vector.h>
+
 #include <bitsery/brief_syntax/array.h>
 
 #include <geode/basic/attribute_manager.hpp>
@@ -66,14 +68,19 @@ namespace geode
         Impl() = default;
         Impl( const SurfaceMesh< dimension >& surface )
         {
-            for( const auto p : Range{ surface.nb_polygons() } )
-            {
-                for( const auto e : LRange{ surface.nb_polygon_edges( p ) } )
-                {
-                    this->find_or_create_edge(
-                        surface.polygon_edge_vertices( { p, e } ) );
-                }
-            }
+            this->find_or_create_edges(
+                detail::gather_element_facets< std::array< index_t, 2 > >(
+                    surface.nb_polygons(), [&surface]( index_t p ) {
+                        absl::InlinedVector< std::array< index_t, 2 >, 4 >
+                            edges;
+                        for( const auto e :
+                            LRange{ surface.nb_polygon_edges( p ) } )
+                        {
+                            edges.emplace_back(
+                                surface.polygon_edge_vertices( { p, e } ) );
+                        }
+                        return edges;
+                    } ) );
         }
 
     private:
@@ -111,6 +118,14 @@ namespace geode
         return impl_->find_or_create_edge( std::move( edge_vertices ) );
     }
 
+    template < index_t dimension >
+    void SurfaceEdges< dimension >::find_or_create_edges(
+        std::vector< std::array< index_t, 2 > > edges_vertices,
+        SurfaceEdgesKey )
+    {
+        impl_->find_or_create_edges( std::move( edges_vertices ) );
+    }
+
     template < index_t dimension >
     const std::array< index_t, 2 >& SurfaceEdges< dimension >::edge_vertices(
         index_t edge_id ) const
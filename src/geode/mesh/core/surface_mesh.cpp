@@ -47,7 +47,9 @@
 #include <geode/mesh/builder/surface_mesh_builder.hpp>
 #include <geode/mesh/builder/triangulated_surface_builder.hpp>
 #include <geode/mesh/core/detail/facet_storage.hpp>
+#include <geode/mesh/core/internal/geometric_cache.hpp>
 #include <geode/mesh/core/internal/surface_mesh_impl.hpp>
+#include <geode/mesh/core/mesh_element_ranges.hpp>
 #include <geode/mesh/core/mesh_factory.hpp>
 #include <geode/mesh/core/polygonal_surface.hpp>
 #include <geode/mesh/core/surface_edges.hpp>
@@ -212,6 +214,96 @@ namespace
             "adjacencies." );
         return result;
     }
+
+    template < geode::index_t dimension >
+    geode::Point< dimension > compute_polygon_barycenter(
+        const geode::SurfaceMesh< dimension >& mesh,
+        const geode::index_t polygon_id )
+    {
+        geode::Point< dimension > barycenter;
+        for( const auto vertex_id :
+            geode::PolygonVerticesRange{ mesh, polygon_id } )
+        {
+            barycenter = barycenter + mesh.point( vertex_id );
+        }
+        return barycenter / mesh.nb_polygon_vertices( polygon_id );
+    }
+
+    std::optional< geode::Vector3D > compute_polygon_normal(
+        const geode::SurfaceMesh2D& /*unused*/,
+        const geode::index_t /*unused*/ )
+    {
+        return std::nullopt;
+    }
+
+    std::optional< geode::Vector3D > compute_polygon_normal(
+        const geode::SurfaceMesh3D& mesh, const geode::index_t polygon_id )
+    {
+        return mesh.polygon( polygon_id ).normal();
+    }
+
+    double compute_polygon_area(
+        const geode::SurfaceMesh2D& mesh, const geode::index_t polygon_id )
+    {
+        if( mesh.nb_polygon_vertices( polygon_id ) < 3 )
+        {
+            return 0;
+        }
+        double area{ 0 };
+        const auto vertices = mesh.polygon_vertices( polygon_id );
+        const auto& p1 = mesh.point( vertices[0] );
+        for( const auto i : geode::LRange{ 1, vertices.size() - 1 } )
+        {
+            const auto& p2 = mesh.point( vertices[i] );
+            const auto& p3 = mesh.point( vertices[i + 1] );
+            area += geode::triangle_signed_area( { p1, p2, p3 } );
+        }
+        return area;
+    }
+
+    double compute_polygon_area(
+        const geode::SurfaceMesh3D& mesh, const geode::index_t polygon_id )
+    {
+        if( mesh.nb_polygon_vertices( polygon_id ) < 3 )
+        {
+            return 0;
+        }
+        double area{ 0 };
+        const auto direction = compute_polygon_normal( mesh, polygon_id )
+                                   .value_or( geode::Vector3D{ { 0, 0, 1 } } );
+        const auto vertices = mesh.polygon_vertices( polygon_id );
+        const auto& p1 = mesh.point( vertices[0] );
+        for( const auto i : geode::LRange{ 1, vertices.size() - 1 } )
+        {
+            const auto& p2 = mesh.point( vertices[i] );
+            const auto& p3 = mesh.point( vertices[i + 1] );
+            area += geode::triangle_signed_area( { p1, p2, p3 }, direction );
+        }
+        return area;
+    }
+
+    template < geode::index_t dimension >
+    geode::internal::PolygonGeometryImpl< dimension >
+        compute_polygon_geometry( const geode::SurfaceMesh< dimension >& mesh,
+            const geode::index_t polygon_id )
+    {
+        geode::internal::PolygonGeometryImpl< dimension > geometry;
+        geometry.barycenter = compute_polygon_barycenter( mesh, polygon_id );
+        geometry.area = compute_polygon_area( mesh, polygon_id );
+        if( const auto normal = compute_polygon_normal( mesh, polygon_id ) )
+        {
+            geometry.normal = normal.value();
+        }
+        geode::BoundingBox< dimension > box;
+        for( const auto vertex_id :
+            geode::PolygonVerticesRange{ mesh, polygon_id } )
+        {
+            box.add_point( mesh.point( vertex_id ) );
+        }
+        geometry.bounding_box_min = box.min();
+        geometry.bounding_box_max = box.max();
+        return geometry;
+    }
 } // namespace
 
 namespace geode
@@ -398,6 +490,60 @@ namespace geode
             return *edges_;
         }
 
+        bool is_geometric_cache_enabled() const
+        {
+            return geometric_cache_.is_enabled();
+        }
+
+        void enable_geometric_cache(
+            const SurfaceMesh< dimension >& surface ) const
+        {
+            geometric_cache_.enable(
+                surface.nb_polygons(), surface.nb_vertices(),
+                [&surface]( const index_t polygon_id ) {
+                    return surface.polygon_vertices( polygon_id );
+                },
+                [&surface]( const index_t polygon_id ) {
+                    return compute_polygon_geometry( surface, polygon_id );
+                } );
+        }
+
+        void disable_geometric_cache() const
+        {
+            geometric_cache_.disable();
+        }
+
+        void reset_polygon_geometry( index_t polygon_id )
+        {
+            geometric_cache_.reset_element( polygon_id );
+        }
+
+        void reset_vertices_geometry(
+            index_t first_vertex, index_t nb_vertices )
+        {
+            geometric_cache_.reset_vertices( first_vertex, nb_vertices );
+        }
+
+        void reset_geometric_cache()
+        {
+            geometric_cache_.reset();
+        }
+
+        /*!
+         * Return nullptr if the cache is disabled or outdated for the polygon
+         */
+        const internal::PolygonGeometryImpl< dimension >* polygon_geometry(
+            const SurfaceMesh< dimension >& surface,
+            const index_t polygon_id ) const
+        {
+            if( !geometric_cache_.is_enabled() )
+            {
+                return nullptr;
+            }
+            return geometric_cache_.geometry(
+                polygon_id, surface.polygon_vertices( polygon_id ) );
+        }
+
         AttributeManager& polygon_attribute_manager() const
         {
             return polygon_attribute_manager_;
@@ -478,6 +624,10 @@ namespace geode
             polygons_around_vertex_;
         mutable std::unique_ptr< SurfaceEdges< dimension > > edges_;
         mutable TextureStorage2D texture_storage_;
+        mutable internal::GeometricCache<
+            internal::PolygonGeometryImpl< dimension >,
+            PolygonVertices >
+            geometric_cache_;
     };
 
     template < index_t dimension >
@@ -854,13 +1004,12 @@ namespace geode
     Point< dimension > SurfaceMesh< dimension >::polygon_barycenter(
         index_t polygon_id ) const
     {
-        Point< dimension > barycenter;
-        for( const auto v : LRange{ nb_polygon_vertices( polygon_id ) } )
+        if( const auto* geometry =
+                impl_->polygon_geometry( *this, polygon_id ) )
         {
-            barycenter =
-                barycenter + this->point( polygon_vertex( { polygon_id, v } ) );
+            return geometry->barycenter;
         }
-        return barycenter / nb_polygon_vertices( polygon_id );
+        return compute_polygon_barycenter( *this, polygon_id );
     }
 
     template < index_t dimension >
@@ -962,6 +1111,24 @@ namespace geode
         impl_->disable_edges();
     }
 
+    template < index_t dimension >
+    bool SurfaceMesh< dimension >::is_geometric_cache_enabled() const
+    {
+        return impl_->is_geometric_cache_enabled();
+    }
+
+    template < index_t dimension >
+    void SurfaceMesh< dimension >::enable_geometric_cache() const
+    {
+        impl_->enable_geometric_cache( *this );
+    }
+
+    template < index_t dimension >
+    void SurfaceMesh< dimension >::disable_geometric_cache() const
+    {
+        impl_->disable_geometric_cache();
+    }
+
     template < index_t dimension >
     const SurfaceEdges< dimension >& SurfaceMesh< dimension >::edges() const
     {
@@ -1033,44 +1200,53 @@ namespace geode
         impl_->reset_polygons_around_vertex( vertex_id );
     }
 
-    template <>
-    double SurfaceMesh< 2 >::polygon_area( index_t polygon_id ) const
+    template < index_t dimension >
+    void SurfaceMesh< dimension >::reset_polygon_geometry(
+        index_t polygon_id, SurfaceMeshKey )
     {
-        if( nb_polygon_vertices( polygon_id ) < 3 )
-        {
-            return 0;
-        }
-        double area{ 0 };
-        const auto vertices = polygon_vertices( polygon_id );
-        const auto& p1 = this->point( vertices[0] );
-        for( const auto i : LRange{ 1, vertices.size() - 1 } )
+        impl_->reset_polygon_geometry( polygon_id );
+    }
+
+    template < index_t dimension >
+    void SurfaceMesh< dimension >::reset_vertices_geometry(
+        index_t first_vertex, index_t nb_vertices, SurfaceMeshKey )
+    {
+        impl_->reset_vertices_geometry( first_vertex, nb_vertices );
+    }
+
+    template < index_t dimension >
+    void SurfaceMesh< dimension >::reset_geometric_cache( SurfaceMeshKey )
+    {
+        impl_->reset_geometric_cache();
+    }
+
+    template < index_t dimension >
+    double SurfaceMesh< dimension >::polygon_area( index_t polygon_id ) const
+    {
+        if( const auto* geometry =
+                impl_->polygon_geometry( *this, polygon_id ) )
         {
-            const auto& p2 = this->point( vertices[i] );
-            const auto& p3 = this->point( vertices[i + 1] );
-            area += triangle_signed_area( { p1, p2, p3 } );
+            return geometry->area;
         }
-        return area;
+        return compute_polygon_area( *this, polygon_id );
     }
 
-    template <>
-    double SurfaceMesh< 3 >::polygon_area( index_t polygon_id ) const
+    template < index_t dimension >
+    BoundingBox< dimension > SurfaceMesh< dimension >::polygon_bounding_box(
+        index_t polygon_id ) const
     {
-        if( nb_polygon_vertices( polygon_id ) < 3 )
+        check_polygon_id( *this, polygon_id );
+        if( const auto* geometry =
+                impl_->polygon_geometry( *this, polygon_id ) )
         {
-            return 0;
+            return { geometry->bounding_box_min, geometry->bounding_box_max };
         }
-        double area{ 0 };
-        const auto direction =
-            polygon_normal( polygon_id ).value_or( Vector3D{ { 0, 0, 1 } } );
-        const auto vertices = polygon_vertices( polygon_id );
-        const auto& p1 = this->point( vertices[0] );
-        for( const auto i : LRange{ 1, vertices.size() - 1 } )
+        BoundingBox< dimension > box;
+        for( const auto vertex_id : PolygonVerticesRange{ *this, polygon_id } )
         {
-            const auto& p2 = this->point( vertices[i] );
-            const auto& p3 = this->point( vertices[i + 1] );
-            area += triangle_signed_area( { p1, p2, p3 }, direction );
+            box.add_point( this->point( vertex_id ) );
         }
-        return area;
+        return box;
     }
 
     template < index_t dimension >
@@ -1093,7 +1269,17 @@ namespace geode
         SurfaceMesh< dimension >::polygon_normal( index_t polygon_id ) const
     {
         check_polygon_id( *this, polygon_id );
-        return this->polygon( polygon_id ).normal();
+        if( const auto* geometry =
+                impl_->polygon_geometry( *this, polygon_id ) )
+        {
+            const auto& normal = geometry->normal;
+            if( normal == Vector3D{} )
+            {
+                return std::nullopt;
+            }
+            return normal;
+        }
+        return compute_polygon_normal( *this, polygon_id );
     }
 
     template < index_t dimension >
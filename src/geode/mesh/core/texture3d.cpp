@@ -29,6 +29,7 @@
 #include <geode/geometry/point.hpp>
 
 #include <geode/image/core/raster_image.hpp>
+#include <geode/image/core/rgb_color.hpp>
 
 #include <geode/mesh/core/internal/texture_impl.hpp>
 
@@ -92,6 +93,33 @@ namespace geode
         impl_->set_image( std::move( image ) );
     }
 
+    void Texture< 3 >::build_mipmaps()
+    {
+        impl_->build_mipmaps();
+    }
+
+    index_t Texture< 3 >::nb_mipmap_levels() const
+    {
+        return impl_->nb_mipmap_levels();
+    }
+
+    const RasterImage3D& Texture< 3 >::mipmap( index_t level ) const
+    {
+        return impl_->mipmap( level );
+    }
+
+    RGBColor Texture< 3 >::texture_value(
+        const Point3D& coordinates, double level ) const
+    {
+        return impl_->texture_value( coordinates, level );
+    }
+
+    std::vector< RGBColor > Texture< 3 >::texture_values(
+        absl::Span< const Point3D > coordinates, double level ) const
+    {
+        return impl_->texture_values( coordinates, level );
+    }
+
     const Point3D& Texture< 3 >::texture_coordinates(
         const PolyhedronVertex& vertex ) const
     {
@@ -23,6 +23,8 @@
 
 #include <geode/mesh/helpers/convert_solid_mesh.hpp>
 
+#include <async++.h>
+
 #include <geode/basic/logger.hpp>
 
 #include <geode/geometry/point.hpp>
@@ -545,16 +547,17 @@ namespace geode
         auto builder = TetrahedralSolidBuilder3D::create( *tet_solid->get() );
         internal::copy_meta_info( solid, *builder );
         internal::copy_points( solid, *builder );
-        builder->reserve_tetrahedra( solid.nb_polyhedra() );
-        for( const auto p : Range{ solid.nb_polyhedra() } )
-        {
-            const std::array< index_t, 4 > vertices{ solid.polyhedron_vertex(
-                                                         { p, 0 } ),
-                solid.polyhedron_vertex( { p, 1 } ),
-                solid.polyhedron_vertex( { p, 2 } ),
-                solid.polyhedron_vertex( { p, 3 } ) };
-            builder->create_tetrahedron( vertices );
-        }
+        std::vector< std::array< index_t, 4 > > tetrahedra(
+            solid.nb_polyhedra() );
+        async::parallel_for(
+            async::irange( index_t{ 0 }, solid.nb_polyhedra() ),
+            [&solid, &tetrahedra]( index_t p ) {
+                for( const auto v : LRange{ 4 } )
+                {
+                    tetrahedra[p][v] = solid.polyhedron_vertex( { p, v } );
+                }
+            } );
+        builder->create_tetrahedra( tetrahedra );
         for( const auto p : Range{ solid.nb_polyhedra() } )
         {
             for( const auto f : LRange{ 4 } )
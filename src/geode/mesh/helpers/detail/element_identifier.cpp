@@ -23,6 +23,8 @@
 
 #include <geode/mesh/helpers/detail/element_identifier.hpp>
 
+#include <geode/basic/range.hpp>
+
 #include <geode/mesh/core/solid_mesh.hpp>
 
 namespace geode
@@ -42,15 +44,14 @@ namespace geode
             {
                 return false;
             }
-            const auto facets_vertices =
-                solid.polyhedron_facets_vertices( polyhedron_id );
-            if( facets_vertices.size() != 6 )
+            if( solid.nb_polyhedron_facets( polyhedron_id ) != 6 )
             {
                 return false;
             }
-            for( const auto &facet_vertices : facets_vertices )
+            for( const auto f : LRange{ 6 } )
             {
-                if( facet_vertices.size() != 4 )
+                if( solid.nb_polyhedron_facet_vertices( { polyhedron_id, f } )
+                    != 4 )
                 {
                     return false;
                 }
@@ -79,15 +80,15 @@ namespace geode
             {
                 return false;
             }
-            const auto facets_vertices =
-                solid.polyhedron_facets_vertices( polyhedron_id );
-            if( facets_vertices.size() != 5 )
+            if( solid.nb_polyhedron_facets( polyhedron_id ) != 5 )
             {
                 return false;
             }
-            for( const auto &facet_vertices : facets_vertices )
+            for( const auto f : LRange{ 5 } )
             {
-                if( facet_vertices.size() != 3 && facet_vertices.size() != 4 )
+                const auto nb_facet_vertices =
+                    solid.nb_polyhedron_facet_vertices( { polyhedron_id, f } );
+                if( nb_facet_vertices != 3 && nb_facet_vertices != 4 )
                 {
                     return false;
                 }
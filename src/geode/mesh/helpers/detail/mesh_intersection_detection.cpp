@@ -255,6 +255,49 @@ namespace
         return false;
     }
 
+    bool disjoint_triangles_intersect( const geode::Triangle3D& triangle,
+        const geode::Triangle3D& other_triangle )
+    {
+        const geode::PolygonVertices no_vertices;
+        return triangle_intersects_other( triangle, other_triangle,
+                   no_vertices, no_vertices, no_vertices )
+               || triangle_intersects_other( other_triangle, triangle,
+                   no_vertices, no_vertices, no_vertices );
+    }
+
+    bool disjoint_triangles_intersect( const geode::Triangle2D& triangle,
+        const geode::Triangle2D& other_triangle )
+    {
+        for( const auto edge_v : geode::LRange{ 3 } )
+        {
+            const geode::Segment2D edge{ triangle.vertices()[edge_v],
+                triangle.vertices()[edge_v == 2 ? 0 : edge_v + 1] };
+            for( const auto other_edge_v : geode::LRange{ 3 } )
+            {
+                const geode::Segment2D other_edge{
+                    other_triangle.vertices()[other_edge_v],
+                    other_triangle.vertices()[other_edge_v == 2
+                                                  ? 0
+                                                  : other_edge_v + 1]
+                };
+                const auto edge_edge_inter =
+                    geode::segment_segment_intersection_detection(
+                        edge, other_edge );
+                if( edge_edge_inter.first != geode::POSITION::outside
+                    && edge_edge_inter.first != geode::POSITION::parallel )
+                {
+                    return true;
+                }
+            }
+        }
+        return geode::point_triangle_position(
+                   triangle.vertices()[0].get(), other_triangle )
+                   != geode::POSITION::outside
+               || geode::point_triangle_position(
+                      other_triangle.vertices()[0].get(), triangle )
+                      != geode::POSITION::outside;
+    }
+
     template < typename Mesh >
     bool triangles_intersection_detection( const Mesh& mesh,
         const geode::PolygonVertices& triangle,
@@ -269,6 +312,61 @@ namespace
         return triangles_intersect(
             mesh, triangle, other_triangle, common_points );
     }
+
+    /*!
+     * View two meshes as a single one to reuse the shared vertices logic:
+     * vertices of the other mesh are indexed after the mesh vertices.
+     */
+    template < typename Mesh >
+    class ConformalMeshes
+    {
+    public:
+        static constexpr auto dim = Mesh::dim;
+
+        ConformalMeshes( const Mesh& mesh, const Mesh& other_mesh )
+            : mesh_( mesh ), other_mesh_( other_mesh )
+        {
+        }
+
+        const geode::Point< dim >& point( geode::index_t vertex ) const
+        {
+            if( vertex < mesh_.nb_vertices() )
+            {
+                return mesh_.point( vertex );
+            }
+            return other_mesh_.point( vertex - mesh_.nb_vertices() );
+        }
+
+        /*!
+         * Other polygon vertices colocated with a polygon vertex are given
+         * the index of this vertex.
+         */
+        geode::PolygonVertices conformal_other_polygon(
+            const geode::PolygonVertices& polygon,
+            const geode::PolygonVertices& other_polygon ) const
+        {
+            geode::PolygonVertices conformal_polygon;
+            for( const auto other_vertex : other_polygon )
+            {
+                const auto& other_point = other_mesh_.point( other_vertex );
+                const auto colocated =
+                    absl::c_find_if( polygon, [this, &other_point](
+                                                  geode::index_t vertex ) {
+                        return mesh_.point( vertex ).inexact_equal(
+                            other_point );
+                    } );
+                conformal_polygon.push_back( colocated == polygon.end()
+                                                 ? mesh_.nb_vertices()
+                                                       + other_vertex
+                                                 : *colocated );
+            }
+            return conformal_polygon;
+        }
+
+    private:
+        const Mesh& mesh_;
+        const Mesh& other_mesh_;
+    };
 } // namespace
 
 namespace geode
@@ -311,6 +409,43 @@ namespace geode
             return false;
         }
 
+        template < typename Mesh >
+        bool polygons_intersection_detection( const Mesh& mesh,
+            const PolygonVertices& polygon,
+            const Mesh& other_mesh,
+            const PolygonVertices& other_polygon )
+        {
+            if( polygon.size() < 3 || other_polygon.size() < 3 )
+            {
+                return false;
+            }
+            for( const auto& triangle : fan_triangles( polygon, 0 ) )
+            {
+                const auto mesh_tri = mesh_triangle( mesh, triangle );
+                for( const auto& other_triangle :
+                    fan_triangles( other_polygon, 0 ) )
+                {
+                    if( disjoint_triangles_intersect( mesh_tri,
+                            mesh_triangle( other_mesh, other_triangle ) ) )
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        template < typename Mesh >
+        bool conformal_polygons_intersection_detection( const Mesh& mesh,
+            const PolygonVertices& polygon,
+            const Mesh& other_mesh,
+            const PolygonVertices& other_polygon )
+        {
+            const ConformalMeshes< Mesh > meshes{ mesh, other_mesh };
+            return polygons_intersection_detection( meshes, polygon,
+                meshes.conformal_other_polygon( polygon, other_polygon ) );
+        }
+
         template bool opengeode_mesh_api polygons_intersection_detection(
             const SurfaceMesh2D&,
             const PolygonVertices&,
@@ -324,5 +459,37 @@ namespace geode
             const SolidMesh3D&,
             const PolygonVertices&,
             const PolygonVertices& );
+
+        template bool opengeode_mesh_api polygons_intersection_detection(
+            const SurfaceMesh2D&,
+            const PolygonVertices&,
+            const SurfaceMesh2D&,
+            const PolygonVertices& );
+        template bool opengeode_mesh_api polygons_intersection_detection(
+            const SurfaceMesh3D&,
+            const PolygonVertices&,
+            const SurfaceMesh3D&,
+            const PolygonVertices& );
+        template bool opengeode_mesh_api polygons_intersection_detection(
+            const SolidMesh3D&,
+            const PolygonVertices&,
+            const SolidMesh3D&,
+            const PolygonVertices& );
+
+        template bool opengeode_mesh_api
+            conformal_polygons_intersection_detection( const SurfaceMesh2D&,
+                const PolygonVertices&,
+                const SurfaceMesh2D&,
+                const PolygonVertices& );
+        template bool opengeode_mesh_api
+            conformal_polygons_intersection_detection( const SurfaceMesh3D&,
+                const PolygonVertices&,
+                const SurfaceMesh3D&,
+                const PolygonVertices& );
+        template bool opengeode_mesh_api
+            conformal_polygons_intersection_detection( const SolidMesh3D&,
+                const PolygonVertices&,
+                const SolidMesh3D&,
+                const PolygonVertices& );
     } // namespace detail
 } // namespace geode
\ No newline at end of file
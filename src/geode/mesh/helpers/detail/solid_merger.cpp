@@ -23,13 +23,15 @@
 
 #include <geode/mesh/helpers/detail/solid_merger.hpp>
 
-#include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
 
+#include <async++.h>
+
 #include <geode/basic/algorithm.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 
 #include <geode/mesh/builder/solid_mesh_builder.hpp>
+#include <geode/mesh/builder/tetrahedral_solid_builder.hpp>
 #include <geode/mesh/core/detail/vertex_cycle.hpp>
 #include <geode/mesh/core/solid_mesh.hpp>
 
@@ -64,24 +66,22 @@ namespace geode
         template < index_t dimension >
         class SolidMeshMerger< dimension >::Impl
         {
-            using Polyhedron = absl::FixedArray< index_t >;
+            using Polyhedron = absl::InlinedVector< index_t, 8 >;
             using TypedVertexCycle = detail::VertexCycle< Polyhedron >;
             using SolidId = absl::flat_hash_set< index_t >;
 
         public:
             Impl( absl::Span< const std::reference_wrapper<
                     const SolidMesh< dimension > > > solids )
-                : new_id_( solids.size() )
+                : new_id_( solids.size() ), offsets_( solids.size() + 1 )
             {
-                index_t nb_polyhedra{ 0 };
+                offsets_[0] = 0;
                 for( const auto s : Indices{ solids } )
                 {
                     const auto& solid = solids[s].get();
                     new_id_[s].resize( solid.nb_polyhedra(), NO_ID );
-                    nb_polyhedra += solid.nb_polyhedra();
+                    offsets_[s + 1] = offsets_[s] + solid.nb_polyhedra();
                 }
-                polyhedra_origins_.reserve( nb_polyhedra );
-                solid_id_.reserve( nb_polyhedra );
             }
 
             std::unique_ptr< SolidMesh< dimension > > merge(
@@ -123,116 +123,173 @@ namespace geode
                 separate_solids( merger );
             }
 
+            index_t input_solid( index_t input ) const
+            {
+                return static_cast< index_t >(
+                    absl::c_upper_bound( offsets_, input ) - offsets_.begin()
+                    - 1 );
+            }
+
+            /*!
+             * Input polyhedra are identified by a global index following
+             * offsets_. Duplicated polyhedra are grouped by a parallel sort
+             * of their vertex cycles, the output order is the order of first
+             * occurrence.
+             */
             void create_polyhedra( SolidMeshMerger< dimension >& merger )
             {
-                absl::flat_hash_map< TypedVertexCycle, index_t > polyhedra;
                 const auto& meshes = merger.meshes();
-                for( const auto s : Indices{ merger.meshes() } )
-                {
-                    const auto& solid = meshes[s].get();
-                    for( const auto p : Range{ solid.nb_polyhedra() } )
-                    {
-                        Polyhedron vertices(
-                            solid.nb_polyhedron_vertices( p ) );
-                        for( const auto v : LIndices{ vertices } )
+                const auto nb_inputs = offsets_.back();
+                std::vector< Polyhedron > vertices( nb_inputs );
+                std::vector< Polyhedron > cycles( nb_inputs );
+                async::parallel_for( async::irange( index_t{ 0 }, nb_inputs ),
+                    [this, &merger, &meshes, &vertices, &cycles](
+                        index_t input ) {
+                        const auto s = input_solid( input );
+                        const auto p = input - offsets_[s];
+                        const auto& solid = meshes[s].get();
+                        auto& polyhedron = vertices[input];
+                        polyhedron.resize( solid.nb_polyhedron_vertices( p ) );
+                        for( const auto v : LIndices{ polyhedron } )
                         {
-                            vertices[v] = merger.vertex_in_merged(
+                            polyhedron[v] = merger.vertex_in_merged(
                                 s, solid.polyhedron_vertex( { p, v } ) );
                         }
-                        if( is_polyhedron_degenerated( vertices ) )
+                        if( !is_polyhedron_degenerated( polyhedron ) )
                         {
-                            continue;
+                            cycles[input] =
+                                TypedVertexCycle{ polyhedron }.vertices();
                         }
-                        const auto it =
-                            polyhedra.try_emplace( TypedVertexCycle{ vertices },
-                                merger.mesh().nb_polyhedra() );
-                        if( it.second )
+                    } );
+                std::vector< index_t > order;
+                order.reserve( nb_inputs );
+                for( const auto input : Range{ nb_inputs } )
+                {
+                    if( !cycles[input].empty() )
+                    {
+                        order.push_back( input );
+                    }
+                }
+                parallel_sort( order.begin(), order.end(),
+                    [&cycles]( index_t lhs, index_t rhs ) {
+                        if( cycles[lhs] != cycles[rhs] )
                         {
-                            absl::FixedArray< std::vector< local_index_t > >
-                                facets( solid.nb_polyhedron_facets( p ) );
-                            for( const auto f : LIndices{ facets } )
-                            {
-                                const PolyhedronFacet facet{ p, f };
-                                auto& facet_vertices = facets[f];
-                                facet_vertices.resize(
-                                    solid.nb_polyhedron_facet_vertices(
-                                        facet ) );
-                                for( const auto v : LIndices{ facet_vertices } )
-                                {
-                                    facet_vertices[v] =
-                                        solid
-                                            .polyhedron_facet_vertex_id(
-                                                { facet, v } )
-                                            .vertex_id;
-                                }
-                            }
-                            const auto polyhedron_id =
-                                merger.builder().create_polyhedron(
-                                    vertices, facets );
-                            OPENGEODE_ASSERT( polyhedron_id == solid_id_.size(),
-                                "[SolidMerger::create_polyhedra] Issue in "
-                                "polyhedron database (solid_id_)" );
-                            solid_id_.emplace_back();
-                            solid_id_.back().insert( s );
-                            new_id_[s][p] = polyhedron_id;
-                            OPENGEODE_ASSERT(
-                                polyhedron_id == polyhedra_origins_.size(),
-                                "[SolidMerger::create_polyhedra] Issue in "
-                                "polyhedron database (polyhedra_origins_)" );
-                            polyhedra_origins_.emplace_back();
-                            polyhedra_origins_.back().emplace_back( s, p );
+                            return cycles[lhs] < cycles[rhs];
                         }
-                        else
+                        return lhs < rhs;
+                    } );
+                std::vector< index_t > group_starts;
+                for( const auto i : Indices{ order } )
+                {
+                    if( i == 0 || cycles[order[i]] != cycles[order[i - 1]] )
+                    {
+                        group_starts.push_back( i );
+                    }
+                }
+                const auto nb_groups =
+                    static_cast< index_t >( group_starts.size() );
+                group_starts.push_back(
+                    static_cast< index_t >( order.size() ) );
+                std::vector< index_t > groups( nb_groups );
+                absl::c_iota( groups, 0 );
+                parallel_sort( groups.begin(), groups.end(),
+                    [&order, &group_starts]( index_t lhs, index_t rhs ) {
+                        return order[group_starts[lhs]]
+                               < order[group_starts[rhs]];
+                    } );
+                polyhedra_origins_.resize( nb_groups );
+                solid_id_.resize( nb_groups );
+                async::parallel_for( async::irange( index_t{ 0 }, nb_groups ),
+                    [this, &order, &group_starts, &groups](
+                        index_t polyhedron_id ) {
+                        const auto group = groups[polyhedron_id];
+                        for( const auto i : Range{ group_starts[group],
+                                 group_starts[group + 1] } )
                         {
-                            const auto polyhedron_id = it.first->second;
-                            OPENGEODE_ASSERT( polyhedron_id < solid_id_.size(),
-                                "[SolidMerger::create_polyhedra] Issue in "
-                                "polyhedron database (solid_id_)" );
+                            const auto s = input_solid( order[i] );
+                            const auto p = order[i] - offsets_[s];
                             solid_id_[polyhedron_id].insert( s );
                             new_id_[s][p] = polyhedron_id;
-                            OPENGEODE_ASSERT(
-                                polyhedron_id < polyhedra_origins_.size(),
-                                "[SolidMerger::create_polyhedra] Issue in "
-                                "polyhedron database (polyhedra_origins_)" );
                             polyhedra_origins_[polyhedron_id].emplace_back(
                                 s, p );
                         }
+                    } );
+                if( auto* tetrahedral_builder =
+                        dynamic_cast< TetrahedralSolidBuilder< dimension >* >(
+                            &merger.builder() ) )
+                {
+                    std::vector< std::array< index_t, 4 > > tetrahedra(
+                        nb_groups );
+                    async::parallel_for(
+                        async::irange( index_t{ 0 }, nb_groups ),
+                        [this, &vertices, &tetrahedra]( index_t tetrahedron ) {
+                            const auto& origin =
+                                polyhedra_origins_[tetrahedron].front();
+                            const auto& polyhedron =
+                                vertices[offsets_[origin.solid]
+                                         + origin.polyhedron];
+                            absl::c_copy(
+                                polyhedron, tetrahedra[tetrahedron].begin() );
+                        } );
+                    tetrahedral_builder->create_tetrahedra( tetrahedra );
+                    return;
+                }
+                for( const auto polyhedron_id : Range{ nb_groups } )
+                {
+                    const auto& origin =
+                        polyhedra_origins_[polyhedron_id].front();
+                    const auto& solid = meshes[origin.solid].get();
+                    const auto p = origin.polyhedron;
+                    absl::FixedArray< std::vector< local_index_t > > facets(
+                        solid.nb_polyhedron_facets( p ) );
+                    for( const auto f : LIndices{ facets } )
+                    {
+                        const PolyhedronFacet facet{ p, f };
+                        auto& facet_vertices = facets[f];
+                        facet_vertices.resize(
+                            solid.nb_polyhedron_facet_vertices( facet ) );
+                        for( const auto v : LIndices{ facet_vertices } )
+                        {
+                            facet_vertices[v] =
+                                solid.polyhedron_facet_vertex_id( { facet, v } )
+                                    .vertex_id;
+                        }
                     }
+                    merger.builder().create_polyhedron(
+                        vertices[offsets_[origin.solid] + p], facets );
                 }
             }
 
             void create_adjacencies( SolidMeshMerger< dimension >& merger )
             {
                 merger.builder().compute_polyhedron_adjacencies();
-                for( const auto p : Range{ merger.mesh().nb_polyhedra() } )
-                {
-                    for( const auto f :
-                        LRange{ merger.mesh().nb_polyhedron_facets( p ) } )
-                    {
-                        const PolyhedronFacet facet{ p, f };
-                        const auto adj =
-                            merger.mesh().polyhedron_adjacent_facet( facet );
-                        if( !adj )
+                const auto& mesh = merger.mesh();
+                absl::FixedArray< absl::InlinedVector< local_index_t, 1 > >
+                    facets_to_unset( mesh.nb_polyhedra() );
+                async::parallel_for(
+                    async::irange( index_t{ 0 }, mesh.nb_polyhedra() ),
+                    [this, &merger, &mesh, &facets_to_unset]( index_t p ) {
+                        for( const auto f :
+                            LRange{ mesh.nb_polyhedron_facets( p ) } )
                         {
-                            continue;
-                        }
-                        const auto facet_vertices =
-                            merger.mesh().polyhedron_facet_vertices( facet );
-                        bool keep_adj{ false };
-                        for( const auto& origin : polyhedra_origins_[p] )
-                        {
-                            const auto facet_origin = find_facet_origin(
-                                merger, facet_vertices, origin, f );
-                            const auto& meshes = merger.meshes();
-                            const auto& solid = meshes[origin.solid].get();
-                            if( !solid.is_polyhedron_facet_on_border(
-                                    facet_origin ) )
+                            const PolyhedronFacet facet{ p, f };
+                            if( mesh.is_polyhedron_facet_on_border( facet ) )
+                            {
+                                continue;
+                            }
+                            if( !keep_adjacency( merger, facet ) )
                             {
-                                keep_adj = true;
-                                break;
+                                facets_to_unset[p].push_back( f );
                             }
                         }
-                        if( !keep_adj )
+                    } );
+                for( const auto p : Range{ mesh.nb_polyhedra() } )
+                {
+                    for( const auto f : facets_to_unset[p] )
+                    {
+                        const PolyhedronFacet facet{ p, f };
+                        if( const auto adj =
+                                mesh.polyhedron_adjacent_facet( facet ) )
                         {
                             merger.builder().unset_polyhedron_adjacent( facet );
                             merger.builder().unset_polyhedron_adjacent(
@@ -242,6 +299,25 @@ namespace geode
                 }
             }
 
+            bool keep_adjacency( SolidMeshMerger< dimension >& merger,
+                const PolyhedronFacet& facet ) const
+            {
+                const auto facet_vertices =
+                    merger.mesh().polyhedron_facet_vertices( facet );
+                for( const auto& origin :
+                    polyhedra_origins_[facet.polyhedron_id] )
+                {
+                    const auto facet_origin = find_facet_origin(
+                        merger, facet_vertices, origin, facet.facet_id );
+                    const auto& solid = merger.meshes()[origin.solid].get();
+                    if( !solid.is_polyhedron_facet_on_border( facet_origin ) )
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
             PolyhedronFacet find_facet_origin(
                 SolidMeshMerger< dimension >& merger,
                 const PolyhedronFacetVertices& merged_facet_vertices,
@@ -288,20 +364,30 @@ namespace geode
 
             void separate_solids( SolidMeshMerger< dimension >& merger )
             {
-                for( const auto p : Range{ merger.mesh().nb_polyhedra() } )
-                {
-                    for( const auto f :
-                        LRange{ merger.mesh().nb_polyhedron_facets( p ) } )
-                    {
-                        if( const auto adj =
-                                merger.mesh().polyhedron_adjacent( { p, f } ) )
+                const auto& mesh = merger.mesh();
+                absl::FixedArray< absl::InlinedVector< local_index_t, 1 > >
+                    facets_to_unset( mesh.nb_polyhedra() );
+                async::parallel_for(
+                    async::irange( index_t{ 0 }, mesh.nb_polyhedra() ),
+                    [this, &mesh, &facets_to_unset]( index_t p ) {
+                        for( const auto f :
+                            LRange{ mesh.nb_polyhedron_facets( p ) } )
                         {
-                            if( solid_id_[p] != solid_id_[adj.value()] )
+                            if( const auto adj =
+                                    mesh.polyhedron_adjacent( { p, f } ) )
                             {
-                                merger.builder().unset_polyhedron_adjacent(
-                                    { p, f } );
+                                if( solid_id_[p] != solid_id_[adj.value()] )
+                                {
+                                    facets_to_unset[p].push_back( f );
+                                }
                             }
                         }
+                    } );
+                for( const auto p : Range{ mesh.nb_polyhedra() } )
+                {
+                    for( const auto f : facets_to_unset[p] )
+                    {
+                        merger.builder().unset_polyhedron_adjacent( { p, f } );
                     }
                 }
             }
@@ -310,6 +396,7 @@ namespace geode
             std::vector< SolidId > solid_id_;
             absl::FixedArray< std::vector< index_t > > new_id_;
             std::vector< PolyhedronOrigins > polyhedra_origins_;
+            absl::FixedArray< index_t > offsets_;
         };
 
         template < index_t dimension >
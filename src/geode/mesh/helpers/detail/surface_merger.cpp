@@ -23,13 +23,15 @@
 
 #include <geode/mesh/helpers/detail/surface_merger.hpp>
 
-#include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
 
+#include <async++.h>
+
 #include <geode/basic/algorithm.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 
 #include <geode/mesh/builder/surface_mesh_builder.hpp>
+#include <geode/mesh/builder/triangulated_surface_builder.hpp>
 #include <geode/mesh/core/detail/vertex_cycle.hpp>
 #include <geode/mesh/core/surface_mesh.hpp>
 #include <geode/mesh/helpers/repair_polygon_orientations.hpp>
@@ -64,24 +66,22 @@ namespace geode
         template < index_t dimension >
         class SurfaceMeshMerger< dimension >::Impl
         {
-            using Polygon = absl::FixedArray< index_t >;
+            using Polygon = absl::InlinedVector< index_t, 4 >;
             using TypedVertexCycle = detail::VertexCycle< Polygon >;
             using SurfaceId = absl::flat_hash_set< index_t >;
 
         public:
             Impl( absl::Span< const std::reference_wrapper<
                     const SurfaceMesh< dimension > > > surfaces )
-                : new_id_( surfaces.size() )
+                : new_id_( surfaces.size() ), offsets_( surfaces.size() + 1 )
             {
-                index_t nb_polygons{ 0 };
+                offsets_[0] = 0;
                 for( const auto s : Indices{ surfaces } )
                 {
                     const auto& surface = surfaces[s].get();
                     new_id_[s].resize( surface.nb_polygons(), NO_ID );
-                    nb_polygons += surface.nb_polygons();
+                    offsets_[s + 1] = offsets_[s] + surface.nb_polygons();
                 }
-                polygons_origins_.reserve( nb_polygons );
-                surface_id_.reserve( nb_polygons );
             }
 
             std::unique_ptr< SurfaceMesh< dimension > > merge(
@@ -122,95 +122,154 @@ namespace geode
                 repair_polygon_orientations( merger.mesh(), merger.builder() );
             }
 
+            index_t input_surface( index_t input ) const
+            {
+                return static_cast< index_t >(
+                    absl::c_upper_bound( offsets_, input ) - offsets_.begin()
+                    - 1 );
+            }
+
+            /*!
+             * Input polygons are identified by a global index following
+             * offsets_. Duplicated polygons are grouped by a parallel sort
+             * of their vertex cycles, the output order is the order of first
+             * occurrence.
+             */
             void create_polygons( SurfaceMeshMerger< dimension >& merger )
             {
-                absl::flat_hash_map< TypedVertexCycle, index_t > polygons;
                 const auto& meshes = merger.meshes();
-                for( const auto s : Indices{ merger.meshes() } )
-                {
-                    const auto& surface = meshes[s].get();
-                    for( const auto p : Range{ surface.nb_polygons() } )
-                    {
-                        Polygon vertices( surface.nb_polygon_vertices( p ) );
-                        for( const auto v :
-                            LRange{ surface.nb_polygon_vertices( p ) } )
+                const auto nb_inputs = offsets_.back();
+                std::vector< Polygon > vertices( nb_inputs );
+                std::vector< Polygon > cycles( nb_inputs );
+                async::parallel_for( async::irange( index_t{ 0 }, nb_inputs ),
+                    [this, &merger, &meshes, &vertices, &cycles](
+                        index_t input ) {
+                        const auto s = input_surface( input );
+                        const auto p = input - offsets_[s];
+                        const auto& surface = meshes[s].get();
+                        auto& polygon = vertices[input];
+                        polygon.resize( surface.nb_polygon_vertices( p ) );
+                        for( const auto v : LIndices{ polygon } )
                         {
-                            vertices[v] = merger.vertex_in_merged(
+                            polygon[v] = merger.vertex_in_merged(
                                 s, surface.polygon_vertex( { p, v } ) );
                         }
-                        if( is_polygon_degenerated( vertices ) )
+                        if( !is_polygon_degenerated( polygon ) )
                         {
-                            continue;
+                            cycles[input] =
+                                TypedVertexCycle{ polygon }.vertices();
                         }
-                        const auto it =
-                            polygons.try_emplace( TypedVertexCycle{ vertices },
-                                merger.mesh().nb_polygons() );
-                        if( it.second )
+                    } );
+                std::vector< index_t > order;
+                order.reserve( nb_inputs );
+                for( const auto input : Range{ nb_inputs } )
+                {
+                    if( !cycles[input].empty() )
+                    {
+                        order.push_back( input );
+                    }
+                }
+                parallel_sort( order.begin(), order.end(),
+                    [&cycles]( index_t lhs, index_t rhs ) {
+                        if( cycles[lhs] != cycles[rhs] )
                         {
-                            const auto polygon_id =
-                                merger.builder().create_polygon( vertices );
-                            OPENGEODE_ASSERT( polygon_id == surface_id_.size(),
-                                "[SurfaceMerger::create_polygons] Issue in "
-                                "polygon database (surface_id_)" );
-                            surface_id_.emplace_back();
-                            surface_id_.back().insert( s );
-                            new_id_[s][p] = polygon_id;
-                            OPENGEODE_ASSERT(
-                                polygon_id == polygons_origins_.size(),
-                                "[SurfaceMerger::create_polygons] Issue in "
-                                "polygon database (polygons_origins_)" );
-                            polygons_origins_.emplace_back();
-                            polygons_origins_.back().emplace_back( s, p );
+                            return cycles[lhs] < cycles[rhs];
                         }
-                        else
+                        return lhs < rhs;
+                    } );
+                std::vector< index_t > group_starts;
+                for( const auto i : Indices{ order } )
+                {
+                    if( i == 0 || cycles[order[i]] != cycles[order[i - 1]] )
+                    {
+                        group_starts.push_back( i );
+                    }
+                }
+                const auto nb_groups =
+                    static_cast< index_t >( group_starts.size() );
+                group_starts.push_back(
+                    static_cast< index_t >( order.size() ) );
+                std::vector< index_t > groups( nb_groups );
+                absl::c_iota( groups, 0 );
+                parallel_sort( groups.begin(), groups.end(),
+                    [&order, &group_starts]( index_t lhs, index_t rhs ) {
+                        return order[group_starts[lhs]]
+                               < order[group_starts[rhs]];
+                    } );
+                polygons_origins_.resize( nb_groups );
+                surface_id_.resize( nb_groups );
+                async::parallel_for( async::irange( index_t{ 0 }, nb_groups ),
+                    [this, &order, &group_starts, &groups](
+                        index_t polygon_id ) {
+                        const auto group = groups[polygon_id];
+                        for( const auto i : Range{ group_starts[group],
+                                 group_starts[group + 1] } )
                         {
-                            const auto polygon_id = it.first->second;
-                            OPENGEODE_ASSERT( polygon_id < surface_id_.size(),
-                                "[SurfaceMerger::create_polygons] Issue in "
-                                "polygon database (surface_id_)" );
+                            const auto s = input_surface( order[i] );
+                            const auto p = order[i] - offsets_[s];
                             surface_id_[polygon_id].insert( s );
                             new_id_[s][p] = polygon_id;
-                            OPENGEODE_ASSERT(
-                                polygon_id < polygons_origins_.size(),
-                                "[SurfaceMerger::create_polygons] Issue in "
-                                "polygon database (polygons_origins_)" );
                             polygons_origins_[polygon_id].emplace_back( s, p );
                         }
-                    }
+                    } );
+                if( auto* triangulated_builder = dynamic_cast<
+                        TriangulatedSurfaceBuilder< dimension >* >(
+                        &merger.builder() ) )
+                {
+                    std::vector< std::array< index_t, 3 > > triangles(
+                        nb_groups );
+                    async::parallel_for(
+                        async::irange( index_t{ 0 }, nb_groups ),
+                        [this, &vertices, &triangles]( index_t triangle ) {
+                            const auto& origin =
+                                polygons_origins_[triangle].front();
+                            const auto& polygon =
+                                vertices[offsets_[origin.surface]
+                                         + origin.polygon];
+                            absl::c_copy(
+                                polygon, triangles[triangle].begin() );
+                        } );
+                    triangulated_builder->create_triangles( triangles );
+                    return;
+                }
+                for( const auto polygon_id : Range{ nb_groups } )
+                {
+                    const auto& origin = polygons_origins_[polygon_id].front();
+                    merger.builder().create_polygon(
+                        vertices[offsets_[origin.surface] + origin.polygon] );
                 }
             }
 
             void create_adjacencies( SurfaceMeshMerger< dimension >& merger )
             {
                 merger.builder().compute_polygon_adjacencies();
-                for( const auto p : Range{ merger.mesh().nb_polygons() } )
-                {
-                    for( const auto e :
-                        LRange{ merger.mesh().nb_polygon_edges( p ) } )
-                    {
-                        const PolygonEdge edge{ p, e };
-                        const auto adj =
-                            merger.mesh().polygon_adjacent_edge( edge );
-                        if( !adj )
-                        {
-                            continue;
-                        }
-                        const auto edge_vertices =
-                            merger.mesh().polygon_edge_vertices( edge );
-                        bool keep_adj{ false };
-                        for( const auto& origin : polygons_origins_[p] )
+                const auto& mesh = merger.mesh();
+                absl::FixedArray< absl::InlinedVector< local_index_t, 1 > >
+                    edges_to_unset( mesh.nb_polygons() );
+                async::parallel_for(
+                    async::irange( index_t{ 0 }, mesh.nb_polygons() ),
+                    [this, &merger, &mesh, &edges_to_unset]( index_t p ) {
+                        for( const auto e :
+                            LRange{ mesh.nb_polygon_edges( p ) } )
                         {
-                            const auto edge_origin = find_edge_origin(
-                                merger, edge_vertices, origin, e );
-                            const auto& meshes = merger.meshes();
-                            const auto& surface = meshes[origin.surface].get();
-                            if( !surface.is_edge_on_border( edge_origin ) )
+                            const PolygonEdge edge{ p, e };
+                            if( mesh.is_edge_on_border( edge ) )
+                            {
+                                continue;
+                            }
+                            if( !keep_adjacency( merger, edge ) )
                             {
-                                keep_adj = true;
-                                break;
+                                edges_to_unset[p].push_back( e );
                             }
                         }
-                        if( !keep_adj )
+                    } );
+                for( const auto p : Range{ mesh.nb_polygons() } )
+                {
+                    for( const auto e : edges_to_unset[p] )
+                    {
+                        const PolygonEdge edge{ p, e };
+                        if( const auto adj =
+                                mesh.polygon_adjacent_edge( edge ) )
                         {
                             merger.builder().unset_polygon_adjacent( edge );
                             merger.builder().unset_polygon_adjacent(
@@ -220,6 +279,25 @@ namespace geode
                 }
             }
 
+            bool keep_adjacency( SurfaceMeshMerger< dimension >& merger,
+                const PolygonEdge& edge ) const
+            {
+                const auto edge_vertices =
+                    merger.mesh().polygon_edge_vertices( edge );
+                for( const auto& origin : polygons_origins_[edge.polygon_id] )
+                {
+                    const auto edge_origin = find_edge_origin(
+                        merger, edge_vertices, origin, edge.edge_id );
+                    const auto& surface =
+                        merger.meshes()[origin.surface].get();
+                    if( !surface.is_edge_on_border( edge_origin ) )
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
             PolygonEdge find_edge_origin(
                 SurfaceMeshMerger< dimension >& merger,
                 const std::array< index_t, 2 >& merged_edge_vertices,
@@ -269,21 +347,31 @@ namespace geode
 
             void separate_surfaces( SurfaceMeshMerger< dimension >& merger )
             {
-                for( const auto p : Range{ merger.mesh().nb_polygons() } )
-                {
-                    for( const auto e :
-                        LRange{ merger.mesh().nb_polygon_edges( p ) } )
-                    {
-                        const auto adj =
-                            merger.mesh().polygon_adjacent( { p, e } );
-                        if( !adj )
+                const auto& mesh = merger.mesh();
+                absl::FixedArray< absl::InlinedVector< local_index_t, 1 > >
+                    edges_to_unset( mesh.nb_polygons() );
+                async::parallel_for(
+                    async::irange( index_t{ 0 }, mesh.nb_polygons() ),
+                    [this, &mesh, &edges_to_unset]( index_t p ) {
+                        for( const auto e :
+                            LRange{ mesh.nb_polygon_edges( p ) } )
                         {
-                            continue;
-                        }
-                        if( surface_id_[p] != surface_id_[adj.value()] )
-                        {
-                            merger.builder().unset_polygon_adjacent( { p, e } );
+                            const auto adj = mesh.polygon_adjacent( { p, e } );
+                            if( !adj )
+                            {
+                                continue;
+                            }
+                            if( surface_id_[p] != surface_id_[adj.value()] )
+                            {
+                                edges_to_unset[p].push_back( e );
+                            }
                         }
+                    } );
+                for( const auto p : Range{ mesh.nb_polygons() } )
+                {
+                    for( const auto e : edges_to_unset[p] )
+                    {
+                        merger.builder().unset_polygon_adjacent( { p, e } );
                     }
                 }
             }
@@ -292,6 +380,7 @@ namespace geode
             std::vector< SurfaceId > surface_id_;
             absl::FixedArray< std::vector< index_t > > new_id_;
             std::vector< PolygonOrigins > polygons_origins_;
+            absl::FixedArray< index_t > offsets_;
         };
 
         template < index_t dimension >
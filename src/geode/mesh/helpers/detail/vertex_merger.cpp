@@ -112,11 +112,7 @@ namespace geode
             {
                 auto info = create_colocated_index_mapping();
                 vertices_ = std::move( info.colocated_mapping );
-                builder_->create_vertices( info.nb_unique_points() );
-                for( const auto p : Range{ info.nb_unique_points() } )
-                {
-                    builder_->set_point( p, info.unique_points[p] );
-                }
+                builder_->create_points( info.unique_points );
                 for( const auto m : Indices{ meshes_ } )
                 {
                     const auto& mesh = meshes_[m].get();
@@ -23,6 +23,11 @@
 
 #include <geode/mesh/helpers/euclidean_distance_transform.hpp>
 
+#include <limits>
+
+#include <absl/container/fixed_array.h>
+#include <absl/strings/str_cat.h>
+
 #include <async++.h>
 
 #include <geode/basic/attribute_manager.hpp>
@@ -30,6 +35,102 @@
 
 #include <geode/mesh/core/grid.hpp>
 
+namespace
+{
+    /*!
+     * One dimensional squared distance transform along a grid line, computed
+     * in linear time as the lower envelope of the parabolas rooted at every
+     * cell with a finite distance (Felzenszwalb and Huttenlocher).
+     * Buffers are allocated once and reused for every line of same length.
+     */
+    class LineDistanceTransform
+    {
+    public:
+        explicit LineDistanceTransform( geode::index_t nb_cells )
+            : values_( nb_cells ), sites_( nb_cells ), bounds_( nb_cells + 1 )
+        {
+        }
+
+        void apply( absl::Span< double > distances,
+            geode::index_t first_cell,
+            geode::index_t stride,
+            double squared_cell_length )
+        {
+            const auto nb_cells =
+                static_cast< geode::index_t >( values_.size() );
+            for( const auto c : geode::Range{ nb_cells } )
+            {
+                values_[c] = distances[first_cell + c * stride];
+            }
+            const auto nb_sites = compute_lower_envelope( squared_cell_length );
+            if( nb_sites == 0 )
+            {
+                return;
+            }
+            bounds_[nb_sites] = std::numeric_limits< double >::max();
+            geode::index_t site{ 0 };
+            for( const auto c : geode::Range{ nb_cells } )
+            {
+                while( bounds_[site + 1] < static_cast< double >( c ) )
+                {
+                    site++;
+                }
+                const auto site_cell = sites_[site];
+                const auto offset = static_cast< double >( c )
+                                    - static_cast< double >( site_cell );
+                distances[first_cell + c * stride] =
+                    squared_cell_length * offset * offset + values_[site_cell];
+            }
+        }
+
+    private:
+        geode::index_t compute_lower_envelope( double squared_cell_length )
+        {
+            geode::index_t nb_sites{ 0 };
+            for( const auto c : geode::Range{ values_.size() } )
+            {
+                if( values_[c] == std::numeric_limits< double >::max() )
+                {
+                    continue;
+                }
+                auto intersection = std::numeric_limits< double >::lowest();
+                while( nb_sites > 0 )
+                {
+                    intersection = parabola_intersection(
+                        sites_[nb_sites - 1], c, squared_cell_length );
+                    if( intersection > bounds_[nb_sites - 1] )
+                    {
+                        break;
+                    }
+                    nb_sites--;
+                }
+                sites_[nb_sites] = c;
+                bounds_[nb_sites] = intersection;
+                nb_sites++;
+            }
+            return nb_sites;
+        }
+
+        double parabola_intersection( geode::index_t cell0,
+            geode::index_t cell1,
+            double squared_cell_length ) const
+        {
+            const auto position0 = static_cast< double >( cell0 );
+            const auto position1 = static_cast< double >( cell1 );
+            return ( values_[cell1] - values_[cell0]
+                       + squared_cell_length
+                             * ( position1 * position1
+                                 - position0 * position0 ) )
+                   / ( 2. * squared_cell_length * ( position1 - position0 ) );
+        }
+
+    private:
+        absl::FixedArray< double > values_;
+        absl::FixedArray< geode::index_t > sites_;
+        absl::FixedArray< double > bounds_;
+    };
+} // namespace
+
 namespace geode
 {
     template < index_t dimension >
@@ -38,9 +139,8 @@ namespace geode
         using Index = typename Grid< dimension >::CellIndices;
 
     public:
-        EuclideanDistanceTransform( const Grid< dimension >& grid,
-            absl::Span< const Index > grid_cell_id,
-            std::string_view distance_map_name )
+        EuclideanDistanceTransform(
+            const Grid< dimension >& grid, std::string_view distance_map_name )
             : grid_( grid ),
               squared_cell_length_{},
               distance_map_{
@@ -55,64 +155,105 @@ namespace geode
                 squared_cell_length_[d] = grid_.cell_length_in_direction( d )
                                           * grid_.cell_length_in_direction( d );
             }
-            for( const auto& cell_id : grid_cell_id )
+        }
+
+        void add_objects( absl::Span< const Index > grid_cell_ids )
+        {
+            for( const auto& cell_id : grid_cell_ids )
             {
                 distance_map_->set_value( grid_.cell_index( cell_id ), 0. );
             }
         }
 
+        void add_objects(
+            absl::Span< const GridCellRun< dimension > > grid_cell_runs )
+        {
+            auto distances = distance_map_->modifiable_values();
+            for( const auto& run : grid_cell_runs )
+            {
+                const auto first = grid_.cell_index( run.first_cell );
+                std::fill_n( distances.begin() + first, run.nb_cells, 0. );
+            }
+        }
+
         std::shared_ptr< VariableAttribute< double > > distance_map() const
         {
             return distance_map_;
         }
 
-        void compute_squared_distance_map();
+        void compute_squared_distance_map()
+        {
+            ProgressLogger logger{
+                absl::StrCat( "Compute ", dimension, "D euclidian distance" ),
+                dimension
+            };
+            for( const auto d : LRange{ dimension } )
+            {
+                transform_lines( d );
+                logger.increment();
+            }
+        }
 
         void squared_root_filter()
         {
+            auto distances = distance_map_->modifiable_values();
             async::parallel_for(
                 async::irange( index_t{ 0 }, grid_.nb_cells() ),
-                [this]( index_t cell ) {
-                    distance_map_->modify_value( cell, []( double& value ) {
-                        value = std::sqrt( value );
-                    } );
+                [&distances]( index_t cell ) {
+                    distances[cell] = std::sqrt( distances[cell] );
                 } );
-            return;
         }
 
     private:
-        void propagate_directional_squared_distance( const index_t direction );
-
-        double propagate_directional_step_squared_distance(
-            const Index& from_index,
-            const Index& to_index,
-            const index_t direction,
-            const double last_step_squared_distance )
+        /*!
+         * Apply the one dimensional transform on every grid line in the
+         * given direction. Lines are processed in parallel, grouped by their
+         * position in the slowest other direction to reuse line buffers.
+         */
+        void transform_lines( local_index_t direction )
         {
-            const auto old_distance =
-                distance_map_->value( grid_.cell_index( from_index ) );
-            const auto step_squared_distance =
-                old_distance == 0 ? squared_cell_length_[direction]
-                                  : last_step_squared_distance
-                                        + 2 * squared_cell_length_[direction];
-            const auto new_distance = old_distance + step_squared_distance;
-            distance_map_->modify_value(
-                grid_.cell_index( to_index ), [new_distance]( double& value ) {
-                    value = std::min( value, new_distance );
+            const auto nb_cells = grid_.nb_cells_in_direction( direction );
+            const auto nb_lines = grid_.nb_cells() / nb_cells;
+            const auto last_other_direction =
+                direction == dimension - 1 ? dimension - 2 : dimension - 1;
+            const auto nb_line_groups =
+                grid_.nb_cells_in_direction( last_other_direction );
+            const auto nb_lines_in_group = nb_lines / nb_line_groups;
+            Index unit_index;
+            unit_index.fill( 0 );
+            unit_index[direction] = 1;
+            const auto stride = grid_.cell_index( unit_index );
+            auto distances = distance_map_->modifiable_values();
+            async::parallel_for( async::irange( index_t{ 0 }, nb_line_groups ),
+                [this, direction, nb_cells, nb_lines_in_group, stride,
+                    &distances]( index_t group ) {
+                    LineDistanceTransform transform{ nb_cells };
+                    const auto first_line = group * nb_lines_in_group;
+                    for( const auto line : Range{
+                             first_line, first_line + nb_lines_in_group } )
+                    {
+                        transform.apply( distances,
+                            line_first_cell( direction, line ), stride,
+                            squared_cell_length_[direction] );
+                    }
                 } );
-            return step_squared_distance;
         }
 
-        void combine_squared_distance_components( const index_t direction );
-
-        double directional_squared_distance( const index_t from,
-            const index_t to,
-            const index_t direction ) const
+        index_t line_first_cell( local_index_t direction, index_t line ) const
         {
-            const auto directional_distance =
-                static_cast< double >( from ) - static_cast< double >( to );
-            return directional_distance * directional_distance
-                   * squared_cell_length_[direction];
+            Index index;
+            for( const auto d : LRange{ dimension } )
+            {
+                if( d == direction )
+                {
+                    index[d] = 0;
+                    continue;
+                }
+                const auto nb_cells = grid_.nb_cells_in_direction( d );
+                index[d] = line % nb_cells;
+                line /= nb_cells;
+            }
+            return grid_.cell_index( index );
         }
 
     private:
@@ -121,276 +262,28 @@ namespace geode
         std::shared_ptr< VariableAttribute< double > > distance_map_;
     };
 
-    template <>
-    void
-        EuclideanDistanceTransform< 2 >::propagate_directional_squared_distance(
-            const index_t d )
-    {
-        const auto d2 = d == 1 ? 0 : 1;
-        absl::FixedArray< async::task< void > > tasks(
-            grid_.nb_cells_in_direction( d2 ) );
-        index_t task_id{ 0 };
-        for( const auto c2 : Range{ grid_.nb_cells_in_direction( d2 ) } )
-        {
-            tasks[task_id++] = async::spawn( [this, d, d2, c2] {
-                double step_squared_distance{ 0. };
-                for( const auto c :
-                    Range{ 1, grid_.nb_cells_in_direction( d ) } )
-                {
-                    Index index;
-                    index[d] = c;
-                    index[d2] = c2;
-                    auto prev_index = index;
-                    prev_index[d] = c - 1;
-                    step_squared_distance =
-                        propagate_directional_step_squared_distance(
-                            prev_index, index, d, step_squared_distance );
-                }
-                step_squared_distance = 0.;
-                for( const auto c :
-                    ReverseRange{ grid_.nb_cells_in_direction( d ) - 1 } )
-                {
-                    Index index;
-                    index[d] = c;
-                    index[d2] = c2;
-                    auto prev_index = index;
-                    prev_index[d] = c + 1;
-                    step_squared_distance =
-                        propagate_directional_step_squared_distance(
-                            prev_index, index, d, step_squared_distance );
-                }
-            } );
-        }
-        for( auto& task : async::when_all( tasks ).get() )
-        {
-            task.get();
-        }
-    }
-    template <>
-    void
-        EuclideanDistanceTransform< 3 >::propagate_directional_squared_distance(
-            const index_t d )
-    {
-        const auto d2 = d == 2 ? 0 : d + 1;
-        const auto d3 = d2 == 2 ? 0 : d2 + 1;
-        absl::FixedArray< async::task< void > > tasks(
-            grid_.nb_cells_in_direction( d2 )
-            * grid_.nb_cells_in_direction( d3 ) );
-        index_t task_id{ 0 };
-        for( const auto c3 : Range{ grid_.nb_cells_in_direction( d3 ) } )
-        {
-            for( const auto c2 : Range{ grid_.nb_cells_in_direction( d2 ) } )
-            {
-                tasks[task_id++] = async::spawn( [this, d, d2, d3, c2, c3] {
-                    double step_squared_distance{ 0 };
-                    for( const auto c :
-                        Range{ 1, grid_.nb_cells_in_direction( d ) } )
-                    {
-                        Index index;
-                        index[d] = c;
-                        index[d2] = c2;
-                        index[d3] = c3;
-                        auto prev_index = index;
-                        prev_index[d] = c - 1;
-                        step_squared_distance =
-                            propagate_directional_step_squared_distance(
-                                prev_index, index, d, step_squared_distance );
-                    }
-                    step_squared_distance = 0;
-                    for( const auto c :
-                        ReverseRange{ grid_.nb_cells_in_direction( d ) - 1 } )
-                    {
-                        Index index;
-                        index[d] = c;
-                        index[d2] = c2;
-                        index[d3] = c3;
-                        auto prev_index = index;
-                        prev_index[d] = c + 1;
-                        step_squared_distance =
-                            propagate_directional_step_squared_distance(
-                                prev_index, index, d, step_squared_distance );
-                    }
-                } );
-            }
-        }
-        for( auto& task : async::when_all( tasks ).get() )
-        {
-            task.get();
-        }
-    }
-
-    template <>
-    void EuclideanDistanceTransform< 2 >::combine_squared_distance_components(
-        const index_t d )
-    {
-        const auto d2 = d == 1 ? 0 : 1;
-        absl::FixedArray< async::task< void > > tasks(
-            grid_.nb_cells_in_direction( d2 ) );
-        index_t task_id{ 0 };
-        for( const auto c2 : Range{ grid_.nb_cells_in_direction( d2 ) } )
-        {
-            tasks[task_id++] = async::spawn( [this, d, d2, c2] {
-                absl::FixedArray< double > temps_dist(
-                    grid_.nb_cells_in_direction( d ) );
-                for( const auto c :
-                    Range{ 0, grid_.nb_cells_in_direction( d ) } )
-                {
-                    auto min_dist = std::numeric_limits< double >::max();
-                    for( const auto cf :
-                        Range{ c, grid_.nb_cells_in_direction( d ) } )
-                    {
-                        const auto step_squared_distance =
-                            directional_squared_distance( c, cf, d );
-                        if( min_dist < step_squared_distance )
-                        {
-                            break;
-                        }
-                        Index index;
-                        index[d] = cf;
-                        index[d2] = c2;
-                        min_dist = std::min( min_dist,
-                            distance_map_->value( grid_.cell_index( index ) )
-                                + step_squared_distance );
-                    }
-                    for( const auto cb : ReverseRange{ c, 0 } )
-                    {
-                        const auto step_squared_distance =
-                            directional_squared_distance( c, cb, d );
-                        if( min_dist < step_squared_distance )
-                        {
-                            break;
-                        }
-                        Index index;
-                        index[d] = cb;
-                        index[d2] = c2;
-                        min_dist = std::min( min_dist,
-                            distance_map_->value( grid_.cell_index( index ) )
-                                + step_squared_distance );
-                    }
-                    temps_dist[c] = min_dist;
-                }
-                for( const auto c :
-                    Range{ 0, grid_.nb_cells_in_direction( d ) } )
-                {
-                    Index index;
-                    index[d] = c;
-                    index[d2] = c2;
-                    distance_map_->set_value(
-                        grid_.cell_index( index ), temps_dist[c] );
-                }
-            } );
-        }
-        for( auto& task : async::when_all( tasks ).get() )
-        {
-            task.get();
-        }
-    }
-    template <>
-    void EuclideanDistanceTransform< 3 >::combine_squared_distance_components(
-        const index_t d )
-    {
-        const auto d2 = d == 2 ? 0 : d + 1;
-        const auto d3 = d2 == 2 ? 0 : d2 + 1;
-        absl::FixedArray< async::task< void > > tasks(
-            grid_.nb_cells_in_direction( d2 )
-            * grid_.nb_cells_in_direction( d3 ) );
-        index_t task_id{ 0 };
-        for( const auto c3 : Range{ grid_.nb_cells_in_direction( d3 ) } )
-        {
-            for( const auto c2 : Range{ grid_.nb_cells_in_direction( d2 ) } )
-            {
-                tasks[task_id++] = async::spawn( [this, d, d2, d3, c2, c3] {
-                    absl::FixedArray< double > temps_dist(
-                        grid_.nb_cells_in_direction( d ) );
-                    for( const auto c :
-                        Range{ 0, grid_.nb_cells_in_direction( d ) } )
-                    {
-                        auto min_dist = std::numeric_limits< double >::max();
-                        for( const auto cf :
-                            Range{ c, grid_.nb_cells_in_direction( d ) } )
-                        {
-                            const auto step_squared_distance =
-                                directional_squared_distance( c, cf, d );
-                            if( min_dist < step_squared_distance )
-                            {
-                                break;
-                            }
-                            Index index;
-                            index[d] = cf;
-                            index[d2] = c2;
-                            index[d3] = c3;
-                            min_dist = std::min(
-                                min_dist, distance_map_->value(
-                                              grid_.cell_index( index ) )
-                                              + step_squared_distance );
-                        }
-                        for( const auto cb : ReverseRange{ c, 0 } )
-                        {
-                            const auto step_squared_distance =
-                                directional_squared_distance( c, cb, d );
-                            if( min_dist < step_squared_distance )
-                            {
-                                break;
-                            }
-                            Index index;
-                            index[d] = cb;
-                            index[d2] = c2;
-                            index[d3] = c3;
-                            min_dist = std::min(
-                                min_dist, distance_map_->value(
-                                              grid_.cell_index( index ) )
-                                              + step_squared_distance );
-                        }
-                        temps_dist[c] = min_dist;
-                    }
-                    for( const auto c :
-                        Range{ 0, grid_.nb_cells_in_direction( d ) } )
-                    {
-                        Index index;
-                        index[d] = c;
-                        index[d2] = c2;
-                        index[d3] = c3;
-                        distance_map_->set_value(
-                            grid_.cell_index( index ), temps_dist[c] );
-                    }
-                } );
-            }
-        }
-        for( auto& task : async::when_all( tasks ).get() )
-        {
-            task.get();
-        }
-    }
-    template <>
-    void EuclideanDistanceTransform< 2 >::compute_squared_distance_map()
-    {
-        ProgressLogger logger{ "Compute 2D euclidian distance", 2 };
-        propagate_directional_squared_distance( 0 );
-        logger.increment();
-        combine_squared_distance_components( 1 );
-        logger.increment();
-    }
-    template <>
-    void EuclideanDistanceTransform< 3 >::compute_squared_distance_map()
+    template < index_t dimension >
+    std::shared_ptr< VariableAttribute< double > > euclidean_distance_transform(
+        const Grid< dimension >& grid,
+        absl::Span< const typename Grid< dimension >::CellIndices >
+            grid_cell_ids,
+        std::string_view distance_map_name )
     {
-        ProgressLogger logger{ "Compute 3D euclidian distance", 3 };
-        propagate_directional_squared_distance( 0 );
-        logger.increment();
-        combine_squared_distance_components( 1 );
-        logger.increment();
-        combine_squared_distance_components( 2 );
-        logger.increment();
+        EuclideanDistanceTransform< dimension > edt{ grid, distance_map_name };
+        edt.add_objects( grid_cell_ids );
+        edt.compute_squared_distance_map();
+        edt.squared_root_filter();
+        return edt.distance_map();
     }
 
     template < index_t dimension >
     std::shared_ptr< VariableAttribute< double > > euclidean_distance_transform(
         const Grid< dimension >& grid,
-        absl::Span< const typename Grid< dimension >::CellIndices >
-            grid_cell_ids,
+        absl::Span< const GridCellRun< dimension > > grid_cell_runs,
         std::string_view distance_map_name )
     {
-        EuclideanDistanceTransform< dimension > edt{ grid, grid_cell_ids,
-            distance_map_name };
+        EuclideanDistanceTransform< dimension > edt{ grid, distance_map_name };
+        edt.add_objects( grid_cell_runs );
         edt.compute_squared_distance_map();
         edt.squared_root_filter();
         return edt.distance_map();
@@ -404,4 +297,12 @@ namespace geode
         opengeode_mesh_api euclidean_distance_transform< 3 >( const Grid3D&,
             absl::Span< const Grid3D::CellIndices >,
             std::string_view );
+    template std::shared_ptr< VariableAttribute< double > >
+        opengeode_mesh_api euclidean_distance_transform< 2 >( const Grid2D&,
+            absl::Span< const GridCellRun2D >,
+            std::string_view );
+    template std::shared_ptr< VariableAttribute< double > >
+        opengeode_mesh_api euclidean_distance_transform< 3 >( const Grid3D&,
+            absl::Span< const GridCellRun3D >,
+            std::string_view );
 } // namespace geode
@@ -23,6 +23,8 @@
 
 #include <geode/mesh/helpers/gradient_computation.hpp>
 
+#include <async++.h>
+
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
@@ -37,60 +39,140 @@
 
 namespace
 {
+    constexpr geode::index_t CHUNK_SIZE{ 4096 };
+
+    using GradientResult =
+        std::tuple< std::string, std::vector< geode::index_t > >;
+
+    template < geode::index_t dimension >
+    struct NeighbourWeights
+    {
+        geode::index_t vertex;
+        double dist2;
+        std::array< double, dimension > diffs;
+        /*!
+         * Sign of the position difference along each axis,
+         * 0 when the neighbour does not contribute to this axis
+         */
+        std::array< double, dimension > signs;
+    };
+
     template < typename Mesh >
     class ScalarGradientComputer
     {
+        using Gradient = geode::Vector< Mesh::dim >;
+        using GradientAttribute = geode::VariableAttribute< Gradient >;
+        using Neighbours =
+            absl::InlinedVector< NeighbourWeights< Mesh::dim >, 32 >;
+
     public:
-        ScalarGradientComputer(
-            const Mesh& mesh, std::string_view scalar_function_name )
-            : mesh_( mesh ), vertex_has_value_( mesh.nb_vertices(), true )
+        ScalarGradientComputer( const Mesh& mesh,
+            absl::Span< const std::string_view > scalar_function_names )
+            : mesh_( mesh ),
+              scalar_functions_( scalar_function_names.size() ),
+              vertex_has_value_( scalar_function_names.size() )
         {
-            initialize_attribute_and_name( scalar_function_name );
-            for( const auto vertex_id : geode::Range{ mesh_.nb_vertices() } )
+            for( const auto f : geode::Indices{ scalar_function_names } )
             {
-                if( std::isnan( scalar_function_->value( vertex_id ) ) )
-                {
-                    vertex_has_value_[vertex_id] = false;
-                }
+                initialize_attribute( f, scalar_function_names[f] );
             }
+            async::parallel_for(
+                async::irange( std::size_t{ 0 }, scalar_functions_.size() ),
+                [this]( std::size_t f ) {
+                    auto& has_value = vertex_has_value_[f];
+                    has_value.assign( mesh_.nb_vertices(), true );
+                    for( const auto vertex_id :
+                        geode::Range{ mesh_.nb_vertices() } )
+                    {
+                        if( std::isnan(
+                                scalar_functions_[f]->value( vertex_id ) ) )
+                        {
+                            has_value[vertex_id] = false;
+                        }
+                    }
+                } );
         }
 
         ScalarGradientComputer( const Mesh& mesh,
             std::string_view scalar_function_name,
             absl::Span< const geode::index_t > no_value_vertices )
-            : mesh_( mesh ), vertex_has_value_( mesh.nb_vertices(), true )
+            : mesh_( mesh ), scalar_functions_( 1 ), vertex_has_value_( 1 )
         {
-            initialize_attribute_and_name( scalar_function_name );
+            initialize_attribute( 0, scalar_function_name );
+            vertex_has_value_[0].assign( mesh_.nb_vertices(), true );
             for( const auto vertex_id : no_value_vertices )
             {
-                vertex_has_value_[vertex_id] = false;
+                vertex_has_value_[0][vertex_id] = false;
             }
         }
 
-        std::tuple< std::string, std::vector< geode::index_t > >
-            compute_scalar_function_gradient() const
+        std::vector< GradientResult > compute_scalar_functions_gradients() const
         {
-            auto gradient_function =
-                mesh_.vertex_attribute_manager()
-                    .template find_or_create_attribute<
-                        geode::VariableAttribute, geode::Vector< Mesh::dim > >(
-                        output_gradient_attribute_name_,
-                        geode::Vector< Mesh::dim >{} );
-            std::vector< geode::index_t > no_gradient_value_vertices;
-            for( const auto vertex_id : geode::Range{ mesh_.nb_vertices() } )
+            const auto nb_functions = scalar_functions_.size();
+            std::vector< std::string > names;
+            names.reserve( nb_functions );
+            std::vector< std::shared_ptr< GradientAttribute > >
+                gradient_functions;
+            gradient_functions.reserve( nb_functions );
+            for( const auto f : geode::Range{ nb_functions } )
             {
-                if( !compute_gradient( *gradient_function, vertex_id ) )
+                names.emplace_back( output_gradient_attribute_name( f ) );
+                gradient_functions.emplace_back(
+                    mesh_.vertex_attribute_manager()
+                        .template find_or_create_attribute<
+                            geode::VariableAttribute, Gradient >(
+                            names.back(), Gradient{} ) );
+            }
+            const auto nb_vertices = mesh_.nb_vertices();
+            const auto nb_chunks =
+                ( nb_vertices + CHUNK_SIZE - 1 ) / CHUNK_SIZE;
+            std::vector< std::vector< std::vector< geode::index_t > > >
+                chunk_no_gradient_vertices( nb_chunks );
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, nb_chunks ),
+                [this, &gradient_functions, &chunk_no_gradient_vertices,
+                    nb_vertices, nb_functions]( geode::index_t chunk ) {
+                    auto& no_gradient_vertices =
+                        chunk_no_gradient_vertices[chunk];
+                    no_gradient_vertices.resize( nb_functions );
+                    Neighbours neighbours;
+                    const auto begin = chunk * CHUNK_SIZE;
+                    const auto end =
+                        std::min( begin + CHUNK_SIZE, nb_vertices );
+                    for( const auto vertex_id : geode::Range{ begin, end } )
+                    {
+                        compute_neighbours( vertex_id, neighbours );
+                        for( const auto f : geode::Range{ nb_functions } )
+                        {
+                            if( !compute_gradient( f, *gradient_functions[f],
+                                    vertex_id, neighbours ) )
+                            {
+                                no_gradient_vertices[f].push_back(
+                                    vertex_id );
+                            }
+                        }
+                    }
+                } );
+            std::vector< GradientResult > results;
+            results.reserve( nb_functions );
+            for( const auto f : geode::Range{ nb_functions } )
+            {
+                std::vector< geode::index_t > no_gradient_value_vertices;
+                for( const auto& chunk_vertices : chunk_no_gradient_vertices )
                 {
-                    no_gradient_value_vertices.push_back( vertex_id );
+                    no_gradient_value_vertices.insert(
+                        no_gradient_value_vertices.end(),
+                        chunk_vertices[f].begin(), chunk_vertices[f].end() );
                 }
+                results.emplace_back(
+                    names[f], std::move( no_gradient_value_vertices ) );
             }
-            return std::make_tuple( output_gradient_attribute_name_,
-                std::move( no_gradient_value_vertices ) );
+            return results;
         }
 
     private:
-        void initialize_attribute_and_name(
-            std::string_view scalar_function_name )
+        void initialize_attribute(
+            geode::index_t function_id, std::string_view scalar_function_name )
         {
             OPENGEODE_EXCEPTION(
                 mesh_.vertex_attribute_manager().attribute_exists(
@@ -103,67 +185,96 @@ namespace
                     == typeid( double ).name(),
                 "[compute_scalar_function_gradient] The attribute linked to "
                 "given name is not scalar." );
-            scalar_function_ =
+            scalar_functions_[function_id] =
                 mesh_.vertex_attribute_manager()
                     .template find_attribute< double >( scalar_function_name );
-            output_gradient_attribute_name_ =
-                absl::StrCat( scalar_function_name, "_gradient" );
+        }
+
+        std::string output_gradient_attribute_name(
+            geode::index_t function_id ) const
+        {
+            auto name = absl::StrCat(
+                scalar_functions_[function_id]->name(), "_gradient" );
             geode::index_t counter{ 0 };
             while( mesh_.vertex_attribute_manager().attribute_exists(
-                absl::StrCat( output_gradient_attribute_name_, counter ) ) )
+                absl::StrCat( name, counter ) ) )
             {
                 counter++;
             }
-            absl::StrAppend( &output_gradient_attribute_name_, counter );
+            absl::StrAppend( &name, counter );
+            return name;
         }
 
-        bool compute_gradient(
-            geode::VariableAttribute< geode::Vector< Mesh::dim > >&
-                gradient_function,
-            geode::index_t vertex_id ) const
+        void compute_neighbours(
+            geode::index_t vertex_id, Neighbours& neighbours ) const
         {
+            neighbours.clear();
             const auto& position = mesh_.point( vertex_id );
-            const auto function_value = scalar_function_->value( vertex_id );
-            if( !vertex_has_value_[vertex_id] )
+            for( const auto vertex_around :
+                mesh_.vertices_around_vertex( vertex_id ) )
+            {
+                auto& neighbour = neighbours.emplace_back();
+                neighbour.vertex = vertex_around;
+                const Gradient position_diff{ mesh_.point( vertex_around ),
+                    position };
+                neighbour.dist2 = position_diff.length2();
+                for( const auto d : geode::LRange{ Mesh::dim } )
+                {
+                    neighbour.diffs[d] = position_diff.value( d );
+                    if( std::fabs( neighbour.dist2 ) < geode::GLOBAL_EPSILON
+                        || std::fabs( neighbour.diffs[d]
+                                      / std::sqrt( neighbour.dist2 ) )
+                               < 0.1 )
+                    {
+                        neighbour.signs[d] = 0;
+                        continue;
+                    }
+                    neighbour.signs[d] = neighbour.diffs[d] < 0 ? -1. : 1.;
+                }
+            }
+        }
+
+        bool compute_gradient( geode::index_t function_id,
+            GradientAttribute& gradient_function,
+            geode::index_t vertex_id,
+            const Neighbours& neighbours ) const
+        {
+            const auto& scalar_function = *scalar_functions_[function_id];
+            const auto& has_value = vertex_has_value_[function_id];
+            if( !has_value[vertex_id] )
             {
                 gradient_function.set_value( vertex_id, no_value_gradient() );
                 return false;
             }
-            geode::Vector< Mesh::dim > computed_gradient;
-            const auto vertices_around =
-                mesh_.vertices_around_vertex( vertex_id );
+            for( const auto& neighbour : neighbours )
+            {
+                if( !has_value[neighbour.vertex] )
+                {
+                    gradient_function.set_value(
+                        vertex_id, no_value_gradient() );
+                    return false;
+                }
+            }
+            const auto function_value = scalar_function.value( vertex_id );
+            Gradient computed_gradient;
             bool value_set{ false };
             for( const auto d : geode::LRange{ Mesh::dim } )
             {
                 double contribution_sum{ 0 };
                 double inverse_dist_sum{ 0 };
-                for( const auto vertex_around : vertices_around )
+                for( const auto& neighbour : neighbours )
                 {
-                    if( !vertex_has_value_[vertex_around] )
-                    {
-                        gradient_function.set_value(
-                            vertex_id, no_value_gradient() );
-                        return false;
-                    }
-                    const geode::Vector< Mesh::dim > position_diff{
-                        mesh_.point( vertex_around ), position
-                    };
-                    const auto dist2 = position_diff.length2();
-                    if( std::fabs( dist2 ) < geode::GLOBAL_EPSILON
-                        || std::fabs(
-                               position_diff.value( d ) / std::sqrt( dist2 ) )
-                               < 0.1 )
+                    const auto diff_sign = neighbour.signs[d];
+                    if( diff_sign == 0 )
                     {
                         continue;
                     }
-                    const double diff_sign{ position_diff.value( d ) < 0 ? -1.
-                                                                         : 1. };
                     contribution_sum +=
                         ( function_value
-                            - scalar_function_->value( vertex_around ) )
-                        * diff_sign / dist2;
+                            - scalar_function.value( neighbour.vertex ) )
+                        * diff_sign / neighbour.dist2;
                     inverse_dist_sum +=
-                        diff_sign * position_diff.value( d ) / dist2;
+                        diff_sign * neighbour.diffs[d] / neighbour.dist2;
                 }
                 if( std::fabs( inverse_dist_sum ) <= geode::GLOBAL_EPSILON )
                 {
@@ -182,9 +293,9 @@ namespace
             return true;
         }
 
-        geode::Vector< Mesh::dim > no_value_gradient() const
+        Gradient no_value_gradient() const
         {
-            geode::Vector< Mesh::dim > result;
+            Gradient result;
             for( const auto dim : geode::LRange{ Mesh::dim } )
             {
                 result.set_value( dim, std::nan( "" ) );
@@ -194,10 +305,22 @@ namespace
 
     private:
         const Mesh& mesh_;
-        std::shared_ptr< geode::ReadOnlyAttribute< double > > scalar_function_;
-        std::string output_gradient_attribute_name_;
-        std::vector< bool > vertex_has_value_;
+        std::vector< std::shared_ptr< geode::ReadOnlyAttribute< double > > >
+            scalar_functions_;
+        std::vector< std::vector< bool > > vertex_has_value_;
     };
+
+    std::vector< std::string > gradient_names(
+        std::vector< GradientResult > results )
+    {
+        std::vector< std::string > names;
+        names.reserve( results.size() );
+        for( auto& result : results )
+        {
+            names.emplace_back( std::move( std::get< 0 >( result ) ) );
+        }
+        return names;
+    }
 } // namespace
 
 namespace geode
@@ -207,15 +330,34 @@ namespace geode
         const SurfaceMesh< dimension >& mesh,
         std::string_view scalar_function_name )
     {
-        ::ScalarGradientComputer computer{ mesh, scalar_function_name };
-        return std::get< 0 >( computer.compute_scalar_function_gradient() );
+        return compute_surface_scalar_functions_gradients(
+            mesh, { scalar_function_name } )
+            .front();
     }
 
     std::string compute_solid_scalar_function_gradient(
         const SolidMesh3D& mesh, std::string_view scalar_function_name )
     {
-        ::ScalarGradientComputer computer{ mesh, scalar_function_name };
-        return std::get< 0 >( computer.compute_scalar_function_gradient() );
+        return compute_solid_scalar_functions_gradients(
+            mesh, { scalar_function_name } )
+            .front();
+    }
+
+    template < index_t dimension >
+    std::vector< std::string > compute_surface_scalar_functions_gradients(
+        const SurfaceMesh< dimension >& mesh,
+        absl::Span< const std::string_view > scalar_function_names )
+    {
+        ::ScalarGradientComputer computer{ mesh, scalar_function_names };
+        return gradient_names( computer.compute_scalar_functions_gradients() );
+    }
+
+    std::vector< std::string > compute_solid_scalar_functions_gradients(
+        const SolidMesh3D& mesh,
+        absl::Span< const std::string_view > scalar_function_names )
+    {
+        ::ScalarGradientComputer computer{ mesh, scalar_function_names };
+        return gradient_names( computer.compute_scalar_functions_gradients() );
     }
 
     template std::string opengeode_mesh_api
@@ -225,6 +367,13 @@ namespace geode
         compute_surface_scalar_function_gradient(
             const SurfaceMesh3D&, std::string_view );
 
+    template std::vector< std::string > opengeode_mesh_api
+        compute_surface_scalar_functions_gradients(
+            const SurfaceMesh2D&, absl::Span< const std::string_view > );
+    template std::vector< std::string > opengeode_mesh_api
+        compute_surface_scalar_functions_gradients(
+            const SurfaceMesh3D&, absl::Span< const std::string_view > );
+
     namespace internal
     {
         template < index_t dimension >
@@ -236,7 +385,8 @@ namespace geode
         {
             ::ScalarGradientComputer computer{ mesh, scalar_function_name,
                 no_value_vertices };
-            return computer.compute_scalar_function_gradient();
+            return std::move(
+                computer.compute_scalar_functions_gradients().front() );
         }
 
         std::tuple< std::string, std::vector< index_t > >
@@ -246,7 +396,8 @@ namespace geode
         {
             ::ScalarGradientComputer computer{ mesh, scalar_function_name,
                 no_value_vertices };
-            return computer.compute_scalar_function_gradient();
+            return std::move(
+                computer.compute_scalar_functions_gradients().front() );
         }
 
         template std::tuple< std::string, std::vector< index_t > >
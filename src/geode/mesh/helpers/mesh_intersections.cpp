@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/helpers/mesh_intersections.hpp>
+
+#include <mutex>
+
+#include <absl/algorithm/container.h>
+
+#include <geode/geometry/aabb.hpp>
+#include <geode/geometry/basic_objects/tetrahedron.hpp>
+#include <geode/geometry/information.hpp>
+#include <geode/geometry/position.hpp>
+
+#include <geode/mesh/core/surface_mesh.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
+#include <geode/mesh/helpers/aabb_solid_helpers.hpp>
+#include <geode/mesh/helpers/aabb_surface_helpers.hpp>
+#include <geode/mesh/helpers/detail/mesh_intersection_detection.hpp>
+
+namespace
+{
+    /*!
+     * The AABBTree traversal runs independent subtree pairs in parallel,
+     * the narrow phase is then called concurrently.
+     */
+    template < geode::index_t dimension, typename NarrowPhase >
+    std::vector< geode::ElementsIntersection > self_intersections(
+        const geode::AABBTree< dimension >& tree,
+        const NarrowPhase& narrow_phase )
+    {
+        std::vector< geode::ElementsIntersection > intersections;
+        std::mutex mutex;
+        auto action = [&intersections, &mutex, &narrow_phase](
+                          geode::index_t element, geode::index_t other ) {
+            if( narrow_phase( element, other ) )
+            {
+                const auto pair = std::minmax( element, other );
+                std::lock_guard< std::mutex > lock( mutex );
+                intersections.push_back( { pair.first, pair.second } );
+            }
+            return false;
+        };
+        tree.compute_self_element_bbox_intersections( action );
+        absl::c_sort( intersections );
+        return intersections;
+    }
+
+    template < geode::index_t dimension, typename NarrowPhase >
+    std::vector< geode::ElementsIntersection > other_intersections(
+        const geode::AABBTree< dimension >& tree,
+        const geode::AABBTree< dimension >& other_tree,
+        const NarrowPhase& narrow_phase )
+    {
+        std::vector< geode::ElementsIntersection > intersections;
+        std::mutex mutex;
+        auto action = [&intersections, &mutex, &narrow_phase](
+                          geode::index_t element, geode::index_t other ) {
+            if( narrow_phase( element, other ) )
+            {
+                std::lock_guard< std::mutex > lock( mutex );
+                intersections.push_back( { element, other } );
+            }
+            return false;
+        };
+        tree.compute_other_element_bbox_intersections( other_tree, action );
+        absl::c_sort( intersections );
+        return intersections;
+    }
+
+    bool has_vertex_in_tetrahedron( const geode::TetrahedralSolid3D& mesh,
+        const geode::PolyhedronVertices& vertices,
+        const geode::PolyhedronVertices& other_vertices,
+        geode::index_t other_tetrahedron )
+    {
+        const auto tetrahedron = mesh.tetrahedron( other_tetrahedron );
+        for( const auto vertex : vertices )
+        {
+            if( absl::c_find( other_vertices, vertex ) != other_vertices.end() )
+            {
+                continue;
+            }
+            if( geode::point_tetrahedron_position(
+                    mesh.point( vertex ), tetrahedron )
+                != geode::POSITION::outside )
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool tetrahedra_intersect( const geode::TetrahedralSolid3D& mesh,
+        geode::index_t tetrahedron,
+        geode::index_t other_tetrahedron )
+    {
+        for( const auto facet : geode::LRange{ 4 } )
+        {
+            const auto facet_vertices =
+                mesh.polyhedron_facet_vertices( { tetrahedron, facet } );
+            for( const auto other_facet : geode::LRange{ 4 } )
+            {
+                const auto other_facet_vertices =
+                    mesh.polyhedron_facet_vertices(
+                        { other_tetrahedron, other_facet } );
+                if( absl::c_is_permutation(
+                        facet_vertices, other_facet_vertices ) )
+                {
+                    continue;
+                }
+                if( geode::detail::polygons_intersection_detection<
+                        geode::SolidMesh3D >(
+                        mesh, facet_vertices, other_facet_vertices ) )
+                {
+                    return true;
+                }
+            }
+        }
+        const auto vertices = mesh.polyhedron_vertices( tetrahedron );
+        const auto other_vertices =
+            mesh.polyhedron_vertices( other_tetrahedron );
+        return has_vertex_in_tetrahedron(
+                   mesh, vertices, other_vertices, other_tetrahedron )
+               || has_vertex_in_tetrahedron(
+                   mesh, other_vertices, vertices, tetrahedron );
+    }
+
+    template < typename Vertices >
+    bool has_colocated_vertex( const geode::TetrahedralSolid3D& mesh,
+        const Vertices& vertices,
+        const geode::Point3D& point )
+    {
+        return absl::c_any_of( vertices, [&mesh, &point]( geode::index_t v ) {
+            return mesh.point( v ).inexact_equal( point );
+        } );
+    }
+
+    bool has_vertex_in_other_tetrahedron(
+        const geode::TetrahedralSolid3D& mesh,
+        const geode::PolyhedronVertices& vertices,
+        const geode::TetrahedralSolid3D& other_mesh,
+        geode::index_t other_tetrahedron )
+    {
+        const auto other_vertices =
+            other_mesh.polyhedron_vertices( other_tetrahedron );
+        const auto tetrahedron = other_mesh.tetrahedron( other_tetrahedron );
+        for( const auto vertex : vertices )
+        {
+            const auto& point = mesh.point( vertex );
+            if( has_colocated_vertex( other_mesh, other_vertices, point ) )
+            {
+                continue;
+            }
+            if( geode::point_tetrahedron_position( point, tetrahedron )
+                != geode::POSITION::outside )
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool colocated_facets( const geode::TetrahedralSolid3D& mesh,
+        const geode::PolyhedronFacetVertices& facet_vertices,
+        const geode::TetrahedralSolid3D& other_mesh,
+        const geode::PolyhedronFacetVertices& other_facet_vertices )
+    {
+        return absl::c_all_of( other_facet_vertices,
+            [&mesh, &facet_vertices, &other_mesh]( geode::index_t vertex ) {
+                return has_colocated_vertex(
+                    mesh, facet_vertices, other_mesh.point( vertex ) );
+            } );
+    }
+
+    bool conformal_tetrahedra_intersect(
+        const geode::TetrahedralSolid3D& mesh,
+        geode::index_t tetrahedron,
+        const geode::TetrahedralSolid3D& other_mesh,
+        geode::index_t other_tetrahedron )
+    {
+        for( const auto facet : geode::LRange{ 4 } )
+        {
+            const auto facet_vertices =
+                mesh.polyhedron_facet_vertices( { tetrahedron, facet } );
+            for( const auto other_facet : geode::LRange{ 4 } )
+            {
+                const auto other_facet_vertices =
+                    other_mesh.polyhedron_facet_vertices(
+                        { other_tetrahedron, other_facet } );
+                if( colocated_facets( mesh, facet_vertices, other_mesh,
+                        other_facet_vertices ) )
+                {
+                    continue;
+                }
+                if( geode::detail::conformal_polygons_intersection_detection<
+                        geode::SolidMesh3D >( mesh, facet_vertices,
+                        other_mesh, other_facet_vertices ) )
+                {
+                    return true;
+                }
+            }
+        }
+        return has_vertex_in_other_tetrahedron( mesh,
+                   mesh.polyhedron_vertices( tetrahedron ), other_mesh,
+                   other_tetrahedron )
+               || has_vertex_in_other_tetrahedron( other_mesh,
+                   other_mesh.polyhedron_vertices( other_tetrahedron ), mesh,
+                   tetrahedron );
+    }
+
+    bool disjoint_tetrahedra_intersect( const geode::TetrahedralSolid3D& mesh,
+        geode::index_t tetrahedron,
+        const geode::TetrahedralSolid3D& other_mesh,
+        geode::index_t other_tetrahedron )
+    {
+        for( const auto facet : geode::LRange{ 4 } )
+        {
+            const auto facet_vertices =
+                mesh.polyhedron_facet_vertices( { tetrahedron, facet } );
+            for( const auto other_facet : geode::LRange{ 4 } )
+            {
+                if( geode::detail::polygons_intersection_detection<
+                        geode::SolidMesh3D >( mesh, facet_vertices,
+                        other_mesh,
+                        other_mesh.polyhedron_facet_vertices(
+                            { other_tetrahedron, other_facet } ) ) )
+                {
+                    return true;
+                }
+            }
+        }
+        // No facet intersection: one tetrahedron may still contain the other
+        return geode::point_tetrahedron_position(
+                   mesh.point( mesh.polyhedron_vertex( { tetrahedron, 0 } ) ),
+                   other_mesh.tetrahedron( other_tetrahedron ) )
+                   != geode::POSITION::outside
+               || geode::point_tetrahedron_position(
+                      other_mesh.point( other_mesh.polyhedron_vertex(
+                          { other_tetrahedron, 0 } ) ),
+                      mesh.tetrahedron( tetrahedron ) )
+                      != geode::POSITION::outside;
+    }
+} // namespace
+
+namespace geode
+{
+    template < index_t dimension >
+    std::vector< ElementsIntersection > surface_self_intersections(
+        const SurfaceMesh< dimension >& mesh )
+    {
+        const auto tree = create_aabb_tree( mesh );
+        return self_intersections(
+            tree, [&mesh]( index_t polygon, index_t other_polygon ) {
+                return detail::polygons_intersection_detection( mesh,
+                    mesh.polygon_vertices( polygon ),
+                    mesh.polygon_vertices( other_polygon ) );
+            } );
+    }
+
+    template < index_t dimension >
+    std::vector< ElementsIntersection > surfaces_intersections(
+        const SurfaceMesh< dimension >& mesh,
+        const SurfaceMesh< dimension >& other_mesh )
+    {
+        const auto tree = create_aabb_tree( mesh );
+        const auto other_tree = create_aabb_tree( other_mesh );
+        return other_intersections( tree, other_tree,
+            [&mesh, &other_mesh]( index_t polygon, index_t other_polygon ) {
+                return detail::polygons_intersection_detection( mesh,
+                    mesh.polygon_vertices( polygon ), other_mesh,
+                    other_mesh.polygon_vertices( other_polygon ) );
+            } );
+    }
+
+    template < index_t dimension >
+    std::vector< ElementsIntersection > conformal_surfaces_intersections(
+        const SurfaceMesh< dimension >& mesh,
+        const SurfaceMesh< dimension >& other_mesh )
+    {
+        const auto tree = create_aabb_tree( mesh );
+        const auto other_tree = create_aabb_tree( other_mesh );
+        return other_intersections( tree, other_tree,
+            [&mesh, &other_mesh]( index_t polygon, index_t other_polygon ) {
+                return detail::conformal_polygons_intersection_detection(
+                    mesh, mesh.polygon_vertices( polygon ), other_mesh,
+                    other_mesh.polygon_vertices( other_polygon ) );
+            } );
+    }
+
+    std::vector< ElementsIntersection > tetrahedral_solid_self_intersections(
+        const TetrahedralSolid3D& mesh )
+    {
+        const auto tree = create_aabb_tree( mesh );
+        return self_intersections(
+            tree, [&mesh]( index_t tetrahedron, index_t other_tetrahedron ) {
+                return tetrahedra_intersect(
+                    mesh, tetrahedron, other_tetrahedron );
+            } );
+    }
+
+    std::vector< ElementsIntersection > tetrahedral_solids_intersections(
+        const TetrahedralSolid3D& mesh, const TetrahedralSolid3D& other_mesh )
+    {
+        const auto tree = create_aabb_tree( mesh );
+        const auto other_tree = create_aabb_tree( other_mesh );
+        return other_intersections( tree, other_tree,
+            [&mesh, &other_mesh](
+                index_t tetrahedron, index_t other_tetrahedron ) {
+                return disjoint_tetrahedra_intersect(
+                    mesh, tetrahedron, other_mesh, other_tetrahedron );
+            } );
+    }
+
+    std::vector< ElementsIntersection >
+        conformal_tetrahedral_solids_intersections(
+            const TetrahedralSolid3D& mesh,
+            const TetrahedralSolid3D& other_mesh )
+    {
+        const auto tree = create_aabb_tree( mesh );
+        const auto other_tree = create_aabb_tree( other_mesh );
+        return other_intersections( tree, other_tree,
+            [&mesh, &other_mesh](
+                index_t tetrahedron, index_t other_tetrahedron ) {
+                return conformal_tetrahedra_intersect(
+                    mesh, tetrahedron, other_mesh, other_tetrahedron );
+            } );
+    }
+
+    template std::vector< ElementsIntersection > opengeode_mesh_api
+        surface_self_intersections( const SurfaceMesh2D& );
+    template std::vector< ElementsIntersection > opengeode_mesh_api
+        surface_self_intersections( const SurfaceMesh3D& );
+
+    template std::vector< ElementsIntersection > opengeode_mesh_api
+        surfaces_intersections( const SurfaceMesh2D&, const SurfaceMesh2D& );
+    template std::vector< ElementsIntersection > opengeode_mesh_api
+        surfaces_intersections( const SurfaceMesh3D&, const SurfaceMesh3D& );
+
+    template std::vector< ElementsIntersection > opengeode_mesh_api
+        conformal_surfaces_intersections(
+            const SurfaceMesh2D&, const SurfaceMesh2D& );
+    template std::vector< ElementsIntersection > opengeode_mesh_api
+        conformal_surfaces_intersections(
+            const SurfaceMesh3D&, const SurfaceMesh3D& );
+} // namespace geode
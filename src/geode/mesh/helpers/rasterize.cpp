@@ -28,6 +28,8 @@
 
 #include <absl/container/flat_hash_map.h>
 
+#include <async++.h>
+
 #include <geode/basic/algorithm.hpp>
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/geometry/barycentric_coordinates.hpp>
@@ -46,6 +48,7 @@
 
 #include <geode/mesh/core/detail/vertex_cycle.hpp>
 #include <geode/mesh/core/grid.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
 #include <geode/mesh/core/triangulated_surface.hpp>
 
 namespace
@@ -1008,10 +1011,9 @@ namespace
         return values;
     }
 
-    std::vector< typename geode::Grid3D::CellIndices > paint_interior(
-        Values& values )
+    std::vector< geode::GridCellRun3D > paint_interior_runs( Values& values )
     {
-        std::vector< geode::Grid3D::CellIndices > cells;
+        std::vector< geode::GridCellRun3D > runs;
         for( auto& value : values )
         {
             const auto j = value.first.first;
@@ -1021,28 +1023,249 @@ namespace
             OPENGEODE_EXCEPTION( i_values.size() % 2 == 0,
                 "[rasterize_closed_surface] Wrong "
                 "number of intervals to paint" );
-            bool paint{ true };
-            for( geode::index_t it = 0; it < i_values.size();
-                 it += 2, paint = !paint )
+            for( geode::index_t it = 0; it < i_values.size(); it += 4 )
+            {
+                const auto begin = i_values[it].ids[0];
+                const auto end = i_values[it + 1].ids[1] + 1;
+                runs.push_back( geode::GridCellRun3D{
+                    geode::Grid3D::CellIndices{ begin, j, k }, end - begin } );
+            }
+        }
+        return runs;
+    }
+
+    std::vector< typename geode::Grid3D::CellIndices > expand_runs(
+        absl::Span< const geode::GridCellRun3D > runs )
+    {
+        geode::index_t nb_cells{ 0 };
+        for( const auto& run : runs )
+        {
+            nb_cells += run.nb_cells;
+        }
+        std::vector< geode::Grid3D::CellIndices > cells;
+        cells.reserve( nb_cells );
+        for( const auto& run : runs )
+        {
+            const auto& first = run.first_cell;
+            for( const auto i :
+                geode::Range{ first[0], first[0] + run.nb_cells } )
             {
-                if( !paint )
+                cells.emplace_back(
+                    geode::Grid3D::CellIndices{ i, first[1], first[2] } );
+            }
+        }
+        return cells;
+    }
+
+    /*!
+     * Split of a grid into cubic tiles of cells. Each element is rasterized
+     * once into runs of cells, the runs are then cut along the tile
+     * boundaries and binned into their tile, in increasing element order.
+     */
+    class GridTiles
+    {
+        static constexpr geode::index_t TILE_SIZE{ 32 };
+
+    public:
+        struct ElementRuns
+        {
+            geode::index_t element;
+            absl::Span< const geode::GridCellRun3D > runs;
+        };
+
+        /*!
+         * RasterizeElement is called in parallel with an element id and
+         * returns the runs of cells painted by this element.
+         */
+        template < typename RasterizeElement >
+        GridTiles( const geode::Grid3D& grid,
+            geode::index_t nb_elements,
+            const RasterizeElement& rasterize_element )
+            : element_runs_( nb_elements )
+        {
+            geode::index_t nb_tiles{ 1 };
+            for( const auto d : geode::LRange{ 3 } )
+            {
+                nb_tiles_[d] =
+                    ( grid.nb_cells_in_direction( d ) + TILE_SIZE - 1 )
+                    / TILE_SIZE;
+                nb_tiles *= nb_tiles_[d];
+            }
+            tile_runs_.resize( nb_tiles );
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, nb_elements ),
+                [this, &rasterize_element]( geode::index_t element ) {
+                    element_runs_[element] =
+                        split_runs( rasterize_element( element ) );
+                } );
+            for( const auto element : geode::Range{ nb_elements } )
+            {
+                bin_element_runs( element );
+            }
+        }
+
+        geode::index_t nb_tiles() const
+        {
+            return static_cast< geode::index_t >( tile_runs_.size() );
+        }
+
+        absl::Span< const ElementRuns > tile_runs( geode::index_t tile ) const
+        {
+            return tile_runs_[tile];
+        }
+
+    private:
+        geode::index_t tile( const geode::Grid3D::CellIndices& cell ) const
+        {
+            return cell[0] / TILE_SIZE
+                   + nb_tiles_[0]
+                         * ( cell[1] / TILE_SIZE
+                             + nb_tiles_[1] * ( cell[2] / TILE_SIZE ) );
+        }
+
+        /*!
+         * Cut the runs crossing a tile boundary and sort them by tile.
+         */
+        std::vector< geode::GridCellRun3D > split_runs(
+            std::vector< geode::GridCellRun3D > runs ) const
+        {
+            std::vector< geode::GridCellRun3D > split;
+            split.reserve( runs.size() );
+            for( auto& run : runs )
+            {
+                while( run.nb_cells != 0 )
                 {
-                    continue;
+                    const auto tile_end =
+                        ( run.first_cell[0] / TILE_SIZE + 1 ) * TILE_SIZE;
+                    const auto nb_cells = std::min(
+                        run.nb_cells, tile_end - run.first_cell[0] );
+                    split.push_back( { run.first_cell, nb_cells } );
+                    run.first_cell[0] += nb_cells;
+                    run.nb_cells -= nb_cells;
                 }
-                for( const auto i : geode::Range{
-                         i_values[it].ids[0], i_values[it + 1].ids[1] + 1 } )
+            }
+            absl::c_stable_sort( split, [this]( const geode::GridCellRun3D& lhs,
+                                            const geode::GridCellRun3D& rhs ) {
+                return tile( lhs.first_cell ) < tile( rhs.first_cell );
+            } );
+            return split;
+        }
+
+        void bin_element_runs( geode::index_t element )
+        {
+            const auto runs = absl::MakeConstSpan( element_runs_[element] );
+            geode::index_t begin{ 0 };
+            while( begin < runs.size() )
+            {
+                const auto run_tile = tile( runs[begin].first_cell );
+                auto end = begin + 1;
+                while( end < runs.size()
+                       && tile( runs[end].first_cell ) == run_tile )
                 {
-                    cells.emplace_back( geode::Grid3D::CellIndices{ i, j, k } );
+                    end++;
                 }
+                tile_runs_[run_tile].push_back(
+                    { element, runs.subspan( begin, end - begin ) } );
+                begin = end;
             }
         }
-        return cells;
+
+    private:
+        std::array< geode::index_t, 3 > nb_tiles_;
+        std::vector< std::vector< geode::GridCellRun3D > > element_runs_;
+        std::vector< std::vector< ElementRuns > > tile_runs_;
+    };
+
+    void paint_cell( geode::index_t& cell_value,
+        geode::index_t element,
+        geode::RASTERIZATION_VALUE value )
+    {
+        if( value == geode::RASTERIZATION_VALUE::nb_elements )
+        {
+            cell_value++;
+        }
+        else if( cell_value == geode::NO_ID )
+        {
+            cell_value = element;
+        }
+    }
+
+    /*!
+     * Paint the runs of every element, tiles are processed in parallel.
+     */
+    std::shared_ptr< geode::VariableAttribute< geode::index_t > >
+        rasterize_elements( const GridTiles& tiles,
+            const geode::Grid3D& grid,
+            std::string_view attribute_name,
+            geode::RASTERIZATION_VALUE value )
+    {
+        auto& attribute_manager = grid.cell_attribute_manager();
+        if( attribute_manager.attribute_exists( attribute_name ) )
+        {
+            attribute_manager.delete_attribute( attribute_name );
+        }
+        const auto default_value =
+            value == geode::RASTERIZATION_VALUE::nb_elements ? 0
+                                                             : geode::NO_ID;
+        auto attribute = attribute_manager.find_or_create_attribute<
+            geode::VariableAttribute, geode::index_t >(
+            attribute_name, default_value );
+        auto cell_values = attribute->modifiable_values();
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, tiles.nb_tiles() ),
+            [&]( geode::index_t tile ) {
+                for( const auto& element_runs : tiles.tile_runs( tile ) )
+                {
+                    for( const auto& run : element_runs.runs )
+                    {
+                        auto cell = run.first_cell;
+                        for( const auto i : geode::Range{ run.nb_cells } )
+                        {
+                            cell[0] = run.first_cell[0] + i;
+                            paint_cell( cell_values[grid.cell_index( cell )],
+                                element_runs.element, value );
+                        }
+                    }
+                }
+            } );
+        return attribute;
     }
 
 } // namespace
 
 namespace geode
 {
+    template < index_t dimension >
+    std::vector< GridCellRun< dimension > > grid_cell_runs(
+        absl::Span< const CellIndices< dimension > > cells )
+    {
+        std::vector< CellIndices< dimension > > sorted_cells{ cells.begin(),
+            cells.end() };
+        absl::c_sort( sorted_cells, []( const CellIndices< dimension >& lhs,
+                                        const CellIndices< dimension >& rhs ) {
+            return std::lexicographical_compare(
+                lhs.rbegin(), lhs.rend(), rhs.rbegin(), rhs.rend() );
+        } );
+        std::vector< GridCellRun< dimension > > runs;
+        for( const auto& cell : sorted_cells )
+        {
+            if( !runs.empty() )
+            {
+                auto& run = runs.back();
+                if( std::equal( cell.begin() + 1, cell.end(),
+                        run.first_cell.begin() + 1 )
+                    && cell[0] <= run.first_cell[0] + run.nb_cells )
+                {
+                    run.nb_cells = std::max(
+                        run.nb_cells, cell[0] - run.first_cell[0] + 1 );
+                    continue;
+                }
+            }
+            runs.push_back( GridCellRun< dimension >{ cell, 1 } );
+        }
+        return runs;
+    }
+
     template < index_t dimension >
     std::vector< CellIndices< dimension > > rasterize_segment(
         const Grid< dimension >& grid, const Segment< dimension >& segment )
@@ -1119,18 +1342,37 @@ namespace geode
     std::vector< typename Grid3D::CellIndices > rasterize_tetrahedron(
         const Grid3D& grid, const Tetrahedron& tetrahedron )
     {
-        auto values = paint_surface( grid, tetrahedron );
-        return paint_interior( values );
+        return expand_runs( rasterize_tetrahedron_runs( grid, tetrahedron ) );
     }
 
     std::vector< Grid3D::CellIndices >
         opengeode_mesh_api rasterize_closed_surface(
             const Grid3D& grid, const TriangulatedSurface3D& closed_surface )
+    {
+        return expand_runs(
+            rasterize_closed_surface_runs( grid, closed_surface ) );
+    }
+
+    std::vector< GridCellRun3D > rasterize_tetrahedron_runs(
+        const Grid3D& grid, const Tetrahedron& tetrahedron )
+    {
+        auto values = paint_surface( grid, tetrahedron );
+        return paint_interior_runs( values );
+    }
+
+    std::vector< GridCellRun3D > rasterize_closed_surface_runs(
+        const Grid3D& grid, const TriangulatedSurface3D& closed_surface )
     {
         auto values = paint_surface( grid, closed_surface );
-        return paint_interior( values );
+        return paint_interior_runs( values );
     }
 
+    template std::vector< GridCellRun< 2 > > opengeode_mesh_api
+        grid_cell_runs< 2 >( absl::Span< const CellIndices< 2 > > );
+
+    template std::vector< GridCellRun< 3 > > opengeode_mesh_api
+        grid_cell_runs< 3 >( absl::Span< const CellIndices< 3 > > );
+
     template std::vector< CellIndices< 2 > > opengeode_mesh_api
         rasterize_segment< 2 >( const Grid2D&, const Segment2D& );
 
@@ -1150,4 +1392,33 @@ namespace geode
     template std::vector< CellIndices< 3 > >
         opengeode_mesh_api conservative_rasterize_triangle< 3 >(
             const Grid3D&, const Triangle3D& );
+
+    std::shared_ptr< VariableAttribute< index_t > > rasterize_tetrahedral_solid(
+        const Grid3D& grid,
+        const TetrahedralSolid3D& solid,
+        std::string_view attribute_name,
+        RASTERIZATION_VALUE value )
+    {
+        const GridTiles tiles{ grid, solid.nb_polyhedra(),
+            [&grid, &solid]( index_t t ) {
+                return rasterize_tetrahedron_runs(
+                    grid, solid.tetrahedron( t ) );
+            } };
+        return rasterize_elements( tiles, grid, attribute_name, value );
+    }
+
+    std::shared_ptr< VariableAttribute< index_t > >
+        rasterize_triangulated_surface( const Grid3D& grid,
+            const TriangulatedSurface3D& surface,
+            std::string_view attribute_name,
+            RASTERIZATION_VALUE value )
+    {
+        const GridTiles tiles{ grid, surface.nb_polygons(),
+            [&grid, &surface]( index_t t ) {
+                const auto cells = conservative_rasterize_triangle(
+                    grid, surface.triangle( t ) );
+                return grid_cell_runs< 3 >( cells );
+            } };
+        return rasterize_elements( tiles, grid, attribute_name, value );
+    }
 } // namespace geode
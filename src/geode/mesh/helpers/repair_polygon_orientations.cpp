@@ -25,8 +25,11 @@
 
 #include <queue>
 
+#include <absl/algorithm/container.h>
 #include <absl/container/flat_hash_map.h>
 
+#include <async++.h>
+
 #include <geode/basic/logger.hpp>
 
 #include <geode/geometry/basic_objects/triangle.hpp>
@@ -36,6 +39,7 @@
 #include <geode/mesh/builder/surface_edges_builder.hpp>
 #include <geode/mesh/builder/surface_mesh_builder.hpp>
 #include <geode/mesh/core/surface_mesh.hpp>
+#include <geode/mesh/helpers/detail/component_identifier.hpp>
 
 namespace
 {
@@ -44,33 +48,35 @@ namespace
     {
     public:
         PolygonOrientationChecker( const geode::SurfaceMesh< dimension >& mesh )
-            : mesh_( mesh ), reorient_polygon_( mesh.nb_polygons(), false )
+            : mesh_( mesh ),
+              visited_( mesh.nb_polygons(), false ),
+              reorient_polygon_( mesh.nb_polygons(), false )
         {
         }
 
         absl::FixedArray< geode::index_t > compute_bad_oriented_polygons()
         {
-            absl::FixedArray< bool > visited( mesh_.nb_polygons(), false );
-            for( const auto p : geode::Range{ mesh_.nb_polygons() } )
-            {
-                if( visited[p] )
-                {
-                    continue;
-                }
-                queue_.emplace( p );
-                visited[p] = true;
-                process_polygon_queue( visited );
-            }
+            geode::detail::SurfaceIdentifier< dimension > identifier{ mesh_ };
+            identifier.identify_polygons();
+            const auto components = identifier.identified_connected_polygons();
+            async::parallel_for(
+                async::irange( size_t{ 0 }, components.size() ),
+                [this, &components]( size_t component ) {
+                    process_polygon_queue( components[component].front() );
+                } );
             return get_bad_oriented_polygons();
         }
 
     private:
-        void process_polygon_queue( absl::FixedArray< bool >& visited )
+        void process_polygon_queue( geode::index_t first_polygon )
         {
-            while( !queue_.empty() )
+            std::queue< geode::index_t > queue;
+            queue.emplace( first_polygon );
+            visited_[first_polygon] = true;
+            while( !queue.empty() )
             {
-                const auto cur_polygon = queue_.front();
-                queue_.pop();
+                const auto cur_polygon = queue.front();
+                queue.pop();
                 const auto cur_polygon_reorient =
                     reorient_polygon_[cur_polygon];
                 const auto vertices = mesh_.polygon_vertices( cur_polygon );
@@ -78,7 +84,7 @@ namespace
                 {
                     const auto adj =
                         mesh_.polygon_adjacent_edge( { cur_polygon, e } );
-                    if( !adj || visited[adj->polygon_id] )
+                    if( !adj || visited_[adj->polygon_id] )
                     {
                         continue;
                     }
@@ -89,21 +95,19 @@ namespace
                         ( vertices[e] == adj_vertices[1]
                             && vertices[e_next] == adj_vertices[0] );
                     const auto adj_polygon = adj->polygon_id;
-                    visited[adj_polygon] = true;
+                    visited_[adj_polygon] = true;
                     reorient_polygon_[adj_polygon] =
                         cur_polygon_reorient == same_orientation;
-                    if( reorient_polygon_[adj_polygon] )
-                    {
-                        nb_++;
-                    }
-                    queue_.emplace( adj_polygon );
+                    queue.emplace( adj_polygon );
                 }
             }
         }
 
         absl::FixedArray< geode::index_t > get_bad_oriented_polygons() const
         {
-            absl::FixedArray< geode::index_t > bad_polygons( nb_ );
+            const auto nb_bad_polygons = static_cast< geode::index_t >(
+                absl::c_count( reorient_polygon_, true ) );
+            absl::FixedArray< geode::index_t > bad_polygons( nb_bad_polygons );
             geode::index_t count{ 0 };
             for( const auto p : geode::Range{ mesh_.nb_polygons() } )
             {
@@ -117,9 +121,8 @@ namespace
 
     private:
         const geode::SurfaceMesh< dimension >& mesh_;
-        std::queue< geode::index_t > queue_;
-        std::vector< bool > reorient_polygon_;
-        geode::index_t nb_{ 0 };
+        absl::FixedArray< bool > visited_;
+        absl::FixedArray< bool > reorient_polygon_;
     };
 
     struct polygons_area_sign_info
@@ -136,38 +139,45 @@ namespace
         absl::FixedArray< geode::Sign > area_sign;
     };
 
+    geode::Sign polygon_area_sign(
+        const geode::SurfaceMesh2D& mesh, geode::index_t polygon_id )
+    {
+        const auto& p1 = mesh.point( mesh.polygon_vertex( { polygon_id, 0 } ) );
+        for( const auto i :
+            geode::LRange{ 1, mesh.nb_polygon_vertices( polygon_id ) - 1 } )
+        {
+            const auto& p2 =
+                mesh.point( mesh.polygon_vertex( { polygon_id, i } ) );
+            const auto& p3 = mesh.point( mesh.polygon_vertex( { polygon_id,
+                static_cast< geode::local_index_t >( i + 1 ) } ) );
+            const auto sign = geode::triangle_area_sign( { p1, p2, p3 } );
+            if( sign != geode::Sign::zero )
+            {
+                return sign;
+            }
+        }
+        return geode::Sign::zero;
+    }
+
     polygons_area_sign_info compute_polygon_area_sign(
         const geode::SurfaceMesh2D& mesh )
     {
         polygons_area_sign_info area_sign_info{ 0, mesh.nb_polygons(),
             geode::Sign::zero };
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, mesh.nb_polygons() ),
+            [&mesh, &area_sign_info]( geode::index_t polygon_id ) {
+                area_sign_info.area_sign[polygon_id] =
+                    polygon_area_sign( mesh, polygon_id );
+            } );
         for( const auto polygon_id : geode::Range{ mesh.nb_polygons() } )
         {
-            const auto& p1 =
-                mesh.point( mesh.polygon_vertex( { polygon_id, 0 } ) );
-            for( const auto i :
-                geode::LRange{ 1, mesh.nb_polygon_vertices( polygon_id ) - 1 } )
+            if( area_sign_info.area_sign[polygon_id] == geode::Sign::negative )
             {
-                const auto& p2 =
-                    mesh.point( mesh.polygon_vertex( { polygon_id, i } ) );
-                const auto& p3 = mesh.point( mesh.polygon_vertex( { polygon_id,
-                    static_cast< geode::local_index_t >( i + 1 ) } ) );
-                const auto sign = geode::triangle_area_sign( { p1, p2, p3 } );
-                if( sign == geode::Sign::positive )
-                {
-                    area_sign_info.area_sign[polygon_id] =
-                        geode::Sign::positive;
-                    break;
-                }
-                if( sign == geode::Sign::negative )
-                {
-                    area_sign_info.area_sign[polygon_id] =
-                        geode::Sign::negative;
-                    area_sign_info.nb_bad_polygons++;
-                    break;
-                }
+                area_sign_info.nb_bad_polygons++;
             }
-            if( area_sign_info.area_sign[polygon_id] == geode::Sign::zero )
+            else if( area_sign_info.area_sign[polygon_id]
+                     == geode::Sign::zero )
             {
                 area_sign_info.queue.emplace( polygon_id );
             }
@@ -266,47 +276,6 @@ namespace
         PolygonOrientationChecker< 3 > checker{ mesh };
         return checker.compute_bad_oriented_polygons();
     }
-
-    template < geode::index_t dimension >
-    void reorient_bad_polygons( geode::SurfaceMeshBuilder< dimension >& builder,
-        const geode::SurfaceMesh< dimension >& mesh,
-        absl::Span< const geode::index_t > bad_polygons )
-    {
-        for( const auto p : bad_polygons )
-        {
-            absl::FixedArray< geode::index_t > vertices(
-                mesh.nb_polygon_vertices( p ) );
-            absl::FixedArray< std::optional< geode::index_t > > adjacents(
-                mesh.nb_polygon_edges( p ) );
-            for( const auto v : geode::LRange{ mesh.nb_polygon_vertices( p ) } )
-            {
-                vertices[v] = mesh.polygon_vertex( { p, v } );
-                adjacents[v] = mesh.polygon_adjacent( { p, v } );
-            }
-            std::reverse( vertices.begin() + 1, vertices.end() );
-            absl::c_reverse( adjacents );
-            for( const auto v : geode::LRange{ mesh.nb_polygon_vertices( p ) } )
-            {
-                builder.disassociate_polygon_vertex_to_vertex(
-                    mesh.polygon_vertex( { p, v } ) );
-            }
-            for( const auto v : geode::LRange{ mesh.nb_polygon_vertices( p ) } )
-            {
-                builder.set_polygon_vertex( { p, v }, vertices[v] );
-                builder.associate_polygon_vertex_to_vertex(
-                    { p, v }, vertices[v] );
-                if( adjacents[v] )
-                {
-                    builder.set_polygon_adjacent(
-                        { p, v }, adjacents[v].value() );
-                }
-                else
-                {
-                    builder.unset_polygon_adjacent( { p, v } );
-                }
-            }
-        }
-    }
 } // namespace
 
 namespace geode
@@ -324,7 +293,7 @@ namespace geode
     {
         const auto polygons_to_reorient =
             identify_badly_oriented_polygons( mesh );
-        reorient_bad_polygons( builder, mesh, polygons_to_reorient );
+        builder.reverse_polygons( polygons_to_reorient );
         if( mesh.are_edges_enabled() )
         {
             builder.edges_builder().delete_isolated_edges();
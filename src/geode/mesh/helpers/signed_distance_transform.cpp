@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/mesh/helpers/signed_distance_transform.hpp>
+
+#include <async++.h>
+
+#include <geode/basic/attribute_manager.hpp>
+
+#include <geode/geometry/aabb.hpp>
+#include <geode/geometry/basic_objects/triangle.hpp>
+
+#include <geode/mesh/core/grid.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+#include <geode/mesh/helpers/aabb_surface_helpers.hpp>
+#include <geode/mesh/helpers/euclidean_distance_transform.hpp>
+#include <geode/mesh/helpers/rasterize.hpp>
+
+namespace
+{
+    std::vector< geode::Grid3D::CellIndices > rasterize_surface(
+        const geode::Grid3D& grid,
+        const geode::TriangulatedSurface3D& closed_surface )
+    {
+        std::vector< std::vector< geode::Grid3D::CellIndices > >
+            triangle_cells( closed_surface.nb_polygons() );
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, closed_surface.nb_polygons() ),
+            [&grid, &closed_surface, &triangle_cells]( geode::index_t t ) {
+                triangle_cells[t] = geode::conservative_rasterize_triangle(
+                    grid, closed_surface.triangle( t ) );
+            } );
+        std::vector< geode::Grid3D::CellIndices > cells;
+        for( const auto& cells_in_triangle : triangle_cells )
+        {
+            cells.insert( cells.end(), cells_in_triangle.begin(),
+                cells_in_triangle.end() );
+        }
+        return cells;
+    }
+
+    double half_cell_diagonal( const geode::Grid3D& grid )
+    {
+        double squared_diagonal{ 0 };
+        for( const auto d : geode::LRange{ 3 } )
+        {
+            const auto length = grid.cell_length_in_direction( d );
+            squared_diagonal += length * length;
+        }
+        return std::sqrt( squared_diagonal ) / 2.;
+    }
+} // namespace
+
+namespace geode
+{
+    std::shared_ptr< VariableAttribute< double > > signed_distance_transform(
+        const Grid3D& grid,
+        const TriangulatedSurface3D& closed_surface,
+        std::string_view distance_map_name,
+        std::optional< double > narrow_band )
+    {
+        OPENGEODE_EXCEPTION( !narrow_band || narrow_band.value() > 0,
+            "[signed_distance_transform] Narrow band should be strictly "
+            "positive" );
+        auto& attribute_manager = grid.cell_attribute_manager();
+        if( attribute_manager.attribute_exists( distance_map_name ) )
+        {
+            attribute_manager.delete_attribute( distance_map_name );
+        }
+        std::shared_ptr< VariableAttribute< double > > distance_map;
+        auto max_distance = std::numeric_limits< double >::max();
+        if( narrow_band )
+        {
+            distance_map = euclidean_distance_transform< 3 >( grid,
+                rasterize_surface( grid, closed_surface ), distance_map_name );
+            max_distance = narrow_band.value() + half_cell_diagonal( grid );
+        }
+        else
+        {
+            distance_map = attribute_manager.find_or_create_attribute<
+                VariableAttribute, double >( distance_map_name, 0. );
+        }
+        const TriangulatedSurfaceAABB3D aabb{ closed_surface };
+        auto distances = distance_map->modifiable_values();
+        async::parallel_for( async::irange( index_t{ 0 }, grid.nb_cells() ),
+            [&grid, &narrow_band, &aabb, &distances, max_distance](
+                index_t cell ) {
+                if( distances[cell] > max_distance )
+                {
+                    distances[cell] = narrow_band.value();
+                    return;
+                }
+                const auto barycenter =
+                    grid.cell_barycenter( grid.cell_indices( cell ) );
+                distances[cell] =
+                    std::get< 1 >( aabb.closest_element( barycenter ) );
+                if( narrow_band )
+                {
+                    distances[cell] =
+                        std::min( distances[cell], narrow_band.value() );
+                }
+            } );
+        for( const auto& run :
+            rasterize_closed_surface_runs( grid, closed_surface ) )
+        {
+            const auto first = grid.cell_index( run.first_cell );
+            for( const auto cell : Range{ first, first + run.nb_cells } )
+            {
+                distances[cell] = -std::fabs( distances[cell] );
+            }
+        }
+        return distance_map;
+    }
+} // namespace geode
@@ -28,6 +28,7 @@
 #include <geode/basic/algorithm.hpp>
 
 #include <geode/mesh/core/detail/vertex_cycle.hpp>
+#include <geode/mesh/core/mesh_element_ranges.hpp>
 
 #include <geode/model/helpers/component_mesh_edges.hpp>
 #include <geode/model/helpers/component_mesh_vertices.hpp>
@@ -66,7 +67,7 @@ namespace
         for( const auto polygon_vertex_id :
             geode::LIndices{ facet_unique_vertices } )
         {
-            for( const auto& cmv : model.component_mesh_vertices(
+            for( const auto& cmv : model.component_mesh_vertices_range(
                      facet_unique_vertices[polygon_vertex_id] ) )
             {
                 if( cmv.component_id.id() == block.id() )
@@ -302,7 +303,7 @@ namespace
             surface_edge_from_unique_vertices;
         for( const auto edge_vertex_id : geode::LRange{ 2 } )
         {
-            for( const auto& cmv : model.component_mesh_vertices(
+            for( const auto& cmv : model.component_mesh_vertices_range(
                      edge_unique_vertices[edge_vertex_id] ) )
             {
                 if( cmv.component_id.id() == surface.id() )
@@ -552,22 +553,55 @@ namespace
         }
     }
 
+    /*!
+     * Check if a polygon is made of the given sorted vertices, without
+     * building its vertex list. Each given vertex should be matched once,
+     * so that degenerated polygons do not match.
+     */
+    template < geode::index_t dimension, typename SortedVertices >
+    bool is_polygon_on_vertices( const geode::SurfaceMesh< dimension >& mesh,
+        geode::index_t polygon_id,
+        const SortedVertices& sorted_vertices )
+    {
+        if( mesh.nb_polygon_vertices( polygon_id ) != sorted_vertices.size() )
+        {
+            return false;
+        }
+        absl::InlinedVector< bool, 4 > matched( sorted_vertices.size(), false );
+        for( const auto vertex_id :
+            geode::PolygonVerticesRange{ mesh, polygon_id } )
+        {
+            const auto it = absl::c_lower_bound( sorted_vertices, vertex_id );
+            if( it == sorted_vertices.end() || *it != vertex_id )
+            {
+                return false;
+            }
+            const auto position = std::distance( sorted_vertices.begin(), it );
+            if( matched[position] )
+            {
+                return false;
+            }
+            matched[position] = true;
+        }
+        return true;
+    }
+
     template < typename Model >
     geode::ComponentMeshVertexGeneric< 3 > model_polygon_pairs(
         const Model& model,
         const geode::PolygonVertices& polygon_unique_vertices,
         const geode::ComponentType& type )
     {
-        std::vector< absl::Span< const geode::ComponentMeshVertex > >
+        absl::InlinedVector< geode::ComponentMeshVerticesRange, 4 >
             unique_vertices;
         unique_vertices.reserve( polygon_unique_vertices.size() );
         for( const auto polygon_unique_vertex : polygon_unique_vertices )
         {
             unique_vertices.emplace_back(
-                model.component_mesh_vertices( polygon_unique_vertex ) );
+                model.component_mesh_vertices_range( polygon_unique_vertex ) );
         }
         return geode::component_mesh_vertex_generic< 3 >(
-            unique_vertices, type );
+            absl::MakeConstSpan( unique_vertices ), type );
     }
 
     template < typename Model >
@@ -632,10 +666,8 @@ namespace geode
                     for( const auto& polygon_vertex :
                         mesh.polygons_around_vertex( pair[0] ) )
                     {
-                        auto vertices =
-                            mesh.polygon_vertices( polygon_vertex.polygon_id );
-                        absl::c_sort( vertices );
-                        if( absl::c_equal( pair, vertices ) )
+                        if( is_polygon_on_vertices(
+                                mesh, polygon_vertex.polygon_id, pair ) )
                         {
                             polygons[surface.id()].emplace_back(
                                 polygon_vertex.polygon_id );
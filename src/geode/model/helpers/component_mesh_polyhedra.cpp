@@ -23,7 +23,6 @@
 
 #include <geode/model/helpers/component_mesh_polyhedra.hpp>
 
-#include <functional>
 #include <vector>
 
 #include <absl/container/inlined_vector.h>
@@ -43,8 +42,7 @@ namespace
     {
     public:
         PolyhedronVerticesPossibilities(
-            absl::Span< const std::reference_wrapper<
-                const std::vector< geode::ComponentMeshVertex > > >
+            absl::Span< const geode::ComponentMeshVerticesRange >
                 unique_vertices_cmvs )
             : unique_vertices_cmvs_{ unique_vertices_cmvs },
               nb_unique_vertices_{ static_cast< geode::local_index_t >(
@@ -61,13 +59,13 @@ namespace
             }
             for( const auto& cmvs : unique_vertices_cmvs_ )
             {
-                if( cmvs.get().empty() )
+                if( cmvs.empty() )
                 {
                     return {};
                 }
             }
             common_block_vertices_list_.clear();
-            for( const auto& first_cmv : unique_vertices_cmvs_[0].get() )
+            for( const auto& first_cmv : unique_vertices_cmvs_[0] )
             {
                 if( first_cmv.component_id.type()
                     != geode::Block3D::component_type_static() )
@@ -88,7 +86,7 @@ namespace
 
     private:
         absl::FixedArray< std::vector< geode::index_t > > block_mesh_vertices(
-            const geode::ComponentMeshVertex& first_cmv )
+            const geode::ComponentMeshVertexRef& first_cmv )
         {
             const auto& first_cmv_block_id = first_cmv.component_id.id();
             absl::FixedArray< std::vector< geode::index_t > > mesh_vertices(
@@ -98,7 +96,7 @@ namespace
                 geode::LRange{ 1, nb_unique_vertices_ } )
             {
                 for( const auto& other_cmv :
-                    unique_vertices_cmvs_[other_cmv_list_id].get() )
+                    unique_vertices_cmvs_[other_cmv_list_id] )
                 {
                     if( first_cmv_block_id == other_cmv.component_id.id() )
                     {
@@ -136,8 +134,7 @@ namespace
         }
 
     private:
-        absl::Span< const std::reference_wrapper<
-            const std::vector< geode::ComponentMeshVertex > > >
+        absl::Span< const geode::ComponentMeshVerticesRange >
             unique_vertices_cmvs_;
         const geode::local_index_t nb_unique_vertices_;
         std::vector< std::pair< geode::uuid, geode::PolyhedronVertices > >
@@ -166,14 +163,13 @@ namespace geode
     std::vector< MeshElement > component_mesh_polyhedra(
         const BRep& brep, const PolyhedronVertices& unique_vertices )
     {
-        std::vector<
-            std::reference_wrapper< const std::vector< ComponentMeshVertex > > >
+        absl::InlinedVector< ComponentMeshVerticesRange, 8 >
             unique_vertices_cmvs;
         unique_vertices_cmvs.reserve( unique_vertices.size() );
         for( const auto unique_vertex : unique_vertices )
         {
             unique_vertices_cmvs.emplace_back(
-                brep.component_mesh_vertices( unique_vertex ) );
+                brep.component_mesh_vertices_range( unique_vertex ) );
         }
         std::vector< MeshElement > result;
         PolyhedronVerticesPossibilities vertices_pair_computer{
@@ -27,14 +27,15 @@
 
 namespace
 {
-
-    template < geode::index_t dimension, typename Compare >
+    template < geode::index_t dimension,
+        typename UniqueVertices,
+        typename Vertex,
+        typename Compare >
     void recursive_compare_unique_vertices( geode::index_t index,
         geode::ComponentMeshVertexGeneric< dimension >& result,
         geode::ComponentMeshVertexGenericStorage< dimension >& current_result,
-        const geode::ComponentMeshVertex& previous,
-        absl::Span< const absl::Span< const geode::ComponentMeshVertex > >
-            unique_vertices,
+        const Vertex& previous,
+        absl::Span< const UniqueVertices > unique_vertices,
         const Compare& compare )
     {
         if( index == unique_vertices.size() )
@@ -52,27 +53,27 @@ namespace
                     "different" );
                 auto temp_result = current_result;
                 temp_result[index] = cmv.vertex;
-                recursive_compare_unique_vertices< dimension, Compare >(
-                    index + 1, result, temp_result, cmv, unique_vertices,
-                    compare );
+                recursive_compare_unique_vertices< dimension >( index + 1,
+                    result, temp_result, cmv, unique_vertices, compare );
             }
         }
     }
 
-    template < geode::index_t dimension, typename Compare >
+    template < geode::index_t dimension,
+        typename UniqueVertices,
+        typename Compare >
     geode::ComponentMeshVertexGeneric< dimension >
         component_mesh_vertex_generic(
-            absl::Span< const absl::Span< const geode::ComponentMeshVertex > >
-                unique_vertices,
+            absl::Span< const UniqueVertices > unique_vertices,
             const Compare& compare )
     {
         if( unique_vertices.empty() )
         {
             return {};
         }
-        for( const auto& span : unique_vertices )
+        for( const auto& vertices : unique_vertices )
         {
-            if( span.empty() )
+            if( vertices.empty() )
             {
                 return {};
             }
@@ -83,11 +84,35 @@ namespace
             geode::ComponentMeshVertexGenericStorage< dimension >
                 current_result{ cmv.vertex };
             current_result.resize( unique_vertices.size() );
-            recursive_compare_unique_vertices< dimension, Compare >(
+            recursive_compare_unique_vertices< dimension >(
                 1, result, current_result, cmv, unique_vertices, compare );
         }
         return result;
     }
+
+    template < geode::index_t dimension, typename UniqueVertices >
+    geode::ComponentMeshVertexGeneric< dimension >
+        component_mesh_vertex_generic(
+            absl::Span< const UniqueVertices > unique_vertices )
+    {
+        return component_mesh_vertex_generic< dimension >(
+            unique_vertices, []( const auto& cmv0, const auto& cmv1 ) {
+                return cmv0.component_id == cmv1.component_id;
+            } );
+    }
+
+    template < geode::index_t dimension, typename UniqueVertices >
+    geode::ComponentMeshVertexGeneric< dimension >
+        component_mesh_vertex_generic(
+            absl::Span< const UniqueVertices > unique_vertices,
+            const geode::ComponentType& type )
+    {
+        return component_mesh_vertex_generic< dimension >( unique_vertices,
+            [&type]( const auto& cmv0, const auto& cmv1 ) {
+                return cmv0.component_id.type() == type
+                       && cmv0.component_id == cmv1.component_id;
+            } );
+    }
 } // namespace
 
 namespace geode
@@ -96,13 +121,9 @@ namespace geode
         absl::Span< const ComponentMeshVertex > unique_vertices0,
         absl::Span< const ComponentMeshVertex > unique_vertices1 )
     {
-        return ::component_mesh_vertex_generic< 2 >(
+        return ::component_mesh_vertex_generic< 2 >( absl::MakeConstSpan(
             to_array< absl::Span< const ComponentMeshVertex > >(
-                unique_vertices0, unique_vertices1 ),
-            []( const ComponentMeshVertex& cmv0,
-                const ComponentMeshVertex& cmv1 ) {
-                return cmv0.component_id == cmv1.component_id;
-            } );
+                unique_vertices0, unique_vertices1 ) ) );
     }
 
     ComponentMeshVertexPairs component_mesh_vertex_pairs(
@@ -111,13 +132,30 @@ namespace geode
         const ComponentType& type )
     {
         return ::component_mesh_vertex_generic< 2 >(
-            to_array< absl::Span< const ComponentMeshVertex > >(
-                unique_vertices0, unique_vertices1 ),
-            [type]( const ComponentMeshVertex& cmv0,
-                const ComponentMeshVertex& cmv1 ) {
-                return cmv0.component_id.type() == type
-                       && cmv0.component_id == cmv1.component_id;
-            } );
+            absl::MakeConstSpan(
+                to_array< absl::Span< const ComponentMeshVertex > >(
+                    unique_vertices0, unique_vertices1 ) ),
+            type );
+    }
+
+    ComponentMeshVertexPairs component_mesh_vertex_pairs(
+        const ComponentMeshVerticesRange& unique_vertices0,
+        const ComponentMeshVerticesRange& unique_vertices1 )
+    {
+        return ::component_mesh_vertex_generic< 2 >( absl::MakeConstSpan(
+            to_array< ComponentMeshVerticesRange >(
+                unique_vertices0, unique_vertices1 ) ) );
+    }
+
+    ComponentMeshVertexPairs component_mesh_vertex_pairs(
+        const ComponentMeshVerticesRange& unique_vertices0,
+        const ComponentMeshVerticesRange& unique_vertices1,
+        const ComponentType& type )
+    {
+        return ::component_mesh_vertex_generic< 2 >(
+            absl::MakeConstSpan( to_array< ComponentMeshVerticesRange >(
+                unique_vertices0, unique_vertices1 ) ),
+            type );
     }
 
     ComponentMeshVertexTriplets component_mesh_vertex_triplets(
@@ -125,13 +163,9 @@ namespace geode
         absl::Span< const ComponentMeshVertex > unique_vertices1,
         absl::Span< const ComponentMeshVertex > unique_vertices2 )
     {
-        return ::component_mesh_vertex_generic< 3 >(
+        return ::component_mesh_vertex_generic< 3 >( absl::MakeConstSpan(
             to_array< absl::Span< const ComponentMeshVertex > >(
-                unique_vertices0, unique_vertices1, unique_vertices2 ),
-            []( const ComponentMeshVertex& cmv0,
-                const ComponentMeshVertex& cmv1 ) {
-                return cmv0.component_id == cmv1.component_id;
-            } );
+                unique_vertices0, unique_vertices1, unique_vertices2 ) ) );
     }
 
     ComponentMeshVertexTriplets component_mesh_vertex_triplets(
@@ -141,41 +175,66 @@ namespace geode
         const ComponentType& type )
     {
         return ::component_mesh_vertex_generic< 3 >(
-            to_array< absl::Span< const ComponentMeshVertex > >(
-                unique_vertices0, unique_vertices1, unique_vertices2 ),
-            [type]( const ComponentMeshVertex& cmv0,
-                const ComponentMeshVertex& cmv1 ) {
-                return cmv0.component_id.type() == type
-                       && cmv0.component_id == cmv1.component_id;
-            } );
+            absl::MakeConstSpan(
+                to_array< absl::Span< const ComponentMeshVertex > >(
+                    unique_vertices0, unique_vertices1, unique_vertices2 ) ),
+            type );
     }
 
-    template < geode::index_t dimension >
-    geode::ComponentMeshVertexGeneric< dimension >
-        component_mesh_vertex_generic(
-            absl::Span< const absl::Span< const geode::ComponentMeshVertex > >
-                unique_vertices )
+    ComponentMeshVertexTriplets component_mesh_vertex_triplets(
+        const ComponentMeshVerticesRange& unique_vertices0,
+        const ComponentMeshVerticesRange& unique_vertices1,
+        const ComponentMeshVerticesRange& unique_vertices2 )
+    {
+        return ::component_mesh_vertex_generic< 3 >(
+            absl::MakeConstSpan( to_array< ComponentMeshVerticesRange >(
+                unique_vertices0, unique_vertices1, unique_vertices2 ) ) );
+    }
+
+    ComponentMeshVertexTriplets component_mesh_vertex_triplets(
+        const ComponentMeshVerticesRange& unique_vertices0,
+        const ComponentMeshVerticesRange& unique_vertices1,
+        const ComponentMeshVerticesRange& unique_vertices2,
+        const ComponentType& type )
+    {
+        return ::component_mesh_vertex_generic< 3 >(
+            absl::MakeConstSpan( to_array< ComponentMeshVerticesRange >(
+                unique_vertices0, unique_vertices1, unique_vertices2 ) ),
+            type );
+    }
+
+    template < index_t dimension >
+    ComponentMeshVertexGeneric< dimension > component_mesh_vertex_generic(
+        absl::Span< const absl::Span< const ComponentMeshVertex > >
+            unique_vertices )
+    {
+        return ::component_mesh_vertex_generic< dimension >( unique_vertices );
+    }
+
+    template < index_t dimension >
+    ComponentMeshVertexGeneric< dimension > component_mesh_vertex_generic(
+        absl::Span< const absl::Span< const ComponentMeshVertex > >
+            unique_vertices,
+        const ComponentType& type )
     {
         return ::component_mesh_vertex_generic< dimension >(
-            unique_vertices, []( const ComponentMeshVertex& cmv0,
-                                 const ComponentMeshVertex& cmv1 ) {
-                return cmv0.component_id == cmv1.component_id;
-            } );
+            unique_vertices, type );
     }
 
-    template < geode::index_t dimension >
-    geode::ComponentMeshVertexGeneric< dimension >
-        component_mesh_vertex_generic(
-            absl::Span< const absl::Span< const geode::ComponentMeshVertex > >
-                unique_vertices,
-            const ComponentType& type )
+    template < index_t dimension >
+    ComponentMeshVertexGeneric< dimension > component_mesh_vertex_generic(
+        absl::Span< const ComponentMeshVerticesRange > unique_vertices )
+    {
+        return ::component_mesh_vertex_generic< dimension >( unique_vertices );
+    }
+
+    template < index_t dimension >
+    ComponentMeshVertexGeneric< dimension > component_mesh_vertex_generic(
+        absl::Span< const ComponentMeshVerticesRange > unique_vertices,
+        const ComponentType& type )
     {
         return ::component_mesh_vertex_generic< dimension >(
-            unique_vertices, [type]( const ComponentMeshVertex& cmv0,
-                                 const ComponentMeshVertex& cmv1 ) {
-                return cmv0.component_id.type() == type
-                       && cmv0.component_id == cmv1.component_id;
-            } );
+            unique_vertices, type );
     }
 
     template ComponentMeshVertexGeneric< 2 >
@@ -200,4 +259,27 @@ namespace geode
         opengeode_model_api component_mesh_vertex_generic< 4 >(
             absl::Span< const absl::Span< const ComponentMeshVertex > >,
             const ComponentType& );
-} // namespace geode
\ No newline at end of file
+
+    template ComponentMeshVertexGeneric< 2 >
+        opengeode_model_api component_mesh_vertex_generic< 2 >(
+            absl::Span< const ComponentMeshVerticesRange > );
+    template ComponentMeshVertexGeneric< 3 >
+        opengeode_model_api component_mesh_vertex_generic< 3 >(
+            absl::Span< const ComponentMeshVerticesRange > );
+    template ComponentMeshVertexGeneric< 4 >
+        opengeode_model_api component_mesh_vertex_generic< 4 >(
+            absl::Span< const ComponentMeshVerticesRange > );
+
+    template ComponentMeshVertexGeneric< 2 >
+        opengeode_model_api component_mesh_vertex_generic< 2 >(
+            absl::Span< const ComponentMeshVerticesRange >,
+            const ComponentType& );
+    template ComponentMeshVertexGeneric< 3 >
+        opengeode_model_api component_mesh_vertex_generic< 3 >(
+            absl::Span< const ComponentMeshVerticesRange >,
+            const ComponentType& );
+    template ComponentMeshVertexGeneric< 4 >
+        opengeode_model_api component_mesh_vertex_generic< 4 >(
+            absl::Span< const ComponentMeshVerticesRange >,
+            const ComponentType& );
+} // namespace geode
@@ -262,7 +262,8 @@ namespace
             const auto line_pointid = line.mesh().edge_vertex( e_vertex );
             const auto uvertex_id =
                 brep_.unique_vertex( { line.component_id(), line_pointid } );
-            for( const auto& cmv : brep_.component_mesh_vertices( uvertex_id ) )
+            for( const auto& cmv :
+                brep_.component_mesh_vertices_range( uvertex_id ) )
             {
                 if( cmv.component_id.id() == surface.id() )
                 {
@@ -363,7 +364,8 @@ namespace
             const auto surf_pointid = surface.mesh().polygon_vertex( p_vertex );
             const auto uvertex_id =
                 brep_.unique_vertex( { surface.component_id(), surf_pointid } );
-            for( const auto& cmv : brep_.component_mesh_vertices( uvertex_id ) )
+            for( const auto& cmv :
+                brep_.component_mesh_vertices_range( uvertex_id ) )
             {
                 if( cmv.component_id.id() == block.id() )
                 {
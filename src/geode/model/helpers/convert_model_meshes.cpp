@@ -56,21 +56,6 @@ namespace
         return unique_vertices;
     }
 
-    template < typename Builder >
-    void set_unique_vertices( Builder& builder,
-        absl::Span< const geode::index_t > unique_vertices,
-        const geode::ComponentID& component_id )
-    {
-        for( const auto v : geode::Indices{ unique_vertices } )
-        {
-            if( unique_vertices[v] != geode::NO_ID )
-            {
-                builder.set_unique_vertex(
-                    { component_id, v }, unique_vertices[v] );
-            }
-        }
-    }
-
     template < typename Model >
     void do_convert_surface( const Model& model,
         typename Model::Builder& builder,
@@ -102,7 +87,7 @@ namespace
                 std::move( geode::convert_surface_mesh_into_polygonal_surface(
                     mesh ) ) );
         }
-        set_unique_vertices( builder, unique_vertices, surface.component_id() );
+        builder.set_unique_vertices( surface.component_id(), unique_vertices );
     }
 
     template < typename Model >
@@ -163,7 +148,7 @@ namespace
             builder.update_block_mesh(
                 block, std::move( hybrid_solid ).value() );
         }
-        set_unique_vertices( builder, unique_vertices, block.component_id() );
+        builder.set_unique_vertices( block.component_id(), unique_vertices );
     }
 } // namespace
 
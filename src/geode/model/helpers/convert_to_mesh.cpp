@@ -22,11 +22,15 @@
  */
 
 #include <memory>
+#include <numeric>
 
 #include <geode/model/helpers/convert_to_mesh.hpp>
 
+#include <absl/algorithm/container.h>
 #include <absl/container/flat_hash_map.h>
 
+#include <async++.h>
+
 #include <geode/basic/attribute.hpp>
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/logger.hpp>
@@ -38,6 +42,7 @@
 #include <geode/mesh/builder/edged_curve_builder.hpp>
 #include <geode/mesh/builder/solid_mesh_builder.hpp>
 #include <geode/mesh/builder/surface_mesh_builder.hpp>
+#include <geode/mesh/builder/tetrahedral_solid_builder.hpp>
 #include <geode/mesh/core/edged_curve.hpp>
 #include <geode/mesh/core/hybrid_solid.hpp>
 #include <geode/mesh/core/point_set.hpp>
@@ -64,6 +69,311 @@
 
 namespace
 {
+    constexpr geode::index_t CHUNK_SIZE{ 4096 };
+
+    /*!
+     * Flat storage of the element vertices of every component of a given
+     * type, expressed both as component mesh vertices and as model unique
+     * vertices.
+     * It is filled in two passes: elements and element vertices are first
+     * counted to compute the offset of each component, then all the
+     * components are filled in parallel, chunk by chunk.
+     */
+    template < typename Component >
+    class ComponentsElements
+    {
+        struct Chunk
+        {
+            geode::index_t component;
+            geode::index_t begin;
+            geode::index_t end;
+        };
+
+    public:
+        template < typename Model,
+            typename Components,
+            typename NbElements,
+            typename NbElementVertices,
+            typename ElementVertex >
+        ComponentsElements( const Model& model,
+            Components&& components,
+            const NbElements& nb_elements,
+            const NbElementVertices& nb_element_vertices,
+            const ElementVertex& element_vertex )
+        {
+            for( const auto& component : components )
+            {
+                components_.emplace_back( component );
+            }
+            count_elements( nb_elements );
+            count_element_vertices( nb_element_vertices );
+            fill_element_vertices( model, element_vertex );
+        }
+
+        geode::index_t nb_components() const
+        {
+            return components_.size();
+        }
+
+        const Component& component( geode::index_t component_id ) const
+        {
+            return components_[component_id].get();
+        }
+
+        geode::index_t nb_elements() const
+        {
+            return offsets_.back();
+        }
+
+        geode::index_t component_offset( geode::index_t component_id ) const
+        {
+            return offsets_[component_id];
+        }
+
+        geode::index_t nb_component_elements(
+            geode::index_t component_id ) const
+        {
+            return offsets_[component_id + 1] - offsets_[component_id];
+        }
+
+        geode::index_t nb_element_vertices() const
+        {
+            return element_ptr_.back();
+        }
+
+        absl::Span< const geode::index_t > element_unique_vertices(
+            geode::index_t element ) const
+        {
+            return absl::MakeConstSpan( unique_vertices_ )
+                .subspan( element_ptr_[element],
+                    element_ptr_[element + 1] - element_ptr_[element] );
+        }
+
+        absl::Span< const geode::index_t > unique_vertices() const
+        {
+            return unique_vertices_;
+        }
+
+        geode::index_t flat_vertex_component(
+            geode::index_t flat_vertex ) const
+        {
+            const auto element =
+                std::upper_bound(
+                    element_ptr_.begin(), element_ptr_.end(), flat_vertex )
+                - element_ptr_.begin() - 1;
+            return std::upper_bound( offsets_.begin(), offsets_.end(),
+                       static_cast< geode::index_t >( element ) )
+                   - offsets_.begin() - 1;
+        }
+
+        geode::index_t flat_vertex_mesh_vertex(
+            geode::index_t flat_vertex ) const
+        {
+            return vertices_[flat_vertex];
+        }
+
+        template < typename Action >
+        void for_each_chunk( const Action& action ) const
+        {
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 },
+                    static_cast< geode::index_t >( chunks_.size() ) ),
+                [this, &action]( geode::index_t chunk_id ) {
+                    const auto& chunk = chunks_[chunk_id];
+                    action( chunk.component, chunk.begin, chunk.end );
+                } );
+        }
+
+    private:
+        template < typename NbElements >
+        void count_elements( const NbElements& nb_elements )
+        {
+            offsets_.resize( components_.size() + 1, 0 );
+            for( const auto c : geode::Indices{ components_ } )
+            {
+                const auto nb = nb_elements( components_[c].get().mesh() );
+                offsets_[c + 1] = offsets_[c] + nb;
+                for( geode::index_t begin{ 0 }; begin < nb;
+                     begin += CHUNK_SIZE )
+                {
+                    chunks_.push_back(
+                        { c, begin, std::min( begin + CHUNK_SIZE, nb ) } );
+                }
+            }
+        }
+
+        template < typename NbElementVertices >
+        void count_element_vertices(
+            const NbElementVertices& nb_element_vertices )
+        {
+            element_ptr_.resize( nb_elements() + 1, 0 );
+            for_each_chunk( [this, &nb_element_vertices](
+                                geode::index_t component_id,
+                                geode::index_t begin, geode::index_t end ) {
+                const auto& mesh = component( component_id ).mesh();
+                const auto offset = offsets_[component_id];
+                for( const auto e : geode::Range{ begin, end } )
+                {
+                    element_ptr_[offset + e + 1] =
+                        nb_element_vertices( mesh, e );
+                }
+            } );
+            std::partial_sum(
+                element_ptr_.begin(), element_ptr_.end(), element_ptr_.begin() );
+        }
+
+        template < typename Model, typename ElementVertex >
+        void fill_element_vertices(
+            const Model& model, const ElementVertex& element_vertex )
+        {
+            vertices_.resize( nb_element_vertices() );
+            unique_vertices_.resize( nb_element_vertices() );
+            for_each_chunk( [this, &model, &element_vertex](
+                                geode::index_t component_id,
+                                geode::index_t begin, geode::index_t end ) {
+                const auto& comp = component( component_id );
+                const auto& mesh = comp.mesh();
+                const auto offset = offsets_[component_id];
+                geode::ComponentMeshVertex component_vertex{
+                    comp.component_id(), geode::NO_ID
+                };
+                for( const auto e : geode::Range{ begin, end } )
+                {
+                    const auto ptr = element_ptr_[offset + e];
+                    const auto nb = element_ptr_[offset + e + 1] - ptr;
+                    for( const auto v : geode::LRange{ nb } )
+                    {
+                        component_vertex.vertex = element_vertex( mesh, e, v );
+                        vertices_[ptr + v] = component_vertex.vertex;
+                        unique_vertices_[ptr + v] =
+                            model.unique_vertex( component_vertex );
+                    }
+                }
+            } );
+        }
+
+    private:
+        std::vector< std::reference_wrapper< const Component > > components_;
+        std::vector< geode::index_t > offsets_;
+        std::vector< Chunk > chunks_;
+        std::vector< geode::index_t > element_ptr_;
+        std::vector< geode::index_t > vertices_;
+        std::vector< geode::index_t > unique_vertices_;
+    };
+
+    template < typename Model >
+    ComponentsElements< geode::Line< Model::dim > > lines_elements(
+        const Model& model )
+    {
+        return { model, model.lines(),
+            []( const geode::EdgedCurve< Model::dim >& mesh ) {
+                return mesh.nb_edges();
+            },
+            []( const geode::EdgedCurve< Model::dim >& /*unused*/,
+                geode::index_t /*unused*/ ) {
+                return geode::index_t{ 2 };
+            },
+            []( const geode::EdgedCurve< Model::dim >& mesh, geode::index_t e,
+                geode::local_index_t v ) {
+                return mesh.edge_vertex( { e, v } );
+            } };
+    }
+
+    template < typename Model >
+    ComponentsElements< geode::Surface< Model::dim > > surfaces_elements(
+        const Model& model )
+    {
+        return { model, model.surfaces(),
+            []( const geode::SurfaceMesh< Model::dim >& mesh ) {
+                return mesh.nb_polygons();
+            },
+            []( const geode::SurfaceMesh< Model::dim >& mesh,
+                geode::index_t p ) {
+                return static_cast< geode::index_t >(
+                    mesh.nb_polygon_vertices( p ) );
+            },
+            []( const geode::SurfaceMesh< Model::dim >& mesh, geode::index_t p,
+                geode::local_index_t v ) {
+                return mesh.polygon_vertex( { p, v } );
+            } };
+    }
+
+    ComponentsElements< geode::Block3D > blocks_elements(
+        const geode::BRep& brep )
+    {
+        return { brep, brep.blocks(),
+            []( const geode::SolidMesh3D& mesh ) {
+                return mesh.nb_polyhedra();
+            },
+            []( const geode::SolidMesh3D& mesh, geode::index_t p ) {
+                return static_cast< geode::index_t >(
+                    mesh.nb_polyhedron_vertices( p ) );
+            },
+            []( const geode::SolidMesh3D& mesh, geode::index_t p,
+                geode::local_index_t v ) {
+                return mesh.polyhedron_vertex( { p, v } );
+            } };
+    }
+
+    /*!
+     * Create the mesh vertices in the order of their first appearance in the
+     * component elements and set their coordinates in parallel.
+     * @return The mesh vertex of each element vertex.
+     */
+    template < typename Component, typename Builder >
+    std::vector< geode::index_t > create_mesh_vertices(
+        const ComponentsElements< Component >& elements,
+        geode::index_t nb_unique_vertices,
+        Builder& builder,
+        geode::ModelToMeshMappings& model2mesh )
+    {
+        const auto unique_vertices = elements.unique_vertices();
+        absl::FixedArray< geode::index_t > unique2mesh(
+            nb_unique_vertices, geode::NO_ID );
+        std::vector< geode::index_t > first_flat_vertex;
+        for( const auto flat_vertex : geode::Indices{ unique_vertices } )
+        {
+            auto& mesh_vertex = unique2mesh[unique_vertices[flat_vertex]];
+            if( mesh_vertex == geode::NO_ID )
+            {
+                mesh_vertex = first_flat_vertex.size();
+                first_flat_vertex.push_back( flat_vertex );
+            }
+        }
+        const auto first_vertex =
+            builder.create_vertices( first_flat_vertex.size() );
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 },
+                static_cast< geode::index_t >( first_flat_vertex.size() ) ),
+            [&elements, &first_flat_vertex, &builder, first_vertex](
+                geode::index_t v ) {
+                const auto flat_vertex = first_flat_vertex[v];
+                const auto& mesh =
+                    elements
+                        .component(
+                            elements.flat_vertex_component( flat_vertex ) )
+                        .mesh();
+                builder.set_point( first_vertex + v,
+                    mesh.point(
+                        elements.flat_vertex_mesh_vertex( flat_vertex ) ) );
+            } );
+        model2mesh.unique_vertices_mapping.reserve( first_flat_vertex.size() );
+        for( const auto v : geode::Indices{ first_flat_vertex } )
+        {
+            model2mesh.unique_vertices_mapping.map(
+                unique_vertices[first_flat_vertex[v]], first_vertex + v );
+        }
+        std::vector< geode::index_t > mesh_vertices( unique_vertices.size() );
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 },
+                static_cast< geode::index_t >( unique_vertices.size() ) ),
+            [&mesh_vertices, &unique_vertices, &unique2mesh, first_vertex](
+                geode::index_t v ) {
+                mesh_vertices[v] = first_vertex + unique2mesh[unique_vertices[v]];
+            } );
+        return mesh_vertices;
+    }
+
     template < typename Model >
     void map_corner_vertices(
         Model& model, geode::ModelToMeshMappings& model2mesh )
@@ -84,34 +394,20 @@ namespace
         geode::ModelToMeshMappings& model2mesh,
         geode::EdgedCurveBuilder< Model::dim >& mesh_builder )
     {
-        for( const auto& line : model.lines() )
+        const auto lines = lines_elements( model );
+        const auto vertices = create_mesh_vertices(
+            lines, model.nb_unique_vertices(), mesh_builder, model2mesh );
+        model2mesh.line_edges_mapping.reserve( lines.nb_elements() );
+        for( const auto l : geode::Range{ lines.nb_components() } )
         {
-            const auto& line_mesh = line.mesh();
-            for( const auto& edge_id : geode::Range{ line_mesh.nb_edges() } )
+            const auto& line = lines.component( l );
+            const auto offset = lines.component_offset( l );
+            for( const auto edge_id :
+                geode::Range{ lines.nb_component_elements( l ) } )
             {
-                std::array< geode::index_t, 2 > vertices;
-                for( const auto edge_vertex_id : geode::LRange{ 2 } )
-                {
-                    const auto vertex =
-                        line_mesh.edge_vertex( { edge_id, edge_vertex_id } );
-                    const auto unique_vertex =
-                        model.unique_vertex( { line.component_id(), vertex } );
-                    if( model2mesh.unique_vertices_mapping.has_mapping_input(
-                            unique_vertex ) )
-                    {
-                        vertices[edge_vertex_id] =
-                            model2mesh.unique_vertices_mapping.in2out(
-                                unique_vertex );
-                        continue;
-                    }
-                    const auto new_vertex_index =
-                        mesh_builder.create_point( line_mesh.point( vertex ) );
-                    vertices[edge_vertex_id] = new_vertex_index;
-                    model2mesh.unique_vertices_mapping.map(
-                        unique_vertex, new_vertex_index );
-                }
-                const auto edge_index =
-                    mesh_builder.create_edge( vertices[0], vertices[1] );
+                const auto flat_edge = 2 * ( offset + edge_id );
+                const auto edge_index = mesh_builder.create_edge(
+                    vertices[flat_edge], vertices[flat_edge + 1] );
                 model2mesh.line_edges_mapping.map(
                     { line.id(), edge_id }, edge_index );
             }
@@ -143,8 +439,7 @@ namespace
     }
 
     template < geode::index_t dim >
-    void set_polygons_surface_adjacencies(
-        const absl::FixedArray< geode::index_t >& polygons,
+    void set_polygons_surface_adjacencies( geode::index_t polygons_offset,
         const geode::SurfaceMesh< dim >& surface_mesh,
         geode::SurfaceMeshBuilder< dim >& mesh_builder )
     {
@@ -158,8 +453,8 @@ namespace
                         { polygon_id, edge_id } ) )
                 {
                     mesh_builder.set_polygon_adjacent(
-                        { polygons[polygon_id], edge_id },
-                        polygons[adj.value()] );
+                        { polygons_offset + polygon_id, edge_id },
+                        polygons_offset + adj.value() );
                 }
             }
         }
@@ -170,45 +465,30 @@ namespace
         geode::SurfaceMeshBuilder< Model::dim >& mesh_builder,
         geode::ModelToMeshMappings& model2mesh )
     {
-        for( const auto& surface : model.surfaces() )
+        const auto surfaces = surfaces_elements( model );
+        const auto vertices = create_mesh_vertices(
+            surfaces, model.nb_unique_vertices(), mesh_builder, model2mesh );
+        model2mesh.surface_polygons_mapping.reserve( surfaces.nb_elements() );
+        for( const auto s : geode::Range{ surfaces.nb_components() } )
         {
-            const auto& surface_mesh = surface.mesh();
-            absl::FixedArray< geode::index_t > polygons(
-                surface_mesh.nb_polygons() );
+            const auto& surface = surfaces.component( s );
+            const auto offset = surfaces.component_offset( s );
             for( const auto polygon_id :
-                geode::Range{ surface_mesh.nb_polygons() } )
+                geode::Range{ surfaces.nb_component_elements( s ) } )
             {
-                absl::FixedArray< geode::index_t > polygon_vertices(
-                    surface_mesh.nb_polygon_vertices( polygon_id ) );
-                for( const auto polygon_vertex :
-                    geode::LIndices{ polygon_vertices } )
-                {
-                    const auto vertex = surface_mesh.polygon_vertex(
-                        { polygon_id, polygon_vertex } );
-                    const auto unique_vertex = model.unique_vertex(
-                        { surface.component_id(), vertex } );
-                    if( model2mesh.unique_vertices_mapping.has_mapping_input(
-                            unique_vertex ) )
-                    {
-                        polygon_vertices[polygon_vertex] =
-                            model2mesh.unique_vertices_mapping.in2out(
-                                unique_vertex );
-                        continue;
-                    }
-
-                    const auto new_vertex_index = mesh_builder.create_point(
-                        surface_mesh.point( vertex ) );
-                    polygon_vertices[polygon_vertex] = new_vertex_index;
-                    model2mesh.unique_vertices_mapping.map(
-                        unique_vertex, new_vertex_index );
-                }
-                polygons[polygon_id] =
-                    mesh_builder.create_polygon( polygon_vertices );
+                const auto flat_polygon = offset + polygon_id;
+                const auto polygon_vertices =
+                    surfaces.element_unique_vertices( flat_polygon );
+                const auto begin =
+                    polygon_vertices.data() - surfaces.unique_vertices().data();
+                const auto polygon_index = mesh_builder.create_polygon(
+                    absl::MakeConstSpan( vertices )
+                        .subspan( begin, polygon_vertices.size() ) );
                 model2mesh.surface_polygons_mapping.map(
-                    { surface.id(), polygon_id }, polygons[polygon_id] );
+                    { surface.id(), polygon_id }, polygon_index );
             }
             set_polygons_surface_adjacencies< Model::dim >(
-                polygons, surface_mesh, mesh_builder );
+                offset, surface.mesh(), mesh_builder );
         }
     }
 
@@ -217,24 +497,31 @@ namespace
         Model& model, geode::ModelToMeshMappings& model2mesh, MeshType& mesh )
     {
         mesh.enable_edges();
+        const auto& edges = mesh.edges();
         for( const auto& line : model.lines() )
         {
             const auto& line_mesh = line.mesh();
-            for( const auto line_edge : geode::Range{ line_mesh.nb_edges() } )
+            absl::FixedArray< geode::index_t > mesh_edges(
+                line_mesh.nb_edges() );
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, line_mesh.nb_edges() ),
+                [&model, &model2mesh, &edges, &line, &mesh_edges](
+                    geode::index_t line_edge ) {
+                    auto unique_vertices =
+                        geode::edge_unique_vertices( model, line, line_edge );
+                    for( auto& unique_vertex : unique_vertices )
+                    {
+                        unique_vertex =
+                            model2mesh.unique_vertices_mapping.in2out(
+                                unique_vertex );
+                    }
+                    mesh_edges[line_edge] =
+                        edges.edge_from_vertices( unique_vertices ).value();
+                } );
+            for( const auto line_edge : geode::Indices{ mesh_edges } )
             {
-                auto unique_vertices =
-                    geode::edge_unique_vertices( model, line, line_edge );
-                for( const auto edge_vertex_id :
-                    geode::LRange{ unique_vertices.size() } )
-                {
-                    unique_vertices[edge_vertex_id] =
-                        model2mesh.unique_vertices_mapping.in2out(
-                            unique_vertices[edge_vertex_id] );
-                }
-                const auto solid_edge =
-                    mesh.edges().edge_from_vertices( unique_vertices ).value();
                 model2mesh.line_edges_mapping.map(
-                    { line.id(), line_edge }, solid_edge );
+                    { line.id(), line_edge }, mesh_edges[line_edge] );
             }
         }
     }
@@ -265,8 +552,7 @@ namespace
         return std::make_pair( std::move( mesh ), std::move( model2mesh ) );
     }
 
-    void set_block_polyhedra_adjacencies(
-        const absl::FixedArray< geode::index_t >& polyhedra,
+    void set_block_polyhedra_adjacencies( geode::index_t polyhedra_offset,
         const geode::SolidMesh3D& block_mesh,
         geode::SolidMeshBuilder3D& mesh_builder )
     {
@@ -280,82 +566,123 @@ namespace
                         { polyhedron_id, polyhedron_facet } ) )
                 {
                     mesh_builder.set_polyhedron_adjacent(
-                        { polyhedra[polyhedron_id], polyhedron_facet },
-                        polyhedra[adj.value()] );
+                        { polyhedra_offset + polyhedron_id, polyhedron_facet },
+                        polyhedra_offset + adj.value() );
                 }
             }
         }
     }
 
-    void build_polyhedra_from_model( const geode::BRep& brep,
+    void create_solid_vertices( const geode::BRep& brep,
         geode::SolidMeshBuilder3D& mesh_builder,
         geode::ModelToMeshMappings& brep2mesh )
     {
-        for( const auto& block : brep.blocks() )
-        {
-            const auto& block_mesh = block.mesh();
-            absl::FixedArray< geode::index_t > polyhedra(
-                block_mesh.nb_polyhedra() );
-            for( const auto polyhedron_id :
-                geode::Range{ block_mesh.nb_polyhedra() } )
-            {
-                absl::FixedArray< geode::index_t > polyhedron_vertices(
-                    block_mesh.nb_polyhedron_vertices( polyhedron_id ) );
-                for( const auto polyhedron_vertex : geode::LRange{
-                         block_mesh.nb_polyhedron_vertices( polyhedron_id ) } )
+        mesh_builder.create_vertices( brep.nb_unique_vertices() );
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, brep.nb_unique_vertices() ),
+            [&brep, &mesh_builder]( geode::index_t unique_vertex ) {
+                for( const auto& cmv :
+                    brep.component_mesh_vertices_range( unique_vertex ) )
                 {
-                    const auto vertex = block_mesh.polyhedron_vertex(
-                        { polyhedron_id, polyhedron_vertex } );
-                    const auto unique_vertex =
-                        brep.unique_vertex( { block.component_id(), vertex } );
-                    if( brep2mesh.unique_vertices_mapping.has_mapping_input(
-                            unique_vertex ) )
+                    if( cmv.component_id.type()
+                        == geode::Block3D::component_type_static() )
                     {
-                        polyhedron_vertices[polyhedron_vertex] =
-                            brep2mesh.unique_vertices_mapping.in2out(
-                                unique_vertex );
-                        mesh_builder.set_point(
-                            polyhedron_vertices[polyhedron_vertex],
-                            block_mesh.point( vertex ) );
-                        continue;
+                        mesh_builder.set_point( unique_vertex,
+                            brep.block( cmv.component_id.id() )
+                                .mesh()
+                                .point( cmv.vertex ) );
+                        return;
                     }
-                    auto new_vertex_index =
-                        mesh_builder.create_point( block_mesh.point( vertex ) );
-                    polyhedron_vertices[polyhedron_vertex] = new_vertex_index;
-                    brep2mesh.unique_vertices_mapping.map(
-                        unique_vertex, new_vertex_index );
                 }
-                absl::FixedArray< std::vector< geode::local_index_t > >
-                    polyhedron_facet_vertices(
-                        block_mesh.nb_polyhedron_facets( polyhedron_id ) );
-                for( const auto polyhedron_facet : geode::LRange{
-                         block_mesh.nb_polyhedron_facets( polyhedron_id ) } )
+                throw geode::OpenGeodeException(
+                    "The model contains a vertex not in a block." );
+            } );
+        brep2mesh.unique_vertices_mapping.reserve( brep.nb_unique_vertices() );
+        for( const auto unique_vertex :
+            geode::Range{ brep.nb_unique_vertices() } )
+        {
+            brep2mesh.unique_vertices_mapping.map(
+                unique_vertex, unique_vertex );
+        }
+    }
+
+    void create_block_polyhedra(
+        const ComponentsElements< geode::Block3D >& blocks,
+        geode::SolidMeshBuilder3D& mesh_builder )
+    {
+        if( auto* tetrahedral_builder =
+                dynamic_cast< geode::TetrahedralSolidBuilder3D* >(
+                    &mesh_builder ) )
+        {
+            std::vector< std::array< geode::index_t, 4 > > tetrahedra(
+                blocks.nb_elements() );
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, blocks.nb_elements() ),
+                [&blocks, &tetrahedra]( geode::index_t tetrahedron ) {
+                    const auto vertices =
+                        blocks.element_unique_vertices( tetrahedron );
+                    absl::c_copy_n(
+                        vertices, 4, tetrahedra[tetrahedron].begin() );
+                } );
+            tetrahedral_builder->create_tetrahedra( tetrahedra );
+            return;
+        }
+        std::vector< std::vector< geode::local_index_t > >
+            polyhedron_facet_vertices;
+        for( const auto b : geode::Range{ blocks.nb_components() } )
+        {
+            const auto& block_mesh = blocks.component( b ).mesh();
+            const auto offset = blocks.component_offset( b );
+            for( const auto polyhedron_id :
+                geode::Range{ block_mesh.nb_polyhedra() } )
+            {
+                polyhedron_facet_vertices.resize(
+                    block_mesh.nb_polyhedron_facets( polyhedron_id ) );
+                for( const auto polyhedron_facet :
+                    geode::LIndices{ polyhedron_facet_vertices } )
                 {
+                    const geode::PolyhedronFacet facet{ polyhedron_id,
+                        polyhedron_facet };
                     auto& facet_vertices =
                         polyhedron_facet_vertices[polyhedron_facet];
                     facet_vertices.resize(
-                        block_mesh.nb_polyhedron_facet_vertices(
-                            { polyhedron_id, polyhedron_facet } ) );
+                        block_mesh.nb_polyhedron_facet_vertices( facet ) );
                     for( const auto polyhedron_facet_vertex :
-                        geode::LRange{ block_mesh.nb_polyhedron_facet_vertices(
-                            { polyhedron_id, polyhedron_facet } ) } )
+                        geode::LIndices{ facet_vertices } )
                     {
-                        const auto vertex = block_mesh.polyhedron_facet_vertex(
-                            { { polyhedron_id, polyhedron_facet },
-                                polyhedron_facet_vertex } );
                         facet_vertices[polyhedron_facet_vertex] =
                             block_mesh
-                                .vertex_in_polyhedron( polyhedron_id, vertex )
-                                .value();
+                                .polyhedron_facet_vertex_id(
+                                    { facet, polyhedron_facet_vertex } )
+                                .vertex_id;
                     }
                 }
-                polyhedra[polyhedron_id] = mesh_builder.create_polyhedron(
-                    polyhedron_vertices, polyhedron_facet_vertices );
+                mesh_builder.create_polyhedron(
+                    blocks.element_unique_vertices( offset + polyhedron_id ),
+                    polyhedron_facet_vertices );
+            }
+        }
+    }
+
+    void build_polyhedra_from_model( const geode::BRep& brep,
+        geode::SolidMeshBuilder3D& mesh_builder,
+        geode::ModelToMeshMappings& brep2mesh )
+    {
+        const auto blocks = blocks_elements( brep );
+        create_block_polyhedra( blocks, mesh_builder );
+        brep2mesh.solid_polyhedra_mapping.reserve( blocks.nb_elements() );
+        for( const auto b : geode::Range{ blocks.nb_components() } )
+        {
+            const auto& block = blocks.component( b );
+            const auto offset = blocks.component_offset( b );
+            for( const auto polyhedron_id :
+                geode::Range{ blocks.nb_component_elements( b ) } )
+            {
                 brep2mesh.solid_polyhedra_mapping.map(
-                    { block.id(), polyhedron_id }, polyhedra[polyhedron_id] );
+                    { block.id(), polyhedron_id }, offset + polyhedron_id );
             }
             set_block_polyhedra_adjacencies(
-                polyhedra, block_mesh, mesh_builder );
+                offset, block.mesh(), mesh_builder );
         }
     }
 
@@ -364,27 +691,32 @@ namespace
         geode::SolidMesh3D& mesh )
     {
         mesh.enable_facets();
+        const auto& facets = mesh.facets();
         for( const auto& surface : brep.surfaces() )
         {
             const auto& surface_mesh = surface.mesh();
-            for( const auto surface_polygon :
-                geode::Range{ surface_mesh.nb_polygons() } )
+            absl::FixedArray< geode::index_t > solid_facets(
+                surface_mesh.nb_polygons() );
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, surface_mesh.nb_polygons() ),
+                [&brep, &brep2mesh, &facets, &surface, &solid_facets](
+                    geode::index_t surface_polygon ) {
+                    auto unique_vertices = geode::polygon_unique_vertices(
+                        brep, surface, surface_polygon );
+                    for( auto& unique_vertex : unique_vertices )
+                    {
+                        unique_vertex =
+                            brep2mesh.unique_vertices_mapping.in2out(
+                                unique_vertex );
+                    }
+                    solid_facets[surface_polygon] =
+                        facets.facet_from_vertices( unique_vertices ).value();
+                } );
+            for( const auto surface_polygon : geode::Indices{ solid_facets } )
             {
-                auto unique_vertices = geode::polygon_unique_vertices(
-                    brep, surface, surface_polygon );
-                for( const auto polygon_vertex_id :
-                    geode::LRange{ unique_vertices.size() } )
-                {
-                    unique_vertices[polygon_vertex_id] =
-                        brep2mesh.unique_vertices_mapping.in2out(
-                            unique_vertices[polygon_vertex_id] );
-                }
-                const auto solid_facet =
-                    mesh.facets()
-                        .facet_from_vertices( unique_vertices )
-                        .value();
                 brep2mesh.surface_polygons_mapping.map(
-                    { surface.id(), surface_polygon }, solid_facet );
+                    { surface.id(), surface_polygon },
+                    solid_facets[surface_polygon] );
             }
         }
     }
@@ -429,21 +761,7 @@ namespace geode
         auto mesh = geode::detail::create_mesh< SolidMesh3D >( meshes );
         auto mesh_builder = geode::SolidMeshBuilder< 3 >::create( *mesh );
         ModelToMeshMappings brep2mesh;
-        for( const auto unique_vertex :
-            geode::Range{ brep.nb_unique_vertices() } )
-        {
-            OPENGEODE_EXCEPTION(
-                brep.has_component_mesh_vertices(
-                    unique_vertex, geode::Block3D::component_type_static() ),
-                "The model contains a vertex not in a block." );
-        }
-        for( const auto unique_vertex :
-            geode::Range{ brep.nb_unique_vertices() } )
-        {
-            const auto new_vertex_index = mesh_builder->create_vertex();
-            brep2mesh.unique_vertices_mapping.map(
-                unique_vertex, new_vertex_index );
-        }
+        create_solid_vertices( brep, *mesh_builder, brep2mesh );
         build_polyhedra_from_model( brep, *mesh_builder, brep2mesh );
         if( mesh->nb_polyhedra() != 0 )
         {
@@ -23,7 +23,17 @@
 
 #include <geode/model/helpers/model_concatener.hpp>
 
+#include <async++.h>
+
+#include <absl/container/fixed_array.h>
+
 #include <geode/basic/pimpl_impl.hpp>
+#include <geode/basic/range.hpp>
+
+#include <geode/mesh/core/edged_curve.hpp>
+#include <geode/mesh/core/point_set.hpp>
+#include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
 
 #include <geode/model/mixin/core/block.hpp>
 #include <geode/model/mixin/core/corner.hpp>
@@ -145,15 +155,139 @@ namespace geode
     public:
         Impl( Model& model ) : model_( model ), builder_{ model } {}
 
-        ModelCopyMapping concatenate( const Model& other_model )
+        std::vector< ModelCopyMapping > concatenate(
+            absl::Span< const std::reference_wrapper< const Model > >
+                other_models )
         {
-            auto mapping = builder_.copy_components( other_model );
-            builder_.copy_component_geometry( mapping, other_model );
-            copy_relationships( other_model, mapping );
-            return mapping;
+            std::vector< ModelCopyMapping > mappings;
+            mappings.reserve( other_models.size() );
+            for( const auto& other_model : other_models )
+            {
+                mappings.emplace_back(
+                    builder_.copy_components( other_model.get() ) );
+                copy_relationships( other_model.get(), mappings.back() );
+            }
+            copy_meshes( other_models, mappings );
+            copy_unique_vertices( other_models, mappings );
+            return mappings;
         }
 
     private:
+        template < typename Mesh >
+        using ClonedMeshes =
+            absl::FixedArray< std::pair< uuid, std::unique_ptr< Mesh > > >;
+
+        struct ModelMeshes
+        {
+            explicit ModelMeshes( const Model& other_model )
+                : corners{ detail::clone_meshes< PointSet< dimension > >(
+                      other_model.corners(), other_model.nb_corners() ) },
+                  lines{ detail::clone_meshes< EdgedCurve< dimension > >(
+                      other_model.lines(), other_model.nb_lines() ) },
+                  surfaces{ detail::clone_meshes< SurfaceMesh< dimension > >(
+                      other_model.surfaces(), other_model.nb_surfaces() ) },
+                  blocks{ clone_blocks( other_model ) }
+            {
+            }
+
+            static ClonedMeshes< SolidMesh3D > clone_blocks(
+                const Model& other_model )
+            {
+                if constexpr( dimension == 3 )
+                {
+                    return detail::clone_meshes< SolidMesh3D >(
+                        other_model.blocks(), other_model.nb_blocks() );
+                }
+                else
+                {
+                    return ClonedMeshes< SolidMesh3D >( 0 );
+                }
+            }
+
+            ClonedMeshes< PointSet< dimension > > corners;
+            ClonedMeshes< EdgedCurve< dimension > > lines;
+            ClonedMeshes< SurfaceMesh< dimension > > surfaces;
+            ClonedMeshes< SolidMesh3D > blocks;
+        };
+
+        /*!
+         * Meshes of all the models are cloned in parallel, then moved into
+         * the model components.
+         */
+        void copy_meshes(
+            absl::Span< const std::reference_wrapper< const Model > >
+                other_models,
+            absl::Span< const ModelCopyMapping > mappings )
+        {
+            absl::FixedArray< std::unique_ptr< ModelMeshes > > meshes(
+                other_models.size() );
+            async::parallel_for(
+                async::irange(
+                    index_t{ 0 }, static_cast< index_t >( meshes.size() ) ),
+                [&other_models, &meshes]( index_t m ) {
+                    meshes[m] =
+                        std::make_unique< ModelMeshes >( other_models[m].get() );
+                } );
+            for( const auto m : Indices{ meshes } )
+            {
+                const auto& mapping = mappings[m];
+                const auto& corners =
+                    mapping.at( Corner< dimension >::component_type_static() );
+                for( auto& corner : meshes[m]->corners )
+                {
+                    builder_.update_corner_mesh(
+                        model_.corner( corners.in2out( corner.first ) ),
+                        std::move( corner.second ) );
+                }
+                const auto& lines =
+                    mapping.at( Line< dimension >::component_type_static() );
+                for( auto& line : meshes[m]->lines )
+                {
+                    builder_.update_line_mesh(
+                        model_.line( lines.in2out( line.first ) ),
+                        std::move( line.second ) );
+                }
+                const auto& surfaces =
+                    mapping.at( Surface< dimension >::component_type_static() );
+                for( auto& surface : meshes[m]->surfaces )
+                {
+                    builder_.update_surface_mesh(
+                        model_.surface( surfaces.in2out( surface.first ) ),
+                        std::move( surface.second ) );
+                }
+                if constexpr( dimension == 3 )
+                {
+                    const auto& blocks = mapping.at(
+                        Block< dimension >::component_type_static() );
+                    for( auto& block : meshes[m]->blocks )
+                    {
+                        builder_.update_block_mesh(
+                            model_.block( blocks.in2out( block.first ) ),
+                            std::move( block.second ) );
+                    }
+                }
+                meshes[m].reset();
+            }
+        }
+
+        void copy_unique_vertices(
+            absl::Span< const std::reference_wrapper< const Model > >
+                other_models,
+            absl::Span< const ModelCopyMapping > mappings )
+        {
+            std::vector< detail::UniqueVerticesCopy > copies;
+            for( const auto m : Indices{ other_models } )
+            {
+                const auto& other_model = other_models[m].get();
+                const auto first_new_unique_vertex_id =
+                    builder_.create_unique_vertices(
+                        other_model.nb_unique_vertices() );
+                detail::add_model_unique_vertices_copies( other_model,
+                    mappings[m], first_new_unique_vertex_id, copies );
+            }
+            detail::copy_unique_vertices( copies, builder_ );
+        }
+
         void copy_relationships(
             const Model& other_model, const ModelCopyMapping& mapping );
 
@@ -256,7 +390,16 @@ namespace geode
     ModelCopyMapping ModelConcatener< Model >::concatenate(
         const Model& other_model )
     {
-        return impl_->concatenate( other_model );
+        const std::array< std::reference_wrapper< const Model >, 1 >
+            other_models{ { other_model } };
+        return std::move( impl_->concatenate( other_models ).front() );
+    }
+
+    template < typename Model >
+    std::vector< ModelCopyMapping > ModelConcatener< Model >::concatenate(
+        absl::Span< const std::reference_wrapper< const Model > > other_models )
+    {
+        return impl_->concatenate( other_models );
     }
 
     template class opengeode_model_api ModelConcatener< BRep >;
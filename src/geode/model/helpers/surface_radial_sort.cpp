@@ -97,8 +97,8 @@ namespace
     {
         const auto line_v0 = brep.unique_vertex( { line.component_id(), e0 } );
         const auto line_v1 = brep.unique_vertex( { line.component_id(), e1 } );
-        const auto& vertices0 = brep.component_mesh_vertices( line_v0 );
-        const auto& vertices1 = brep.component_mesh_vertices( line_v1 );
+        const auto vertices0 = brep.component_mesh_vertices_range( line_v0 );
+        const auto vertices1 = brep.component_mesh_vertices_range( line_v1 );
         std::vector< BorderPolygon > polygons;
         bool degenerate_polygon{ false };
         for( const auto& vertex_pairs :
@@ -48,6 +48,20 @@ namespace geode
             component_vertex_id, unique_vertex_id, {} );
     }
 
+    void VertexIdentifierBuilder::set_unique_vertices(
+        const ComponentID& component_id,
+        absl::Span< const index_t > unique_vertices )
+    {
+        vertex_identifier_.set_unique_vertices(
+            component_id, unique_vertices, {} );
+    }
+
+    void VertexIdentifierBuilder::set_unique_vertices(
+        absl::Span< const ComponentUniqueVertices > components_vertices )
+    {
+        vertex_identifier_.set_unique_vertices( components_vertices, {} );
+    }
+
     void VertexIdentifierBuilder::unset_unique_vertex(
         const ComponentMeshVertex& component_vertex_id,
         index_t unique_vertex_id )
@@ -30,6 +30,7 @@
 #include <geode/model/mixin/core/block_collection.hpp>
 #include <geode/model/mixin/core/corner.hpp>
 #include <geode/model/mixin/core/corner_collection.hpp>
+#include <geode/model/mixin/core/detail/compact_component_vertex.hpp>
 #include <geode/model/mixin/core/line.hpp>
 #include <geode/model/mixin/core/line_collection.hpp>
 #include <geode/model/mixin/core/model_boundary.hpp>
@@ -77,6 +78,9 @@ namespace
         geode::AttributeManager::register_attribute_type<
             std::vector< geode::ComponentMeshVertex >, Serializer >(
             context, "vector_MCV" );
+        geode::AttributeManager::register_attribute_type<
+            geode::detail::CompactComponentVertices, Serializer >(
+            context, "InlinedVector_CompactCV" );
         geode::AttributeManager::register_attribute_type< geode::ComponentID,
             Serializer >( context, "ComponentID" );
         context.registerBasesList< Serializer >(
@@ -1,9 +1,12 @@
 #include <geode/model/mixin/core/vertex_identifier.hpp>
 
 #include <fstream>
+#include <numeric>
 
 #include <async++.h>
 
+#include <absl/algorithm/container.h>
+#include <absl/container/fixed_array.h>
 #include <absl/container/flat_hash_map.h>
 
 #include <geode/basic/attribute_manager.hpp>
@@ -25,6 +28,8 @@
 #include <geode/model/mixin/core/bitsery_archive.hpp>
 #include <geode/model/mixin/core/block.hpp>
 #include <geode/model/mixin/core/corner.hpp>
+#include <geode/model/mixin/core/detail/compact_component_vertex.hpp>
+#include <geode/model/mixin/core/detail/uuid_to_index.hpp>
 #include <geode/model/mixin/core/line.hpp>
 #include <geode/model/mixin/core/surface.hpp>
 
@@ -68,15 +73,18 @@ namespace geode
     class VertexIdentifier::Impl
     {
         const std::string unique_vertices_name = "unique vertices";
+        using ComponentVertices = detail::CompactComponentVertices;
+        using LegacyComponentVertices = std::vector< ComponentMeshVertex >;
+        using LegacyVertex2UniqueVertex = absl::flat_hash_map< uuid,
+            std::shared_ptr< VariableAttribute< index_t > > >;
 
     public:
         Impl()
             : component_vertices_(
                   unique_vertices_.vertex_attribute_manager()
                       .find_or_create_attribute< VariableAttribute,
-                          std::vector< ComponentMeshVertex > >(
-                          "component vertices",
-                          std::vector< ComponentMeshVertex >{} ) )
+                          ComponentVertices >(
+                          "component mesh vertices", ComponentVertices{} ) )
         {
         }
 
@@ -87,33 +95,30 @@ namespace geode
 
         bool is_unique_vertex_isolated( index_t unique_vertex_id ) const
         {
-            return component_mesh_vertices( unique_vertex_id ).empty();
+            return compact_component_vertices( unique_vertex_id ).empty();
         }
 
-        const std::vector< ComponentMeshVertex >& component_mesh_vertices(
+        ComponentMeshVerticesRange component_mesh_vertices_range(
             index_t unique_vertex_id ) const
         {
-            OPENGEODE_ASSERT( unique_vertex_id < nb_unique_vertices(),
-                "[VertexIdentifier::component_mesh_vertices] Given "
-                "unique_vertex_id is bigger than the number of unique "
-                "vertices." );
-            return component_vertices_->value( unique_vertex_id );
+            return { compact_component_vertices( unique_vertex_id ),
+                components_ };
         }
 
         index_t unique_vertex(
             const uuid& component_id, const index_t vertex_id ) const
         {
-            return vertex2unique_vertex_.at( component_id )->value( vertex_id );
+            return vertex2unique_vertex_[component_index( component_id )]
+                ->value( vertex_id );
         }
 
         bool has_component_mesh_vertices(
             index_t unique_vertex_id, const ComponentType& type ) const
         {
-            const auto& component_vertices =
-                component_mesh_vertices( unique_vertex_id );
-            for( const auto& component_vertex : component_vertices )
+            for( const auto& compact_vertex :
+                compact_component_vertices( unique_vertex_id ) )
             {
-                if( component_vertex.component_id.type() == type )
+                if( components_[compact_vertex.component].type() == type )
                 {
                     return true;
                 }
@@ -124,42 +129,45 @@ namespace geode
         bool has_component_mesh_vertices(
             index_t unique_vertex_id, const uuid& component_id ) const
         {
-            for( const auto& component_vertex :
-                component_mesh_vertices( unique_vertex_id ) )
+            const auto component = component_indices_.index( component_id );
+            if( !component )
             {
-                if( component_vertex.component_id.id() == component_id )
-                {
-                    return true;
-                }
+                return false;
             }
-            return false;
+            return has_component_mesh_vertices(
+                unique_vertex_id, component.value() );
         }
 
         template < typename MeshComponent >
         void register_component( const MeshComponent& component )
         {
-            auto it = vertex2unique_vertex_.find( component.id() );
+            const auto index = component_indices_.index( component.id() );
             const auto& mesh = component.mesh();
-            if( it == vertex2unique_vertex_.end() )
+            if( !index )
             {
                 mesh.vertex_attribute_manager().delete_attribute(
                     unique_vertices_name );
-                vertex2unique_vertex_.emplace( component.id(),
+                component_indices_.set_new_mapping(
+                    component.id(), components_.size() );
+                components_.emplace_back( component.component_id() );
+                vertex2unique_vertex_.emplace_back(
                     mesh.vertex_attribute_manager()
                         .template find_or_create_attribute< VariableAttribute,
                             index_t >( unique_vertices_name, NO_ID ) );
             }
             else
             {
+                components_[index.value()] = component.component_id();
                 auto attribute =
                     mesh.vertex_attribute_manager()
                         .template find_or_create_attribute< VariableAttribute,
                             index_t >( unique_vertices_name, NO_ID );
+                auto& old_attribute = vertex2unique_vertex_[index.value()];
                 try
                 {
                     for( const auto v : Range{ mesh.nb_vertices() } )
                     {
-                        attribute->set_value( v, it->second->value( v ) );
+                        attribute->set_value( v, old_attribute->value( v ) );
                     }
                 }
                 catch( const std::out_of_range& )
@@ -168,7 +176,7 @@ namespace geode
                         "Registering MeshComponent: ", component.id().string(),
                         " in VertexIdentifier, wrong number of vertices." );
                 }
-                it->second = std::move( attribute );
+                old_attribute = std::move( attribute );
             }
         }
 
@@ -177,9 +185,11 @@ namespace geode
         {
             const auto& mesh = component.mesh();
             mesh.vertex_attribute_manager().delete_attribute(
-                "unique vertices" );
-            vertex2unique_vertex_.erase( component.id() );
-            filter_component_vertices( component.id() );
+                unique_vertices_name );
+            if( const auto index = component_indices_.index( component.id() ) )
+            {
+                remove_component( index.value() );
+            }
         }
 
         index_t create_unique_vertex()
@@ -194,31 +204,118 @@ namespace geode
                 ->create_vertices( nb );
         }
 
-        void set_unique_vertex( ComponentMeshVertex component_vertex_id,
+        void set_unique_vertex( const ComponentMeshVertex& component_vertex_id,
             const index_t unique_vertex_id )
         {
             OPENGEODE_ASSERT( unique_vertex_id < nb_unique_vertices(),
                 "[VertexIdentifier::set_unique_vertex] Unique vertex ",
                 unique_vertex_id, " does not exist (nb=", nb_unique_vertices(),
                 ")" );
-            const auto& old_unique_id =
-                vertex2unique_vertex_
-                    .at( component_vertex_id.component_id.id() )
-                    ->value( component_vertex_id.vertex );
-            if( old_unique_id != NO_ID )
+            set_unique_vertex(
+                component_index( component_vertex_id.component_id.id() ),
+                component_vertex_id.vertex, unique_vertex_id );
+        }
+
+        void set_unique_vertices( const ComponentID& component_id,
+            absl::Span< const index_t > unique_vertices )
+        {
+            const std::array< ComponentUniqueVertices, 1 > components_vertices{
+                { { component_id, unique_vertices } }
+            };
+            set_unique_vertices( components_vertices );
+        }
+
+        void set_unique_vertices(
+            absl::Span< const ComponentUniqueVertices > components_vertices )
+        {
+            const auto components =
+                checked_components_unique_vertices( components_vertices );
+            absl::FixedArray< std::vector< std::pair< index_t, index_t > > >
+                changes( components_vertices.size() );
+            async::parallel_for(
+                async::irange( index_t{ 0 },
+                    static_cast< index_t >( components_vertices.size() ) ),
+                [this, &components_vertices, &components, &changes](
+                    index_t c ) {
+                    changes[c] = update_component_unique_vertices(
+                        components[c], components_vertices[c].unique_vertices );
+                } );
+            const auto nb_uv = nb_unique_vertices();
+            std::vector< index_t > removed_offsets( nb_uv + 1, 0 );
+            std::vector< index_t > added_offsets( nb_uv + 1, 0 );
+            for( const auto c : Indices{ components_vertices } )
             {
-                unset_unique_vertex( component_vertex_id, old_unique_id );
+                const auto unique_vertices =
+                    components_vertices[c].unique_vertices;
+                for( const auto& [vertex, old_unique_vertex] : changes[c] )
+                {
+                    if( old_unique_vertex != NO_ID )
+                    {
+                        removed_offsets[old_unique_vertex + 1]++;
+                    }
+                    if( unique_vertices[vertex] != NO_ID )
+                    {
+                        added_offsets[unique_vertices[vertex] + 1]++;
+                    }
+                }
             }
-            vertex2unique_vertex_.at( component_vertex_id.component_id.id() )
-                ->set_value( component_vertex_id.vertex, unique_vertex_id );
-            component_vertices_->modify_value( unique_vertex_id,
-                [&component_vertex_id](
-                    std::vector< ComponentMeshVertex >& value ) {
-                    if( absl::c_find( value, component_vertex_id )
-                        == value.end() )
+            std::partial_sum( removed_offsets.begin(), removed_offsets.end(),
+                removed_offsets.begin() );
+            std::partial_sum( added_offsets.begin(), added_offsets.end(),
+                added_offsets.begin() );
+            std::vector< detail::CompactComponentVertex > removed(
+                removed_offsets.back() );
+            std::vector< detail::CompactComponentVertex > added(
+                added_offsets.back() );
+            auto removed_fill = removed_offsets;
+            auto added_fill = added_offsets;
+            for( const auto c : Indices{ components_vertices } )
+            {
+                const auto unique_vertices =
+                    components_vertices[c].unique_vertices;
+                for( const auto& [vertex, old_unique_vertex] : changes[c] )
+                {
+                    if( old_unique_vertex != NO_ID )
+                    {
+                        removed[removed_fill[old_unique_vertex]++] = {
+                            components[c], vertex
+                        };
+                    }
+                    if( unique_vertices[vertex] != NO_ID )
                     {
-                        value.emplace_back( std::move( component_vertex_id ) );
+                        added[added_fill[unique_vertices[vertex]]++] = {
+                            components[c], vertex
+                        };
                     }
+                }
+            }
+            async::parallel_for( async::irange( index_t{ 0 }, nb_uv ),
+                [this, &removed_offsets, &added_offsets, &removed, &added](
+                    index_t uv ) {
+                    const absl::Span< const detail::CompactComponentVertex >
+                        uv_removed{ removed.data() + removed_offsets[uv],
+                            removed_offsets[uv + 1] - removed_offsets[uv] };
+                    const absl::Span< const detail::CompactComponentVertex >
+                        uv_added{ added.data() + added_offsets[uv],
+                            added_offsets[uv + 1] - added_offsets[uv] };
+                    if( uv_removed.empty() && uv_added.empty() )
+                    {
+                        return;
+                    }
+                    component_vertices_->modify_value( uv,
+                        [&uv_removed, &uv_added]( ComponentVertices& value ) {
+                            for( const auto& compact_vertex : uv_removed )
+                            {
+                                const auto it =
+                                    absl::c_find( value, compact_vertex );
+                                if( it != value.end() )
+                                {
+                                    value.erase( it );
+                                }
+                            }
+                            value.insert(
+                                value.end(), uv_added.begin(), uv_added.end() );
+                        } );
                 } );
         }
 
@@ -226,74 +323,58 @@ namespace geode
             const ComponentMeshVertex& component_vertex_id,
             const index_t unique_vertex_id )
         {
-            vertex2unique_vertex_.at( component_vertex_id.component_id.id() )
-                ->set_value( component_vertex_id.vertex, NO_ID );
-            const auto& vertices =
-                component_vertices_->value( unique_vertex_id );
-            const auto it = absl::c_find( vertices, component_vertex_id );
-            if( it == vertices.end() )
-            {
-                return;
-            }
-            component_vertices_->modify_value( unique_vertex_id,
-                [&it]( std::vector< ComponentMeshVertex >& value ) {
-                    value.erase(
-                        // workaround for gcc < 4.9
-                        value.begin() + ( it - value.cbegin() ) );
-                } );
+            const auto component =
+                component_index( component_vertex_id.component_id.id() );
+            vertex2unique_vertex_[component]->set_value(
+                component_vertex_id.vertex, NO_ID );
+            remove_component_vertex(
+                unique_vertex_id, { component, component_vertex_id.vertex } );
         }
 
         void update_unique_vertices( const ComponentID& component_id,
             absl::Span< const index_t > old2new )
         {
+            const auto index = component_indices_.index( component_id.id() );
+            if( !index )
+            {
+                return;
+            }
+            const auto component = index.value();
             async::parallel_for(
                 async::irange( index_t{ 0 }, nb_unique_vertices() ),
-                [this, &component_id, &old2new]( index_t uv ) {
-                    if( !has_component_mesh_vertices( uv, component_id.id() ) )
+                [this, component, &old2new]( index_t uv ) {
+                    if( !has_component_mesh_vertices( uv, component ) )
                     {
                         return;
                     }
-                    const auto& all_vertices = component_vertices_->value( uv );
-                    std::vector< bool > to_delete( all_vertices.size(), false );
-                    bool need_to_delete{ false };
-                    for( const auto v : Indices{ all_vertices } )
-                    {
-                        const auto& cmv = all_vertices[v];
-                        if( cmv.component_id.id() != component_id.id() )
-                        {
-                            continue;
-                        }
-                        const auto new_id = old2new[cmv.vertex];
-                        if( new_id == NO_ID )
-                        {
-                            to_delete[v] = true;
-                            need_to_delete = true;
-                        }
-                        else
-                        {
-                            component_vertices_->modify_value( uv,
-                                [v, new_id]( std::vector< ComponentMeshVertex >&
-                                        vertices ) {
-                                    vertices[v].vertex = new_id;
-                                } );
-                        }
-                    }
-                    if( need_to_delete )
-                    {
-                        component_vertices_->modify_value( uv,
-                            [&to_delete](
-                                std::vector< ComponentMeshVertex >& vertices ) {
-                                delete_vector_elements( to_delete, vertices );
-                            } );
-                    }
+                    component_vertices_->modify_value( uv,
+                        [component, &old2new]( ComponentVertices& vertices ) {
+                            auto it = vertices.begin();
+                            while( it != vertices.end() )
+                            {
+                                if( it->component != component )
+                                {
+                                    ++it;
+                                    continue;
+                                }
+                                const auto new_id = old2new[it->vertex];
+                                if( new_id == NO_ID )
+                                {
+                                    it = vertices.erase( it );
+                                    continue;
+                                }
+                                it->vertex = new_id;
+                                ++it;
+                            }
+                        } );
                 } );
         }
 
         std::vector< index_t > delete_isolated_vertices()
         {
             std::vector< bool > to_delete( nb_unique_vertices(), false );
-            absl::flat_hash_map< uuid, std::vector< index_t > >
-                components_vertices;
+            std::vector< std::vector< index_t > > components_vertices(
+                components_.size() );
             for( const auto v : Range{ nb_unique_vertices() } )
             {
                 if( is_unique_vertex_isolated( v ) )
@@ -301,19 +382,19 @@ namespace geode
                     to_delete[v] = true;
                     continue;
                 }
-                for( const auto& cmv : component_mesh_vertices( v ) )
+                for( const auto& compact_vertex :
+                    compact_component_vertices( v ) )
                 {
-                    components_vertices[cmv.component_id.id()].emplace_back(
-                        cmv.vertex );
+                    components_vertices[compact_vertex.component].emplace_back(
+                        compact_vertex.vertex );
                 }
             }
             const auto old2new = VertexSetBuilder::create( unique_vertices_ )
                                      ->delete_vertices( to_delete );
-            for( const auto& component_vertices : components_vertices )
+            for( const auto component : Indices{ components_vertices } )
             {
-                auto& attribute =
-                    vertex2unique_vertex_.at( component_vertices.first );
-                for( const auto v : component_vertices.second )
+                auto& attribute = vertex2unique_vertex_[component];
+                for( const auto v : components_vertices[component] )
                 {
                     attribute->set_value( v, old2new[attribute->value( v )] );
                 }
@@ -360,58 +441,315 @@ namespace geode
         void serialize( Archive& archive )
         {
             archive.ext( *this,
-                Growable< Archive, Impl >{ { []( Archive& a, Impl& impl ) {
-                    a.object( impl.unique_vertices_ );
-                    a.ext(
-                        impl.component_vertices_, bitsery::ext::StdSmartPtr{} );
-                    a.ext( impl.vertex2unique_vertex_,
-                        bitsery::ext::StdMap{
-                            impl.vertex2unique_vertex_.max_size() },
-                        []( Archive& a2, uuid& id,
-                            std::shared_ptr< VariableAttribute< index_t > >&
-                                attribute ) {
-                            a2.object( id );
-                            a2.ext( attribute, bitsery::ext::StdSmartPtr{} );
+                Growable< Archive, Impl >{
+                    { []( Archive& a, Impl& impl ) {
+                         a.object( impl.unique_vertices_ );
+                         std::shared_ptr<
+                             VariableAttribute< LegacyComponentVertices > >
+                             component_vertices;
+                         a.ext( component_vertices,
+                             bitsery::ext::StdSmartPtr{} );
+                         LegacyVertex2UniqueVertex vertex2unique_vertex;
+                         a.ext( vertex2unique_vertex,
+                             bitsery::ext::StdMap{
+                                 vertex2unique_vertex.max_size() },
+                             []( Archive& a2, uuid& id,
+                                 std::shared_ptr< VariableAttribute< index_t > >&
+                                     attribute ) {
+                                 a2.object( id );
+                                 a2.ext(
+                                     attribute, bitsery::ext::StdSmartPtr{} );
+                             } );
+                         impl.import_legacy_storage(
+                             *component_vertices, vertex2unique_vertex );
+                     },
+                        []( Archive& a, Impl& impl ) {
+                            a.object( impl.unique_vertices_ );
+                            a.ext( impl.component_vertices_,
+                                bitsery::ext::StdSmartPtr{} );
+                            a.container(
+                                impl.components_, impl.components_.max_size() );
+                            a.container( impl.vertex2unique_vertex_,
+                                impl.vertex2unique_vertex_.max_size(),
+                                []( Archive& a2,
+                                    std::shared_ptr<
+                                        VariableAttribute< index_t > >&
+                                        attribute ) {
+                                    a2.ext( attribute,
+                                        bitsery::ext::StdSmartPtr{} );
+                                } );
+                            impl.component_indices_ = {};
+                            for( const auto c : Indices{ impl.components_ } )
+                            {
+                                impl.component_indices_.set_new_mapping(
+                                    impl.components_[c].id(), c );
+                            }
+                        } } } );
+        }
+
+        const ComponentVertices& compact_component_vertices(
+            index_t unique_vertex_id ) const
+        {
+            OPENGEODE_ASSERT( unique_vertex_id < nb_unique_vertices(),
+                "[VertexIdentifier::component_mesh_vertices] Given "
+                "unique_vertex_id is bigger than the number of unique "
+                "vertices." );
+            return component_vertices_->value( unique_vertex_id );
+        }
+
+        bool has_component_mesh_vertices(
+            index_t unique_vertex_id, index_t component ) const
+        {
+            for( const auto& compact_vertex :
+                compact_component_vertices( unique_vertex_id ) )
+            {
+                if( compact_vertex.component == component )
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        index_t component_index( const uuid& component_id ) const
+        {
+            const auto index = component_indices_.index( component_id );
+            OPENGEODE_EXCEPTION( index.has_value(),
+                "[VertexIdentifier] Component ", component_id.string(),
+                " is not registered" );
+            return index.value();
+        }
+
+        void set_unique_vertex( index_t component,
+            index_t vertex,
+            const index_t unique_vertex_id )
+        {
+            auto& attribute = *vertex2unique_vertex_[component];
+            const auto old_unique_id = attribute.value( vertex );
+            if( old_unique_id == unique_vertex_id )
+            {
+                return;
+            }
+            if( old_unique_id != NO_ID )
+            {
+                remove_component_vertex( old_unique_id, { component, vertex } );
+            }
+            attribute.set_value( vertex, unique_vertex_id );
+            component_vertices_->modify_value( unique_vertex_id,
+                [component, vertex]( ComponentVertices& value ) {
+                    value.push_back( { component, vertex } );
+                } );
+        }
+
+        /*!
+         * Check the given components before any modification: each one
+         * appears once, with one value per component mesh vertex, and the
+         * unique vertices exist.
+         * @return The dense index of each component.
+         */
+        absl::FixedArray< index_t > checked_components_unique_vertices(
+            absl::Span< const ComponentUniqueVertices > components_vertices )
+            const
+        {
+            absl::FixedArray< index_t > components(
+                components_vertices.size() );
+            for( const auto c : Indices{ components_vertices } )
+            {
+                const auto& [component_id, unique_vertices] =
+                    components_vertices[c];
+                components[c] = component_index( component_id.id() );
+                const auto nb_vertices =
+                    vertex2unique_vertex_[components[c]]->size();
+                OPENGEODE_EXCEPTION( unique_vertices.size() == nb_vertices,
+                    "[VertexIdentifier::set_unique_vertices] ",
+                    unique_vertices.size(), " unique vertices given for ",
+                    component_id.string(), " having ", nb_vertices,
+                    " vertices" );
+            }
+            absl::FixedArray< index_t > sorted_components( components );
+            absl::c_sort( sorted_components );
+            OPENGEODE_EXCEPTION(
+                absl::c_adjacent_find( sorted_components )
+                    == sorted_components.end(),
+                "[VertexIdentifier::set_unique_vertices] A component is "
+                "given several times" );
+            const auto nb_uv = nb_unique_vertices();
+            absl::FixedArray< bool > valid( components_vertices.size() );
+            async::parallel_for(
+                async::irange( index_t{ 0 },
+                    static_cast< index_t >( components_vertices.size() ) ),
+                [&components_vertices, &valid, nb_uv]( index_t c ) {
+                    valid[c] = absl::c_all_of(
+                        components_vertices[c].unique_vertices,
+                        [nb_uv]( index_t unique_vertex ) {
+                            return unique_vertex == NO_ID
+                                   || unique_vertex < nb_uv;
                         } );
-                } } } );
+                } );
+            for( const auto c : Indices{ components_vertices } )
+            {
+                OPENGEODE_EXCEPTION( valid[c],
+                    "[VertexIdentifier::set_unique_vertices] Unique vertices "
+                    "given for ",
+                    components_vertices[c].component_id.string(),
+                    " should be lower than ", nb_uv );
+            }
+            return components;
+        }
+
+        /*!
+         * Set the unique vertices stored on the component mesh and return the
+         * modified vertices with their previous unique vertex
+         */
+        std::vector< std::pair< index_t, index_t > >
+            update_component_unique_vertices( index_t component,
+                absl::Span< const index_t > unique_vertices )
+        {
+            auto& attribute = *vertex2unique_vertex_[component];
+            std::vector< std::pair< index_t, index_t > > changes;
+            for( const auto vertex : Indices{ unique_vertices } )
+            {
+                const auto unique_vertex_id = unique_vertices[vertex];
+                OPENGEODE_ASSERT( unique_vertex_id == NO_ID
+                                      || unique_vertex_id < nb_unique_vertices(),
+                    "[VertexIdentifier::set_unique_vertices] Unique vertex ",
+                    unique_vertex_id, " does not exist (nb=",
+                    nb_unique_vertices(), ")" );
+                const auto old_unique_id = attribute.value( vertex );
+                if( old_unique_id == unique_vertex_id )
+                {
+                    continue;
+                }
+                attribute.set_value( vertex, unique_vertex_id );
+                changes.emplace_back( vertex, old_unique_id );
+            }
+            return changes;
         }
 
-        void filter_component_vertices( const uuid& component_id )
+        void remove_component_vertex( index_t unique_vertex_id,
+            const detail::CompactComponentVertex& compact_vertex )
         {
+            const auto& vertices =
+                compact_component_vertices( unique_vertex_id );
+            const auto it = absl::c_find( vertices, compact_vertex );
+            if( it == vertices.end() )
+            {
+                return;
+            }
+            const auto position = it - vertices.begin();
+            component_vertices_->modify_value(
+                unique_vertex_id, [position]( ComponentVertices& value ) {
+                    value.erase( value.begin() + position );
+                } );
+        }
+
+        /*!
+         * Remove a component and give its dense index to the last one
+         */
+        void remove_component( index_t component )
+        {
+            const auto last = static_cast< index_t >( components_.size() - 1 );
             async::parallel_for(
                 async::irange( index_t{ 0 }, nb_unique_vertices() ),
-                [this, &component_id]( index_t uv_id ) {
-                    const auto& component_mesh_vertices =
-                        component_vertices_->value( uv_id );
-                    std::vector< bool > to_keep(
-                        component_mesh_vertices.size(), true );
-                    bool update{ false };
-                    for( const auto i : Indices{ component_mesh_vertices } )
+                [this, component, last]( index_t uv_id ) {
+                    const auto& compact_vertices =
+                        compact_component_vertices( uv_id );
+                    const auto need_update = absl::c_any_of( compact_vertices,
+                        [component, last](
+                            const detail::CompactComponentVertex& value ) {
+                            return value.component == component
+                                   || value.component == last;
+                        } );
+                    if( !need_update )
                     {
-                        if( component_mesh_vertices[i].component_id.id()
-                            == component_id )
-                        {
-                            to_keep[i] = false;
-                            update = true;
-                        }
+                        return;
                     }
-                    if( update )
+                    component_vertices_->modify_value( uv_id,
+                        [component, last]( ComponentVertices& vertices ) {
+                            auto it = vertices.begin();
+                            while( it != vertices.end() )
+                            {
+                                if( it->component == component )
+                                {
+                                    it = vertices.erase( it );
+                                    continue;
+                                }
+                                if( it->component == last )
+                                {
+                                    it->component = component;
+                                }
+                                ++it;
+                            }
+                        } );
+                } );
+            component_indices_.erase( components_[component].id() );
+            if( component != last )
+            {
+                components_[component] = std::move( components_[last] );
+                vertex2unique_vertex_[component] =
+                    std::move( vertex2unique_vertex_[last] );
+                component_indices_.set_new_mapping(
+                    components_[component].id(), component );
+            }
+            components_.pop_back();
+            vertex2unique_vertex_.pop_back();
+        }
+
+        void import_legacy_storage(
+            const VariableAttribute< LegacyComponentVertices >&
+                legacy_component_vertices,
+            const LegacyVertex2UniqueVertex& legacy_vertex2unique_vertex )
+        {
+            components_.clear();
+            vertex2unique_vertex_.clear();
+            component_indices_ = {};
+            for( const auto& [component_id, attribute] :
+                legacy_vertex2unique_vertex )
+            {
+                component_indices_.set_new_mapping(
+                    component_id, components_.size() );
+                components_.emplace_back(
+                    ComponentType{ "undefined" }, component_id );
+                vertex2unique_vertex_.emplace_back( attribute );
+            }
+            unique_vertices_.vertex_attribute_manager().delete_attribute(
+                "component vertices" );
+            component_vertices_ =
+                unique_vertices_.vertex_attribute_manager()
+                    .find_or_create_attribute< VariableAttribute,
+                        ComponentVertices >(
+                        "component mesh vertices", ComponentVertices{} );
+            for( const auto uv : Range{ nb_unique_vertices() } )
+            {
+                const auto& legacy_vertices =
+                    legacy_component_vertices.value( uv );
+                ComponentVertices compact_vertices;
+                compact_vertices.reserve( legacy_vertices.size() );
+                for( const auto& legacy_vertex : legacy_vertices )
+                {
+                    const auto index = component_indices_.index(
+                        legacy_vertex.component_id.id() );
+                    if( !index )
                     {
-                        component_vertices_->set_value(
-                            uv_id, extract_vector_elements(
-                                       to_keep, component_mesh_vertices ) );
+                        continue;
                     }
-                } );
+                    components_[index.value()] = legacy_vertex.component_id;
+                    compact_vertices.push_back(
+                        { index.value(), legacy_vertex.vertex } );
+                }
+                component_vertices_->set_value(
+                    uv, std::move( compact_vertices ) );
+            }
         }
 
     private:
         OpenGeodeVertexSet unique_vertices_;
-        std::shared_ptr<
-            VariableAttribute< std::vector< ComponentMeshVertex > > >
+        std::shared_ptr< VariableAttribute< ComponentVertices > >
             component_vertices_;
-        absl::flat_hash_map< uuid,
-            std::shared_ptr< VariableAttribute< index_t > > >
+        std::vector< ComponentID > components_;
+        std::vector< std::shared_ptr< VariableAttribute< index_t > > >
             vertex2unique_vertex_;
+        detail::UuidToIndex component_indices_;
     };
 
     VertexIdentifier::VertexIdentifier() = default;
@@ -433,11 +771,25 @@ namespace geode
         return impl_->is_unique_vertex_isolated( unique_vertex_id );
     }
 
-    const std::vector< ComponentMeshVertex >&
+    std::vector< ComponentMeshVertex >
         VertexIdentifier::component_mesh_vertices(
             index_t unique_vertex_id ) const
     {
-        return impl_->component_mesh_vertices( unique_vertex_id );
+        const auto range =
+            impl_->component_mesh_vertices_range( unique_vertex_id );
+        std::vector< ComponentMeshVertex > result;
+        result.reserve( range.size() );
+        for( const auto& cmv : range )
+        {
+            result.emplace_back( cmv.component_mesh_vertex() );
+        }
+        return result;
+    }
+
+    ComponentMeshVerticesRange VertexIdentifier::component_mesh_vertices_range(
+        index_t unique_vertex_id ) const
+    {
+        return impl_->component_mesh_vertices_range( unique_vertex_id );
     }
 
     index_t VertexIdentifier::unique_vertex(
@@ -489,8 +841,21 @@ namespace geode
         index_t unique_vertex_id,
         BuilderKey )
     {
-        impl_->set_unique_vertex(
-            std::move( component_vertex_id ), unique_vertex_id );
+        impl_->set_unique_vertex( component_vertex_id, unique_vertex_id );
+    }
+
+    void VertexIdentifier::set_unique_vertices( const ComponentID& component_id,
+        absl::Span< const index_t > unique_vertices,
+        BuilderKey )
+    {
+        impl_->set_unique_vertices( component_id, unique_vertices );
+    }
+
+    void VertexIdentifier::set_unique_vertices(
+        absl::Span< const ComponentUniqueVertices > components_vertices,
+        BuilderKey )
+    {
+        impl_->set_unique_vertices( components_vertices );
     }
 
     void VertexIdentifier::unset_unique_vertex(
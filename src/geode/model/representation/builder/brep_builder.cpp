@@ -101,14 +101,16 @@ namespace
         const geode::ComponentID& component_id,
         geode::index_t first_new_unique_vertex )
     {
+        absl::FixedArray< geode::index_t > new_unique_vertices(
+            unique_vertices.size() );
         for( const auto v : geode::Indices{ unique_vertices } )
         {
-            if( unique_vertices[v] != geode::NO_ID )
-            {
-                builder.set_unique_vertex( { component_id, v },
-                    first_new_unique_vertex + unique_vertices[v] );
-            }
+            new_unique_vertices[v] =
+                unique_vertices[v] == geode::NO_ID
+                    ? geode::NO_ID
+                    : first_new_unique_vertex + unique_vertices[v];
         }
+        builder.set_unique_vertices( component_id, new_unique_vertices );
     }
 } // namespace
 
@@ -602,7 +604,8 @@ namespace geode
 
     void BRepBuilder::set_point( index_t unique_vertex, const Point3D& point )
     {
-        for( const auto& cmv : brep_.component_mesh_vertices( unique_vertex ) )
+        for( const auto& cmv :
+            brep_.component_mesh_vertices_range( unique_vertex ) )
         {
             if( cmv.component_id.type() == Block3D::component_type_static() )
             {
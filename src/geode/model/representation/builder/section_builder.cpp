@@ -373,7 +373,7 @@ namespace geode
         index_t unique_vertex, const Point2D& point )
     {
         for( const auto& cmv :
-            section_.component_mesh_vertices( unique_vertex ) )
+            section_.component_mesh_vertices_range( unique_vertex ) )
         {
             if( cmv.component_id.type() == Surface2D::component_type_static() )
             {
@@ -30,6 +30,7 @@
 #include <geode/basic/detail/geode_output_impl.hpp>
 #include <geode/basic/io.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/save_async.hpp>
 
 #include <geode/model/representation/core/brep.hpp>
 
@@ -52,6 +53,12 @@ namespace geode
         }
     }
 
+    async::task< std::vector< std::string > > save_brep_async(
+        const BRep& brep, std::string_view filename )
+    {
+        return save_async( brep.clone(), filename, save_brep );
+    }
+
     bool is_brep_saveable( const BRep& brep, std::string_view filename )
     {
         const auto output =
@@ -25,6 +25,7 @@
 
 #include <async++.h>
 
+#include <geode/basic/io_profiler.hpp>
 #include <geode/basic/uuid.hpp>
 #include <geode/basic/zip_file.hpp>
 
@@ -49,15 +50,18 @@ namespace geode
         BRepBuilder builder{ brep };
         async::parallel_invoke(
             [&builder, &directory] {
+                const IOProfileScope profile{ "BRep identifier" };
                 builder.load_identifier( directory );
             },
             [&builder, &directory] {
+                const IOProfileScope profile{ "BRep mesh components" };
                 builder.load_corners( directory );
                 builder.load_lines( directory );
                 builder.load_surfaces( directory );
                 builder.load_blocks( directory );
             },
             [&builder, &directory] {
+                const IOProfileScope profile{ "BRep collections" };
                 builder.load_model_boundaries( directory );
                 builder.load_corner_collections( directory );
                 builder.load_line_collections( directory );
@@ -65,11 +69,14 @@ namespace geode
                 builder.load_block_collections( directory );
             },
             [&builder, &directory] {
+                const IOProfileScope profile{ "BRep relationships" };
                 builder.load_relationships( directory );
             },
             [&builder, &directory] {
+                const IOProfileScope profile{ "BRep unique vertices" };
                 builder.load_unique_vertices( directory );
             } );
+        const IOProfileScope profile{ "BRep mesh registration" };
         for( const auto& corner : brep.corners() )
         {
             builder.register_mesh_component( corner );
@@ -91,7 +98,11 @@ namespace geode
     BRep OpenGeodeBRepInput::read()
     {
         const UnzipFile zip_reader{ filename(), uuid{}.string() };
-        zip_reader.extract_all();
+        {
+            IOProfileScope profile{ "BRep unzip" };
+            zip_reader.extract_all();
+            profile.add_file_bytes( filename() );
+        }
         BRep brep;
         load_brep_files( brep, zip_reader.directory() );
         detail::filter_unsupported_components( brep );
@@ -29,6 +29,7 @@
 
 #include <async++.h>
 
+#include <geode/basic/io_profiler.hpp>
 #include <geode/basic/uuid.hpp>
 #include <geode/basic/zip_file.hpp>
 
@@ -39,9 +40,11 @@ namespace geode
     void OpenGeodeBRepOutput::archive_brep_files(
         const ZipFile& zip_writer ) const
     {
+        IOProfileScope profile{ "BRep zip" };
         for( const auto& file :
             std::filesystem::directory_iterator( zip_writer.directory() ) )
         {
+            profile.add_file_bytes( file.path().string() );
             zip_writer.archive_file( file.path().string() );
         }
     }
@@ -51,21 +54,26 @@ namespace geode
     {
         async::parallel_invoke(
             [&directory, &brep] {
+                const IOProfileScope profile{ "BRep identifier" };
                 brep.save_identifier( directory );
             },
             [&directory, &brep] {
+                const IOProfileScope profile{ "BRep relationships" };
                 brep.save_relationships( directory );
             },
             [&directory, &brep] {
+                const IOProfileScope profile{ "BRep unique vertices" };
                 brep.save_unique_vertices( directory );
             },
             [&directory, &brep] {
+                const IOProfileScope profile{ "BRep mesh components" };
                 brep.save_corners( directory );
                 brep.save_lines( directory );
                 brep.save_surfaces( directory );
                 brep.save_blocks( directory );
             },
             [&directory, &brep] {
+                const IOProfileScope profile{ "BRep collections" };
                 brep.save_model_boundaries( directory );
                 brep.save_corner_collections( directory );
                 brep.save_line_collections( directory );
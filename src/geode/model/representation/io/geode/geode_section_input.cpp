@@ -25,6 +25,7 @@
 
 #include <async++.h>
 
+#include <geode/basic/io_profiler.hpp>
 #include <geode/basic/uuid.hpp>
 #include <geode/basic/zip_file.hpp>
 
@@ -47,25 +48,31 @@ namespace geode
         SectionBuilder builder{ section };
         async::parallel_invoke(
             [&builder, &directory] {
+                const IOProfileScope profile{ "Section identifier" };
                 builder.load_identifier( directory );
             },
             [&builder, &directory] {
+                const IOProfileScope profile{ "Section mesh components" };
                 builder.load_corners( directory );
                 builder.load_lines( directory );
                 builder.load_surfaces( directory );
             },
             [&builder, &directory] {
+                const IOProfileScope profile{ "Section collections" };
                 builder.load_model_boundaries( directory );
                 builder.load_corner_collections( directory );
                 builder.load_line_collections( directory );
                 builder.load_surface_collections( directory );
             },
             [&builder, &directory] {
+                const IOProfileScope profile{ "Section relationships" };
                 builder.load_relationships( directory );
             },
             [&builder, &directory] {
+                const IOProfileScope profile{ "Section unique vertices" };
                 builder.load_unique_vertices( directory );
             } );
+        const IOProfileScope profile{ "Section mesh registration" };
         for( const auto& corner : section.corners() )
         {
             builder.register_mesh_component( corner );
@@ -83,7 +90,11 @@ namespace geode
     Section OpenGeodeSectionInput::read()
     {
         const UnzipFile zip_reader{ filename(), uuid{}.string() };
-        zip_reader.extract_all();
+        {
+            IOProfileScope profile{ "Section unzip" };
+            zip_reader.extract_all();
+            profile.add_file_bytes( filename() );
+        }
         Section section;
         load_section_files( section, zip_reader.directory() );
         detail::filter_unsupported_components( section );
@@ -29,6 +29,7 @@
 
 #include <async++.h>
 
+#include <geode/basic/io_profiler.hpp>
 #include <geode/basic/uuid.hpp>
 #include <geode/basic/zip_file.hpp>
 
@@ -41,20 +42,25 @@ namespace geode
     {
         async::parallel_invoke(
             [&directory, &section] {
+                const IOProfileScope profile{ "Section identifier" };
                 section.save_identifier( directory );
             },
             [&directory, &section] {
+                const IOProfileScope profile{ "Section relationships" };
                 section.save_relationships( directory );
             },
             [&directory, &section] {
+                const IOProfileScope profile{ "Section unique vertices" };
                 section.save_unique_vertices( directory );
             },
             [&directory, &section] {
+                const IOProfileScope profile{ "Section mesh components" };
                 section.save_corners( directory );
                 section.save_lines( directory );
                 section.save_surfaces( directory );
             },
             [&directory, &section] {
+                const IOProfileScope profile{ "Section collections" };
                 section.save_model_boundaries( directory );
                 section.save_corner_collections( directory );
                 section.save_line_collections( directory );
@@ -65,9 +71,11 @@ namespace geode
     void OpenGeodeSectionOutput::archive_section_files(
         const ZipFile& zip_writer ) const
     {
+        IOProfileScope profile{ "Section zip" };
         for( const auto& file :
             std::filesystem::directory_iterator( zip_writer.directory() ) )
         {
+            profile.add_file_bytes( file.path().string() );
             zip_writer.archive_file( file.path().string() );
         }
     }
@@ -30,6 +30,7 @@
 #include <geode/basic/detail/geode_output_impl.hpp>
 #include <geode/basic/io.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/save_async.hpp>
 
 #include <geode/model/representation/core/section.hpp>
 
@@ -53,6 +54,12 @@ namespace geode
         }
     }
 
+    async::task< std::vector< std::string > > save_section_async(
+        const Section& section, std::string_view filename )
+    {
+        return save_async( section.clone(), filename, save_section );
+    }
+
     bool is_section_saveable(
         const Section& section, std::string_view filename )
     {
@@ -419,6 +419,46 @@ void test_serialize_manager( geode::AttributeManager& manager )
     check_attribute_values( manager, reloaded_manager );
 }
 
+void test_serialize_large_attribute()
+{
+    geode::AttributeManager manager;
+    manager.resize( 1200000 );
+    using Value = std::array< double, 2 >;
+    auto attribute =
+        manager.find_or_create_attribute< geode::VariableAttribute, Value >(
+            "large", Value{ 0, 0 } );
+    for( const auto i : geode::Range{ manager.nb_elements() } )
+    {
+        attribute->set_value( i, Value{ 1. * i, -2. * i } );
+    }
+    const auto filename = "large_manager.out";
+    std::ofstream file{ filename, std::ofstream::binary };
+    geode::TContext context{};
+    geode::register_basic_serialize_pcontext( std::get< 0 >( context ) );
+    geode::Serializer archive{ context, file };
+    archive.object( manager );
+    archive.adapter().flush();
+    file.close();
+
+    std::ifstream infile{ filename, std::ifstream::binary };
+    geode::AttributeManager reloaded_manager;
+    geode::TContext reload_context{};
+    geode::register_basic_deserialize_pcontext(
+        std::get< 0 >( reload_context ) );
+    geode::Deserializer unarchive{ reload_context, infile };
+    unarchive.object( reloaded_manager );
+    const auto& adapter = unarchive.adapter();
+    OPENGEODE_EXCEPTION( adapter.error() == bitsery::ReaderError::NoError
+                             && adapter.isCompletedSuccessfully(),
+        "[Test] Error while reading file: ", filename );
+    const auto reloaded = reloaded_manager.find_attribute< Value >( "large" );
+    for( const auto i : geode::Range{ manager.nb_elements() } )
+    {
+        OPENGEODE_EXCEPTION( reloaded->value( i ) == attribute->value( i ),
+            "[Test] Wrong reloaded value for element ", i );
+    }
+}
+
 void test_attribute_types( geode::AttributeManager& manager )
 {
     OPENGEODE_EXCEPTION(
@@ -591,6 +631,7 @@ void test()
     test_sparse_attribute_after_element_deletion( manager );
 
     test_serialize_manager( manager );
+    test_serialize_large_attribute();
 
     test_copy_manager( manager );
     test_import_manager( manager );
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/bricked_array.hpp>
+#include <geode/basic/logger.hpp>
+
+#include <geode/tests/common.hpp>
+
+namespace
+{
+    using Array = geode::BrickedArray< double, 3 >;
+    using Cell = Array::CellIndices;
+
+    double expected_value( const Cell& cell )
+    {
+        if( cell[0] % 7 == 0 && cell[1] % 3 == 0 && cell[2] % 5 == 0 )
+        {
+            return cell[0] + 100. * cell[1] + 10000. * cell[2];
+        }
+        return -1;
+    }
+
+    void check_values( const Array& array )
+    {
+        for( const auto k : geode::Range{ array.nb_cells_in_direction( 2 ) } )
+        {
+            for( const auto j :
+                geode::Range{ array.nb_cells_in_direction( 1 ) } )
+            {
+                for( const auto i :
+                    geode::Range{ array.nb_cells_in_direction( 0 ) } )
+                {
+                    OPENGEODE_EXCEPTION( array.value( { i, j, k } )
+                                             == expected_value( { i, j, k } ),
+                        "[Test] Wrong value for cell ", i, " ", j, " ", k );
+                }
+            }
+        }
+    }
+} // namespace
+
+void test_bricks()
+{
+    Array array{ { 70, 40, 33 }, -1 };
+    OPENGEODE_EXCEPTION(
+        array.nb_bricks() == 12, "[Test] Wrong number of bricks" );
+    OPENGEODE_EXCEPTION( array.nb_bricks_in_direction( 0 ) == 3,
+        "[Test] Wrong number of bricks in direction 0" );
+    OPENGEODE_EXCEPTION( array.brick( { 40, 35, 32 } ) == 1 + 3 * 1 + 6 * 1,
+        "[Test] Wrong brick of cell" );
+    const Cell first_cell{ 32, 32, 32 };
+    OPENGEODE_EXCEPTION( array.brick_first_cell( 10 ) == first_cell,
+        "[Test] Wrong first cell of brick" );
+    OPENGEODE_EXCEPTION(
+        array.value( { 12, 5, 3 } ) == -1, "[Test] Wrong default value" );
+    OPENGEODE_EXCEPTION(
+        !array.is_brick_in_memory( 0 ), "[Test] Brick should not exist" );
+    array.set_value( { 1, 2, 3 }, 4 );
+    OPENGEODE_EXCEPTION(
+        array.is_brick_in_memory( 0 ), "[Test] Brick should exist" );
+    const auto values = array.brick_values( 0 );
+    const auto local_index = Array::brick_local_index( { 1, 2, 3 } );
+    OPENGEODE_EXCEPTION(
+        values[local_index] == 4, "[Test] Wrong brick value" );
+    array.release_brick( 0 );
+    OPENGEODE_EXCEPTION(
+        array.value( { 1, 2, 3 } ) == -1, "[Test] Wrong released value" );
+}
+
+void test_file_bricks()
+{
+    const auto array = geode::build_bricked_array< 3 >(
+        { 70, 40, 33 }, -1., []( const Cell& cell ) {
+            return expected_value( cell );
+        } );
+    check_values( array );
+    geode::save_bricked_array( array, "test.ogbrick" );
+    auto opened = geode::open_bricked_array< double, 3 >( "test.ogbrick" );
+    OPENGEODE_EXCEPTION(
+        !opened.is_brick_in_memory( 5 ), "[Test] Brick should not be loaded" );
+    OPENGEODE_EXCEPTION(
+        opened.value( { 35, 33, 0 } ) == expected_value( { 35, 33, 0 } ),
+        "[Test] Wrong loaded value" );
+    OPENGEODE_EXCEPTION(
+        opened.is_brick_in_memory( 4 ), "[Test] Brick should be loaded" );
+    check_values( opened );
+    for( const auto brick : geode::Range{ opened.nb_bricks() } )
+    {
+        opened.release_brick( brick );
+    }
+    check_values( opened );
+}
+
+void test()
+{
+    test_bricks();
+    test_file_bricks();
+}
+
+OPENGEODE_TEST( "bricked-array" )
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <absl/strings/str_cat.h>
+
+#include <geode/basic/filename.hpp>
+#include <geode/basic/logger.hpp>
+#include <geode/basic/range.hpp>
+#include <geode/basic/save_async.hpp>
+
+#include <geode/tests/common.hpp>
+
+namespace
+{
+    void write_file( const std::filesystem::path& file, int value )
+    {
+        std::ofstream stream{ file };
+        stream << value;
+    }
+
+    int read_file( const std::filesystem::path& file )
+    {
+        std::ifstream stream{ file };
+        int value{ -1 };
+        stream >> value;
+        return value;
+    }
+
+    /*!
+     * Multi-file format: a main file, a sidecar file next to it and another
+     * one in a folder named after it
+     */
+    std::vector< std::string > save_multi_files(
+        const int& value, std::string_view filename )
+    {
+        const auto prefix =
+            geode::filepath_without_extension( geode::to_string( filename ) )
+                .string();
+        const auto sidecar = absl::StrCat( prefix, "_data.txt" );
+        const auto folder_sidecar = absl::StrCat( prefix, "/block.txt" );
+        std::filesystem::create_directories( prefix );
+        write_file( filename, value );
+        write_file( sidecar, value + 1 );
+        write_file( folder_sidecar, value + 2 );
+        return { geode::to_string( filename ), sidecar, folder_sidecar };
+    }
+
+    std::vector< std::string > failing_save(
+        const int& value, std::string_view filename )
+    {
+        save_multi_files( value, filename );
+        throw geode::OpenGeodeException{ "[Test] Failing save" };
+    }
+
+    bool is_temporary_file_left()
+    {
+        for( const auto& file : std::filesystem::directory_iterator{ "." } )
+        {
+            const auto name = file.path().filename().string();
+            if( ( name.rfind( "save_async.", 0 ) == 0
+                    && name != "save_async.txt" )
+                || name.rfind( "failed_async", 0 ) == 0 )
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+} // namespace
+
+void test_multi_files()
+{
+    const auto files =
+        geode::save_async( 40, "save_async.txt", save_multi_files ).get();
+    const std::vector< std::string > expected_files{ "save_async.txt",
+        "save_async_data.txt", "save_async/block.txt" };
+    OPENGEODE_EXCEPTION(
+        files == expected_files, "[Test] Wrong saved file names" );
+    for( const auto f : geode::Indices{ files } )
+    {
+        OPENGEODE_EXCEPTION(
+            read_file( files[f] ) == 40 + static_cast< int >( f ),
+            "[Test] Wrong content in saved file ", files[f] );
+    }
+    OPENGEODE_EXCEPTION(
+        !is_temporary_file_left(), "[Test] Temporary files are left" );
+}
+
+void test_failure()
+{
+    bool failed{ false };
+    try
+    {
+        const auto files =
+            geode::save_async( 40, "failed_async.txt", failing_save ).get();
+        geode_unused( files );
+    }
+    catch( const geode::OpenGeodeException& /*unused*/ )
+    {
+        failed = true;
+    }
+    OPENGEODE_EXCEPTION( failed, "[Test] Save should have failed" );
+    OPENGEODE_EXCEPTION(
+        !is_temporary_file_left(), "[Test] Files are left after failure" );
+}
+
+void test()
+{
+    test_multi_files();
+    test_failure();
+}
+
+OPENGEODE_TEST( "save-async" )
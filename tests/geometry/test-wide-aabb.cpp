@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <mutex>
+#include <random>
+
+#include <absl/algorithm/container.h>
+
+#include <geode/basic/logger.hpp>
+#include <geode/basic/timer.hpp>
+
+#include <geode/geometry/aabb.hpp>
+#include <geode/geometry/distance.hpp>
+#include <geode/geometry/point.hpp>
+#include <geode/geometry/vector.hpp>
+#include <geode/geometry/wide_aabb.hpp>
+
+#include <geode/tests/common.hpp>
+
+using Pairs = std::vector< std::array< geode::index_t, 2 > >;
+
+/*
+ * Box coordinates are multiples of 0.25 so that they are exactly
+ * represented in float: both trees then give the same results.
+ */
+template < geode::index_t dimension >
+std::vector< geode::BoundingBox< dimension > > create_random_boxes(
+    geode::index_t nb_boxes, geode::index_t range, std::mt19937& generator )
+{
+    std::uniform_int_distribution< geode::index_t > position( 0, 4 * range );
+    std::uniform_int_distribution< geode::index_t > size( 1, 8 );
+    std::vector< geode::BoundingBox< dimension > > boxes( nb_boxes );
+    for( auto& box : boxes )
+    {
+        geode::Point< dimension > min;
+        geode::Point< dimension > max;
+        for( const auto axis : geode::LRange{ dimension } )
+        {
+            const auto value = position( generator ) / 4.;
+            min.set_value( axis, value );
+            max.set_value( axis, value + size( generator ) / 4. );
+        }
+        box = { min, max };
+    }
+    return boxes;
+}
+
+template < geode::index_t dimension >
+geode::Point< dimension > random_point(
+    geode::index_t range, std::mt19937& generator )
+{
+    std::uniform_real_distribution< double > position( 0, range );
+    geode::Point< dimension > point;
+    for( const auto axis : geode::LRange{ dimension } )
+    {
+        point.set_value( axis, position( generator ) );
+    }
+    return point;
+}
+
+template < geode::index_t dimension >
+class BoxCenterDistance
+{
+public:
+    BoxCenterDistance(
+        absl::Span< const geode::BoundingBox< dimension > > boxes )
+        : boxes_( boxes )
+    {
+    }
+
+    double operator()(
+        const geode::Point< dimension >& query, geode::index_t box ) const
+    {
+        return geode::point_point_distance( boxes_[box].center(), query );
+    }
+
+private:
+    absl::Span< const geode::BoundingBox< dimension > > boxes_;
+};
+
+class PairsCollector
+{
+public:
+    bool operator()( geode::index_t box1, geode::index_t box2 )
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        pairs_.push_back( { box1, box2 } );
+        return false;
+    }
+
+    Pairs sorted_pairs( bool symmetric )
+    {
+        if( symmetric )
+        {
+            for( auto& pair : pairs_ )
+            {
+                if( pair[0] > pair[1] )
+                {
+                    std::swap( pair[0], pair[1] );
+                }
+            }
+        }
+        absl::c_sort( pairs_ );
+        return pairs_;
+    }
+
+private:
+    Pairs pairs_;
+    std::mutex mutex_;
+};
+
+class BoxesCollector
+{
+public:
+    bool operator()( geode::index_t box )
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        boxes_.push_back( box );
+        return false;
+    }
+
+    std::vector< geode::index_t > sorted_boxes()
+    {
+        absl::c_sort( boxes_ );
+        return boxes_;
+    }
+
+private:
+    std::vector< geode::index_t > boxes_;
+    std::mutex mutex_;
+};
+
+template < geode::index_t dimension >
+void test_queries()
+{
+    geode::Logger::info( "TEST", " Wide AABB queries ", dimension, "D" );
+    std::mt19937 generator{ 42 };
+    const geode::index_t range{ 50 };
+    const auto boxes =
+        create_random_boxes< dimension >( 2000, range, generator );
+    const geode::AABBTree< dimension > aabb{ boxes };
+    const geode::WideAABBTree< dimension > wide{ boxes };
+    OPENGEODE_EXCEPTION( wide.nb_bboxes() == boxes.size(),
+        "[Test] Wrong number of boxes in the wide tree" );
+    OPENGEODE_EXCEPTION( wide.bounding_box().min() == aabb.bounding_box().min()
+                             && wide.bounding_box().max()
+                                    == aabb.bounding_box().max(),
+        "[Test] Wrong wide tree bounding box" );
+
+    const BoxCenterDistance< dimension > distance{ boxes };
+    for( const auto query_id : geode::Range{ 100 } )
+    {
+        geode_unused( query_id );
+        const auto query = random_point< dimension >( range, generator );
+        auto containing = aabb.containing_boxes( query );
+        auto wide_containing = wide.containing_boxes( query );
+        absl::c_sort( containing );
+        absl::c_sort( wide_containing );
+        OPENGEODE_EXCEPTION( containing == wide_containing,
+            "[Test] Wrong wide tree containing boxes" );
+
+        const auto closest = aabb.closest_element_box( query, distance );
+        const auto wide_closest = wide.closest_element_box( query, distance );
+        OPENGEODE_EXCEPTION(
+            std::get< 1 >( closest ) == std::get< 1 >( wide_closest ),
+            "[Test] Wrong wide tree closest box" );
+
+        const auto& query_box = boxes[query_id];
+        BoxesCollector box_result;
+        aabb.compute_bbox_element_bbox_intersections( query_box, box_result );
+        BoxesCollector wide_box_result;
+        wide.compute_bbox_element_bbox_intersections(
+            query_box, wide_box_result );
+        OPENGEODE_EXCEPTION(
+            box_result.sorted_boxes() == wide_box_result.sorted_boxes(),
+            "[Test] Wrong wide tree box intersections" );
+
+        const auto target = boxes[query_id + 1].center();
+        const geode::Vector< dimension > direction{ query, target };
+        const geode::Ray< dimension > ray{ direction, query };
+        BoxesCollector ray_result;
+        aabb.compute_ray_element_bbox_intersections( ray, ray_result );
+        BoxesCollector wide_ray_result;
+        wide.compute_ray_element_bbox_intersections( ray, wide_ray_result );
+        OPENGEODE_EXCEPTION(
+            ray_result.sorted_boxes() == wide_ray_result.sorted_boxes(),
+            "[Test] Wrong wide tree ray intersections" );
+    }
+
+    PairsCollector self;
+    aabb.compute_self_element_bbox_intersections( self );
+    PairsCollector wide_self;
+    wide.compute_self_element_bbox_intersections( wide_self );
+    OPENGEODE_EXCEPTION(
+        self.sorted_pairs( true ) == wide_self.sorted_pairs( true ),
+        "[Test] Wrong wide tree self intersections" );
+
+    const auto other_boxes =
+        create_random_boxes< dimension >( 300, range, generator );
+    const geode::AABBTree< dimension > other_aabb{ other_boxes };
+    const geode::WideAABBTree< dimension > other_wide{ other_boxes };
+    PairsCollector other;
+    aabb.compute_other_element_bbox_intersections( other_aabb, other );
+    PairsCollector wide_other;
+    wide.compute_other_element_bbox_intersections( other_wide, wide_other );
+    OPENGEODE_EXCEPTION(
+        other.sorted_pairs( false ) == wide_other.sorted_pairs( false ),
+        "[Test] Wrong wide tree other intersections" );
+    PairsCollector reverse_other;
+    other_wide.compute_other_element_bbox_intersections( wide, reverse_other );
+    auto reverse_pairs = reverse_other.sorted_pairs( false );
+    for( auto& pair : reverse_pairs )
+    {
+        std::swap( pair[0], pair[1] );
+    }
+    absl::c_sort( reverse_pairs );
+    OPENGEODE_EXCEPTION( other.sorted_pairs( false ) == reverse_pairs,
+        "[Test] Wrong wide tree reverse other intersections" );
+}
+
+void benchmark()
+{
+    const geode::index_t nb_boxes{ 1 << 18 };
+    const geode::index_t nb_queries{ 100000 };
+    geode::Logger::info( "Benchmark on ", nb_boxes, " 3D boxes" );
+    std::mt19937 generator{ 7 };
+    const geode::index_t range{ 2000 };
+    const auto boxes =
+        create_random_boxes< 3 >( nb_boxes, range, generator );
+    std::vector< geode::Point3D > queries;
+    queries.reserve( nb_queries );
+    for( const auto q : geode::Range{ nb_queries } )
+    {
+        geode_unused( q );
+        queries.push_back( random_point< 3 >( range, generator ) );
+    }
+
+    geode::Timer timer;
+    const geode::AABBTree3D aabb{ boxes };
+    geode::Logger::info( "AABBTree build: ", timer.duration() );
+    timer.reset();
+    const geode::WideAABBTree3D wide{ boxes };
+    geode::Logger::info( "WideAABBTree build: ", timer.duration() );
+
+    // The binary tree stores 2 * nb_boxes nodes for a power of two number
+    // of boxes, plus the morton mapping.
+    const auto aabb_memory = 2 * nb_boxes * sizeof( geode::BoundingBox3D )
+                             + nb_boxes * sizeof( geode::index_t );
+    geode::Logger::info( "AABBTree memory: ", aabb_memory / 1024, " KB" );
+    geode::Logger::info(
+        "WideAABBTree memory: ", wide.memory_size() / 1024, " KB" );
+
+    std::size_t nb_results{ 0 };
+    timer.reset();
+    for( const auto& query : queries )
+    {
+        nb_results += aabb.containing_boxes( query ).size();
+    }
+    geode::Logger::info( "AABBTree point queries: ", timer.duration() );
+    std::size_t wide_nb_results{ 0 };
+    timer.reset();
+    for( const auto& query : queries )
+    {
+        wide_nb_results += wide.containing_boxes( query ).size();
+    }
+    geode::Logger::info( "WideAABBTree point queries: ", timer.duration() );
+    OPENGEODE_EXCEPTION( nb_results == wide_nb_results,
+        "[Test] Wrong number of containing boxes in benchmark" );
+
+    const BoxCenterDistance< 3 > distance{ boxes };
+    timer.reset();
+    for( const auto& query : queries )
+    {
+        geode_unused( aabb.closest_element_box( query, distance ) );
+    }
+    geode::Logger::info( "AABBTree closest queries: ", timer.duration() );
+    timer.reset();
+    for( const auto& query : queries )
+    {
+        geode_unused( wide.closest_element_box( query, distance ) );
+    }
+    geode::Logger::info( "WideAABBTree closest queries: ", timer.duration() );
+
+    timer.reset();
+    PairsCollector self;
+    aabb.compute_self_element_bbox_intersections( self );
+    geode::Logger::info( "AABBTree self intersections: ", timer.duration() );
+    timer.reset();
+    PairsCollector wide_self;
+    wide.compute_self_element_bbox_intersections( wide_self );
+    geode::Logger::info(
+        "WideAABBTree self intersections: ", timer.duration() );
+}
+
+void test()
+{
+    test_queries< 2 >();
+    test_queries< 3 >();
+#ifdef OPENGEODE_BENCHMARK
+    benchmark();
+#endif
+}
+
+OPENGEODE_TEST( "wide-aabb" )
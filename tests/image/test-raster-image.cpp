@@ -24,7 +24,9 @@
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/logger.hpp>
 
+#include <geode/image/core/bricked_raster_image.hpp>
 #include <geode/image/core/raster_image.hpp>
+#include <geode/image/core/raster_image_sampling.hpp>
 #include <geode/image/core/rgb_color.hpp>
 #include <geode/image/io/raster_image_input.hpp>
 #include <geode/image/io/raster_image_output.hpp>
@@ -47,6 +49,55 @@ void test_raster( const geode::RasterImage2D& raster )
     }
 }
 
+void test_sampling( const geode::RasterImage2D& raster )
+{
+    const auto mipmaps = geode::build_raster_image_mipmaps( raster );
+    OPENGEODE_EXCEPTION(
+        mipmaps.size() == 4, "[Test] Wrong number of mipmap levels" );
+    OPENGEODE_EXCEPTION( mipmaps[0].nb_cells_in_direction( 0 ) == 5
+                             && mipmaps[1].nb_cells_in_direction( 0 ) == 3
+                             && mipmaps[2].nb_cells_in_direction( 0 ) == 2
+                             && mipmaps[3].nb_cells() == 1,
+        "[Test] Wrong mipmap dimensions" );
+    OPENGEODE_EXCEPTION( mipmaps[0].color( 0 ) == geode::RGBColor( 6, 6, 6 ),
+        "[Test] Wrong mipmap color" );
+
+    const std::vector< geode::ImageCoordinates< 2 > > coordinates{
+        { 0.05, 0.05 }, { 0.15, 0.1 }, { -1, 2 }
+    };
+    const std::array< geode::local_index_t, 3 > expected{ 0, 6, 90 };
+    const auto values = geode::raster_image_values( raster, coordinates );
+    for( const auto i : geode::LRange{ 3 } )
+    {
+        const geode::RGBColor color{ expected[i], expected[i], expected[i] };
+        OPENGEODE_EXCEPTION(
+            geode::raster_image_value( raster, coordinates[i] ) == color,
+            "[Test] Wrong sampled color ", i );
+        OPENGEODE_EXCEPTION(
+            values[i] == color, "[Test] Wrong batch sampled color ", i );
+    }
+}
+
+void test_bricked_colors( const geode::RasterImage2D& raster )
+{
+    const auto colors = geode::bricked_colors( raster );
+    OPENGEODE_EXCEPTION( colors.nb_cells_in_direction( 0 ) == 10
+                             && colors.nb_cells_in_direction( 1 ) == 10,
+        "[Test] Wrong bricked colors size" );
+    for( const auto j : geode::Range{ 10 } )
+    {
+        for( const auto i : geode::Range{ 10 } )
+        {
+            const auto cell = raster.cell_index( { i, j } );
+            OPENGEODE_EXCEPTION(
+                colors.value( { i, j } ) == raster.color( cell ),
+                "[Test] Wrong bricked color for cell ", i, " ", j );
+        }
+    }
+    OPENGEODE_EXCEPTION( colors.value( { 10, 0 } ) == geode::RGBColor{},
+        "[Test] Wrong bricked color outside the image" );
+}
+
 void test()
 {
     geode::OpenGeodeImageLibrary::initialize();
@@ -57,6 +108,8 @@ void test()
     }
     test_raster( raster );
     test_raster( raster.clone() );
+    test_sampling( raster );
+    test_bricked_colors( raster );
     const auto filename_with_spaces = absl::StrCat( " ", "test.og_img2d", " " );
     geode::save_raster_image( raster, filename_with_spaces );
     const auto reload = geode::load_raster_image< 2 >( filename_with_spaces );
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/logger.hpp>
+#include <geode/basic/range.hpp>
+
+#include <geode/image/core/typed_raster_image.hpp>
+#include <geode/image/io/typed_raster_image_input.hpp>
+#include <geode/image/io/typed_raster_image_output.hpp>
+
+#include <geode/tests/common.hpp>
+
+void test_float_raster( const geode::TypedRasterImage< float, 3 >& raster )
+{
+    OPENGEODE_EXCEPTION(
+        raster.nb_cells() == 60, "[Test] Wrong number of cells" );
+    OPENGEODE_EXCEPTION( raster.nb_cells_in_direction( 2 ) == 5,
+        "[Test] Wrong number of cells in direction 2" );
+    for( const auto i : geode::Range{ raster.nb_cells() } )
+    {
+        OPENGEODE_EXCEPTION(
+            raster.value( i ) == 0.5f * i, "[Test] Wrong value for ", i );
+    }
+    OPENGEODE_EXCEPTION(
+        raster.values().size() == 60, "[Test] Wrong number of values" );
+}
+
+void test_float()
+{
+    geode::TypedRasterImage< float, 3 > raster{ { 3, 4, 5 } };
+    auto values = raster.modifiable_values();
+    for( const auto i : geode::Range{ raster.nb_cells() } )
+    {
+        values[i] = 0.5f * i;
+    }
+    test_float_raster( raster );
+    test_float_raster( raster.clone() );
+    const auto filename = absl::StrCat( "test.", raster.native_extension() );
+    geode::save_typed_raster_image( raster, filename );
+    const auto reload =
+        geode::load_typed_raster_image< float, 3 >( filename );
+    test_float_raster( reload );
+}
+
+void test_multi_channel()
+{
+    using Pixel = std::array< float, 3 >;
+    geode::TypedRasterImage< Pixel, 2 > raster{ { 4, 2 } };
+    for( const auto i : geode::Range{ raster.nb_cells() } )
+    {
+        raster.set_value( i, { 1.f * i, 2.f * i, 3.f * i } );
+    }
+    const auto filename = absl::StrCat( "test.", raster.native_extension() );
+    geode::save_typed_raster_image( raster, filename );
+    const auto reload = geode::load_typed_raster_image< Pixel, 2 >( filename );
+    for( const auto i : geode::Range{ raster.nb_cells() } )
+    {
+        const Pixel expected{ 1.f * i, 2.f * i, 3.f * i };
+        OPENGEODE_EXCEPTION(
+            reload.value( i ) == expected, "[Test] Wrong pixel for ", i );
+    }
+}
+
+void test()
+{
+    geode::OpenGeodeImageLibrary::initialize();
+    test_float();
+    test_multi_channel();
+}
+
+OPENGEODE_TEST( "typed-raster-image" )
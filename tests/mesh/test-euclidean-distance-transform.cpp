@@ -22,11 +22,16 @@
  *
  */
 
+#include <absl/container/fixed_array.h>
 #include <absl/container/flat_hash_map.h>
 
+#include <async++.h>
+
 #include <geode/tests/common.hpp>
 
+#include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/timer.hpp>
 
 #include <geode/geometry/vector.hpp>
 
@@ -139,11 +144,267 @@ void test_distance_transform_3D( double cell_length )
             "[Test] Wrong 3D euclidean distance map" );
     }
 }
+void test_distance_transform_anisotropic_3D()
+{
+    const auto grid = geode::RegularGrid3D::create();
+    const auto builder = geode::RegularGridBuilder3D::create( *grid );
+    const std::array< double, 3 > cell_lengths{ 1., 2.5, 0.7 };
+    builder->initialize_grid(
+        geode::Point3D{ { 0., 0., 0. } }, { 13, 9, 7 }, cell_lengths );
+    const std::array< const geode::Grid3D::CellIndices, 4 > objects_raster{
+        { { 2, 3, 1 }, { 11, 0, 6 }, { 6, 8, 3 }, { 0, 5, 5 } }
+    };
+    const auto distance_map = geode::euclidean_distance_transform< 3 >(
+        *grid, objects_raster, "test_edt" );
+    const auto runs = geode::grid_cell_runs< 3 >( objects_raster );
+    const auto runs_distance_map = geode::euclidean_distance_transform< 3 >(
+        *grid, runs, "test_edt_runs" );
+    for( const auto cell : geode::Range{ grid->nb_cells() } )
+    {
+        OPENGEODE_EXCEPTION(
+            distance_map->value( cell ) == runs_distance_map->value( cell ),
+            "[Test] Wrong 3D euclidean distance map from cell runs" );
+        const auto cell_indices = grid->cell_indices( cell );
+        auto expected = std::numeric_limits< double >::max();
+        for( const auto& object : objects_raster )
+        {
+            double squared_distance{ 0 };
+            for( const auto d : geode::LRange{ 3 } )
+            {
+                const auto offset = ( static_cast< double >( cell_indices[d] )
+                                        - static_cast< double >( object[d] ) )
+                                    * cell_lengths[d];
+                squared_distance += offset * offset;
+            }
+            expected = std::min( expected, std::sqrt( squared_distance ) );
+        }
+        OPENGEODE_EXCEPTION(
+            std::fabs( distance_map->value( cell ) - expected )
+                < geode::GLOBAL_EPSILON,
+            "[Test] Wrong anisotropic 3D euclidean distance map" );
+    }
+}
+
+/*!
+ * Previous implementation of the 3D transform, only used to compare
+ * timings: propagation along the first direction, then each line of the
+ * other directions is scanned until the step distance exceeds the current
+ * minimum, which becomes quadratic with sparse seeds.
+ */
+class PreviousDistanceTransform3D
+{
+public:
+    PreviousDistanceTransform3D( const geode::Grid3D& grid,
+        absl::Span< const geode::Grid3D::CellIndices > objects_raster )
+        : grid_( grid ),
+          distance_map_{ grid.cell_attribute_manager()
+                             .find_or_create_attribute<
+                                 geode::VariableAttribute, double >(
+                                 "previous_edt",
+                                 std::numeric_limits< double >::max() ) }
+    {
+        for( const auto d : geode::LRange{ 3 } )
+        {
+            squared_cell_length_[d] = grid.cell_length_in_direction( d )
+                                      * grid.cell_length_in_direction( d );
+        }
+        for( const auto& cell : objects_raster )
+        {
+            distance_map_->set_value( grid.cell_index( cell ), 0. );
+        }
+    }
+
+    std::shared_ptr< geode::VariableAttribute< double > > compute()
+    {
+        for_each_line( 0, [this]( geode::Grid3D::CellIndices line ) {
+            propagate( line );
+        } );
+        for( const auto d : geode::LRange{ 1, 3 } )
+        {
+            for_each_line( d, [this, d]( geode::Grid3D::CellIndices line ) {
+                combine( line, d );
+            } );
+        }
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, grid_.nb_cells() ),
+            [this]( geode::index_t cell ) {
+                distance_map_->modify_value( cell, []( double& value ) {
+                    value = std::sqrt( value );
+                } );
+            } );
+        return distance_map_;
+    }
+
+private:
+    template < typename Action >
+    void for_each_line( geode::local_index_t d, const Action& action )
+    {
+        const geode::local_index_t d2 = d == 2 ? 0 : d + 1;
+        const geode::local_index_t d3 = d2 == 2 ? 0 : d2 + 1;
+        std::vector< async::task< void > > tasks;
+        tasks.reserve( grid_.nb_cells_in_direction( d2 )
+                       * grid_.nb_cells_in_direction( d3 ) );
+        for( const auto c3 : geode::Range{ grid_.nb_cells_in_direction( d3 ) } )
+        {
+            for( const auto c2 :
+                geode::Range{ grid_.nb_cells_in_direction( d2 ) } )
+            {
+                geode::Grid3D::CellIndices line;
+                line[d] = 0;
+                line[d2] = c2;
+                line[d3] = c3;
+                tasks.push_back(
+                    async::spawn( [&action, line] { action( line ); } ) );
+            }
+        }
+        for( auto& task : async::when_all( tasks ).get() )
+        {
+            task.get();
+        }
+    }
+
+    void propagate( geode::Grid3D::CellIndices line )
+    {
+        const auto nb_cells = grid_.nb_cells_in_direction( 0 );
+        double step_squared_distance{ 0 };
+        for( const auto c : geode::Range{ 1, nb_cells } )
+        {
+            step_squared_distance =
+                propagate_step( line, c - 1, c, step_squared_distance );
+        }
+        step_squared_distance = 0;
+        for( const auto c : geode::ReverseRange{ nb_cells - 1 } )
+        {
+            step_squared_distance =
+                propagate_step( line, c + 1, c, step_squared_distance );
+        }
+    }
+
+    double propagate_step( geode::Grid3D::CellIndices line,
+        geode::index_t from,
+        geode::index_t to,
+        double last_step_squared_distance )
+    {
+        line[0] = from;
+        const auto old_distance =
+            distance_map_->value( grid_.cell_index( line ) );
+        const auto step_squared_distance =
+            old_distance == 0
+                ? squared_cell_length_[0]
+                : last_step_squared_distance + 2 * squared_cell_length_[0];
+        const auto new_distance = old_distance + step_squared_distance;
+        line[0] = to;
+        distance_map_->modify_value(
+            grid_.cell_index( line ), [new_distance]( double& value ) {
+                value = std::min( value, new_distance );
+            } );
+        return step_squared_distance;
+    }
+
+    void combine( geode::Grid3D::CellIndices line, geode::local_index_t d )
+    {
+        const auto nb_cells = grid_.nb_cells_in_direction( d );
+        const auto squared_distance = [this, d](
+                                          geode::index_t from,
+                                          geode::index_t to ) {
+            const auto distance =
+                static_cast< double >( from ) - static_cast< double >( to );
+            return distance * distance * squared_cell_length_[d];
+        };
+        const auto scan = [this, &line, d, &squared_distance](
+                              geode::index_t c, geode::index_t other,
+                              double& min_distance ) {
+            const auto step_squared_distance = squared_distance( c, other );
+            if( min_distance < step_squared_distance )
+            {
+                return false;
+            }
+            auto cell = line;
+            cell[d] = other;
+            min_distance = std::min( min_distance,
+                distance_map_->value( grid_.cell_index( cell ) )
+                    + step_squared_distance );
+            return true;
+        };
+        absl::FixedArray< double > distances( nb_cells );
+        for( const auto c : geode::Range{ nb_cells } )
+        {
+            auto min_distance = std::numeric_limits< double >::max();
+            for( const auto cf : geode::Range{ c, nb_cells } )
+            {
+                if( !scan( c, cf, min_distance ) )
+                {
+                    break;
+                }
+            }
+            for( const auto cb : geode::ReverseRange{ c, 0 } )
+            {
+                if( !scan( c, cb, min_distance ) )
+                {
+                    break;
+                }
+            }
+            distances[c] = min_distance;
+        }
+        for( const auto c : geode::Range{ nb_cells } )
+        {
+            line[d] = c;
+            distance_map_->set_value( grid_.cell_index( line ), distances[c] );
+        }
+    }
+
+private:
+    const geode::Grid3D& grid_;
+    std::array< double, 3 > squared_cell_length_;
+    std::shared_ptr< geode::VariableAttribute< double > > distance_map_;
+};
+
+void benchmark_distance_transform_3D( geode::index_t nb_cells )
+{
+    const auto grid = geode::RegularGrid3D::create();
+    const auto builder = geode::RegularGridBuilder3D::create( *grid );
+    builder->initialize_grid( geode::Point3D{ { 0., 0., 0. } },
+        { nb_cells, nb_cells, nb_cells }, 1. );
+    const std::array< const geode::Grid3D::CellIndices, 2 > objects_raster{
+        { { 0, 0, 0 }, { nb_cells / 2, nb_cells / 3, nb_cells - 1 } }
+    };
+    geode::Timer timer;
+    const auto distance_map = geode::euclidean_distance_transform< 3 >(
+        *grid, objects_raster, "benchmark_edt" );
+    geode::Logger::info( "Euclidean distance transform on ", nb_cells,
+        "^3 grid: ", timer.duration() );
+    // The previous implementation is quadratic with sparse seeds
+    if( nb_cells > 256 )
+    {
+        return;
+    }
+    timer.reset();
+    const auto previous_distance_map =
+        PreviousDistanceTransform3D{ *grid, objects_raster }.compute();
+    geode::Logger::info( "Previous euclidean distance transform on ",
+        nb_cells, "^3 grid: ", timer.duration() );
+    for( const auto cell : geode::Range{ grid->nb_cells() } )
+    {
+        OPENGEODE_EXCEPTION(
+            std::fabs( distance_map->value( cell )
+                       - previous_distance_map->value( cell ) )
+                < geode::GLOBAL_EPSILON,
+            "[Test] Different euclidean distance maps" );
+    }
+}
+
 void test()
 {
     geode::OpenGeodeMeshLibrary::initialize();
     test_distance_transform_2D( 0.5 );
     test_distance_transform_3D( 4.8 );
+    test_distance_transform_anisotropic_3D();
+#ifdef OPENGEODE_BENCHMARK
+    for( const geode::index_t nb_cells : { 128, 256, 512 } )
+    {
+        benchmark_distance_transform_3D( nb_cells );
+    }
+#endif
 }
 
 OPENGEODE_TEST( "euclidean distance transform" )
\ No newline at end of file
@@ -118,6 +118,44 @@ void test_gradient_triangulated_surface2D()
         *surface, "mesh_with_gradient.og_tsf2d" );
 }
 
+void test_gradients_grid3D( const geode::RegularGrid3D& grid,
+    std::string_view scalar_function_name,
+    std::string_view gradient_name )
+{
+    auto& manager = grid.vertex_attribute_manager();
+    const auto attribute =
+        manager.find_attribute< double >( scalar_function_name );
+    const auto scalar_function_name_2 = "scalar_function_2";
+    auto attribute_2 =
+        manager.find_or_create_attribute< geode::VariableAttribute, double >(
+            scalar_function_name_2, 0 );
+    for( const auto v : geode::Range{ grid.nb_vertices() } )
+    {
+        attribute_2->set_value( v, 2 * attribute->value( v ) );
+    }
+    const std::array< std::string_view, 2 > names{ scalar_function_name,
+        scalar_function_name_2 };
+    const auto gradient_names =
+        geode::compute_solid_scalar_functions_gradients( grid, names );
+    OPENGEODE_EXCEPTION( gradient_names.size() == 2,
+        "[Test] Wrong number of computed gradients" );
+    const auto reference =
+        manager.find_attribute< geode::Vector3D >( gradient_name );
+    const auto gradient =
+        manager.find_attribute< geode::Vector3D >( gradient_names[0] );
+    const auto gradient_2 =
+        manager.find_attribute< geode::Vector3D >( gradient_names[1] );
+    for( const auto v : geode::Range{ grid.nb_vertices() } )
+    {
+        const auto& value = reference->value( v );
+        OPENGEODE_EXCEPTION( gradient->value( v ) == value,
+            "[Test] Wrong gradient value in multiple gradients computation" );
+        OPENGEODE_EXCEPTION( gradient_2->value( v ) == value * 2,
+            "[Test] Wrong second gradient value in multiple gradients "
+            "computation" );
+    }
+}
+
 void test_gradient_grid3D()
 {
     auto grid = geode::RegularGrid< 3 >::create();
@@ -167,6 +205,7 @@ void test_gradient_grid3D()
         "[Test] Wrong number of vertices without value for gradient "
         "computation, ",
         vertices_with_no_value.size(), " instead of 7" );
+    test_gradients_grid3D( *grid, scalar_function_name, gradient_name );
     geode::save_regular_grid< 3 >( *grid, "grid_with_gradient.og_rgd3d" );
 }
 
@@ -126,6 +126,18 @@ void test_create_polyhedra( const geode::HybridSolid3D& hybrid_solid,
         "[Test] HybridSolid should have 22 edges" );
     OPENGEODE_EXCEPTION( !hybrid_solid.is_vertex_isolated( 0 ),
         "[Test] Vertices should not be isolated after polyhedra creation" );
+    const auto prism_facets = hybrid_solid.polyhedron_facets_vertices( 1 );
+    const geode::PolyhedronFacetVertices prism_triangle{ 6, 8, 7 };
+    const geode::PolyhedronFacetVertices prism_quadrangle{ 1, 6, 7, 2 };
+    OPENGEODE_EXCEPTION( prism_facets.size() == 5
+                             && prism_facets[1] == prism_triangle
+                             && prism_facets[2] == prism_quadrangle,
+        "[Test] Wrong prism facet vertices" );
+    const auto pyramid_edges = hybrid_solid.polyhedron_edges_vertices( 2 );
+    const std::array< geode::index_t, 2 > pyramid_edge{ 5, 10 };
+    OPENGEODE_EXCEPTION(
+        pyramid_edges.size() == 8 && pyramid_edges[4] == pyramid_edge,
+        "[Test] Wrong pyramid edge vertices" );
 }
 
 void test_polyhedron_adjacencies( const geode::HybridSolid3D& hybrid_solid,
@@ -264,6 +276,16 @@ void test_permutation(
     OPENGEODE_EXCEPTION( solid.polyhedron_vertex( { 3, 5 } ) == 4,
         "[Test] Wrong PolyhedronVertex after polyhedron permute" );
 
+    OPENGEODE_EXCEPTION( solid.polyhedron_type( 0 )
+                                 == geode::HybridSolid3D::Type::TETRAHEDRON
+                             && solid.polyhedron_type( 1 )
+                                    == geode::HybridSolid3D::Type::PYRAMID
+                             && solid.polyhedron_type( 2 )
+                                    == geode::HybridSolid3D::Type::HEXAHEDRON
+                             && solid.polyhedron_type( 3 )
+                                    == geode::HybridSolid3D::Type::PRISM,
+        "[Test] Wrong polyhedron type after polyhedron permute" );
+
     OPENGEODE_EXCEPTION( solid.polyhedron_adjacent( { 0, 1 } ) == 1,
         "[Test] Wrong Adjacency after polyhedron permute" );
     OPENGEODE_EXCEPTION( solid.polyhedron_adjacent( { 2, 5 } ) == 1,
@@ -312,6 +334,11 @@ void test_delete_polyhedra( const geode::HybridSolid3D& hybrid_solid,
         "[Test] HybridSolid vertex index is not correct" );
     OPENGEODE_EXCEPTION( hybrid_solid.polyhedron_vertex( { 0, 4 } ) == 6,
         "[Test] HybridSolid vertex index is not correct" );
+    OPENGEODE_EXCEPTION( hybrid_solid.polyhedron_type( 0 )
+                                 == geode::HybridSolid3D::Type::PYRAMID
+                             && hybrid_solid.polyhedron_type( 2 )
+                                    == geode::HybridSolid3D::Type::PRISM,
+        "[Test] Wrong polyhedron type after polyhedron deletion" );
     builder.edges_builder().delete_isolated_edges();
     builder.facets_builder().delete_isolated_facets();
     OPENGEODE_EXCEPTION( hybrid_solid.facets().nb_facets() == 14,
@@ -343,6 +370,12 @@ void test_io(
             == hybrid_solid.facets().facet_from_vertices(
                 hybrid_solid.polyhedron_facet_vertices( { 1, 0 } ) ),
         "[Test] Reloaded HybridSolid has wrong polyhedron facet index" );
+    for( const auto p : geode::Range{ hybrid_solid.nb_polyhedra() } )
+    {
+        OPENGEODE_EXCEPTION( new_hybrid_solid->polyhedron_type( p )
+                                 == hybrid_solid.polyhedron_type( p ),
+            "[Test] Reloaded HybridSolid has wrong polyhedron type" );
+    }
 }
 
 void test_clone( const geode::HybridSolid3D& hybrid_solid )
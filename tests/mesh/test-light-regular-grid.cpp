@@ -31,6 +31,7 @@
 #include <geode/geometry/vector.hpp>
 
 #include <geode/mesh/core/light_regular_grid.hpp>
+#include <geode/mesh/helpers/bricked_grid_attribute.hpp>
 #include <geode/mesh/io/light_regular_grid_input.hpp>
 #include <geode/mesh/io/light_regular_grid_output.hpp>
 
@@ -315,6 +316,50 @@ void test_attribute( const geode::LightRegularGrid3D& grid )
         "[Test] Wrong attribute value" );
 }
 
+void test_bricked_attributes( const geode::LightRegularGrid3D& grid )
+{
+    auto cell_attribute =
+        grid.cell_attribute_manager()
+            .find_or_create_attribute< geode::VariableAttribute, double >(
+                "bricked_cells", -1 );
+    cell_attribute->set_value( grid.cell_index( { 1, 2, 3 } ), 4 );
+    const auto cells =
+        geode::bricked_cell_attribute( grid, *cell_attribute, -2. );
+    OPENGEODE_EXCEPTION( cells.nb_cells_in_direction( 0 ) == 5
+                             && cells.nb_cells_in_direction( 1 ) == 10
+                             && cells.nb_cells_in_direction( 2 ) == 15,
+        "[Test] Wrong bricked cell attribute size" );
+    OPENGEODE_EXCEPTION( cells.value( { 1, 2, 3 } ) == 4
+                             && cells.value( { 0, 0, 0 } ) == -1
+                             && cells.value( { 4, 9, 14 } ) == -1,
+        "[Test] Wrong bricked cell attribute value" );
+    OPENGEODE_EXCEPTION( cells.value( { 5, 0, 0 } ) == -2,
+        "[Test] Wrong bricked cell attribute value outside the grid" );
+
+    auto vertex_attribute =
+        grid.grid_vertex_attribute_manager()
+            .find_or_create_attribute< geode::VariableAttribute,
+                geode::index_t >( "bricked_vertices", geode::NO_ID );
+    for( const auto v : geode::Range{ grid.nb_grid_vertices() } )
+    {
+        vertex_attribute->set_value( v, v );
+    }
+    const auto vertices = geode::bricked_vertex_attribute(
+        grid, *vertex_attribute, geode::NO_ID );
+    OPENGEODE_EXCEPTION( vertices.nb_cells_in_direction( 0 ) == 6
+                             && vertices.nb_cells_in_direction( 1 ) == 11
+                             && vertices.nb_cells_in_direction( 2 ) == 16,
+        "[Test] Wrong bricked vertex attribute size" );
+    for( const auto& vertex : { geode::Grid3D::VertexIndices{ 0, 0, 0 },
+             geode::Grid3D::VertexIndices{ 2, 7, 4 },
+             geode::Grid3D::VertexIndices{ 5, 10, 15 } } )
+    {
+        OPENGEODE_EXCEPTION(
+            vertices.value( vertex ) == grid.vertex_index( vertex ),
+            "[Test] Wrong bricked vertex attribute value" );
+    }
+}
+
 void test_io(
     const geode::LightRegularGrid3D& grid, const std::string& filename )
 {
@@ -345,6 +390,7 @@ void test()
     test_boundary_box( grid );
     test_closest_vertex( grid );
     test_attribute( grid );
+    test_bricked_attributes( grid );
     test_io( grid, absl::StrCat( "test.", grid.native_extension() ) );
 }
 
@@ -29,8 +29,60 @@
 #include <geode/geometry/point.hpp>
 
 #include <geode/mesh/builder/solid_mesh_builder.hpp>
+#include <geode/mesh/builder/tetrahedral_solid_builder.hpp>
 #include <geode/mesh/core/solid_mesh.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
 #include <geode/mesh/helpers/convert_solid_mesh.hpp>
+#include <geode/mesh/helpers/detail/solid_merger.hpp>
+
+void test_merge_tetrahedral_solids()
+{
+    const std::array< geode::Point3D, 6 > points{
+        geode::Point3D{ { 0, 0, 0 } },
+        geode::Point3D{ { 1, 0, 0 } },
+        geode::Point3D{ { 0, 1, 0 } },
+        geode::Point3D{ { 0, 0, 1 } },
+        geode::Point3D{ { 1, 1, 1 } },
+        geode::Point3D{ { 2, 2, 0 } },
+    };
+    auto mesh0 = geode::TetrahedralSolid3D::create();
+    auto builder0 = geode::TetrahedralSolidBuilder3D::create( *mesh0 );
+    builder0->create_points( points );
+    builder0->create_tetrahedra(
+        std::vector< std::array< geode::index_t, 4 > >{
+            { 0, 1, 2, 3 }, { 1, 2, 3, 4 } } );
+    builder0->compute_polyhedron_adjacencies();
+
+    auto mesh1 = geode::TetrahedralSolid3D::create();
+    auto builder1 = geode::TetrahedralSolidBuilder3D::create( *mesh1 );
+    builder1->create_points( points );
+    builder1->create_tetrahedra(
+        std::vector< std::array< geode::index_t, 4 > >{
+            { 2, 1, 4, 3 }, { 1, 2, 4, 5 } } );
+    builder1->compute_polyhedron_adjacencies();
+
+    std::vector< std::reference_wrapper< const geode::SolidMesh3D > > meshes{
+        *mesh0, *mesh1
+    };
+    geode::detail::SolidMeshMerger3D merger{ meshes, geode::GLOBAL_EPSILON };
+    const auto merged = merger.merge();
+    OPENGEODE_EXCEPTION(
+        merged->type_name() == geode::TetrahedralSolid3D::type_name_static(),
+        "[Test] Wrong merged tetrahedral solid type" );
+    OPENGEODE_EXCEPTION( merged->nb_vertices() == 6,
+        "[Test] Wrong number of merged tetrahedral solid vertices" );
+    OPENGEODE_EXCEPTION( merged->nb_polyhedra() == 3,
+        "[Test] Wrong number of merged tetrahedra" );
+    OPENGEODE_EXCEPTION( merger.polyhedron_in_merged( 0, 1 ) == 1
+                             && merger.polyhedron_in_merged( 1, 0 ) == 1
+                             && merger.polyhedron_in_merged( 1, 1 ) == 2,
+        "[Test] Wrong merged tetrahedron indices" );
+    OPENGEODE_EXCEPTION( merger.polyhedron_origins( 1 ).size() == 2,
+        "[Test] Wrong number of origins for duplicated tetrahedron" );
+    OPENGEODE_EXCEPTION( merger.polyhedron_origins( 1 )[0].solid == 0
+                             && merger.polyhedron_origins( 1 )[1].solid == 1,
+        "[Test] Wrong order of origins for duplicated tetrahedron" );
+}
 
 void test()
 {
@@ -92,6 +144,8 @@ void test()
         merged->nb_vertices() == 10, "[Test] Wrong number of vertices" );
     OPENGEODE_EXCEPTION(
         merged->nb_polyhedra() == 4, "[Test] Wrong number of polyhedra" );
+
+    test_merge_tetrahedral_solids();
 }
 
 OPENGEODE_TEST( "merge-solid" )
\ No newline at end of file
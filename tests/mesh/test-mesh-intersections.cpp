@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/basic/assert.hpp>
+#include <geode/basic/logger.hpp>
+
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/builder/tetrahedral_solid_builder.hpp>
+#include <geode/mesh/builder/triangulated_surface_builder.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+#include <geode/mesh/helpers/mesh_intersections.hpp>
+
+#include <geode/tests/common.hpp>
+
+std::unique_ptr< geode::TriangulatedSurface3D > build_surface()
+{
+    auto surface = geode::TriangulatedSurface3D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    builder->create_point( geode::Point3D{ { 0, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 1, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 0, 1, 0 } } );
+    builder->create_point( geode::Point3D{ { 1, 1, 0 } } );
+    builder->create_point( geode::Point3D{ { 0.25, 0.25, -1 } } );
+    builder->create_point( geode::Point3D{ { 0.25, 0.25, 1 } } );
+    builder->create_point( geode::Point3D{ { 2, 2, 0 } } );
+    builder->create_triangle( { 0, 1, 2 } );
+    builder->create_triangle( { 1, 3, 2 } );
+    builder->create_triangle( { 4, 5, 6 } );
+    builder->compute_polygon_adjacencies();
+    return surface;
+}
+
+std::unique_ptr< geode::TriangulatedSurface3D > build_other_surface()
+{
+    auto surface = geode::TriangulatedSurface3D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    builder->create_point( geode::Point3D{ { 0.2, 0.1, -1 } } );
+    builder->create_point( geode::Point3D{ { 0.2, 0.1, 1 } } );
+    builder->create_point( geode::Point3D{ { 0.1, 0.2, 0 } } );
+    builder->create_point( geode::Point3D{ { 5, 5, 5 } } );
+    builder->create_point( geode::Point3D{ { 6, 5, 5 } } );
+    builder->create_point( geode::Point3D{ { 5, 6, 5 } } );
+    builder->create_triangle( { 0, 1, 2 } );
+    builder->create_triangle( { 3, 4, 5 } );
+    return surface;
+}
+
+void test_surfaces()
+{
+    const auto surface = build_surface();
+    const auto self_intersections =
+        geode::surface_self_intersections( *surface );
+    const std::vector< geode::ElementsIntersection > self_answer{ { 0, 2 },
+        { 1, 2 } };
+    OPENGEODE_EXCEPTION( self_intersections == self_answer,
+        "[Test] Wrong surface self-intersections" );
+
+    const auto other_surface = build_other_surface();
+    const auto intersections =
+        geode::surfaces_intersections( *surface, *other_surface );
+    const std::vector< geode::ElementsIntersection > answer{ { 0, 0 } };
+    OPENGEODE_EXCEPTION(
+        intersections == answer, "[Test] Wrong surfaces intersections" );
+}
+
+std::unique_ptr< geode::TriangulatedSurface3D > build_conformal_surface()
+{
+    auto surface = geode::TriangulatedSurface3D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    builder->create_point( geode::Point3D{ { 0, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 1, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 0.5, -1, 1 } } );
+    builder->create_triangle( { 0, 1, 2 } );
+    return surface;
+}
+
+void test_conformal_surfaces()
+{
+    const auto surface = build_surface();
+    const auto other_surface = build_conformal_surface();
+    const auto intersections =
+        geode::surfaces_intersections( *surface, *other_surface );
+    const std::vector< geode::ElementsIntersection > answer{ { 0, 0 },
+        { 1, 0 } };
+    OPENGEODE_EXCEPTION( intersections == answer,
+        "[Test] Wrong touching surfaces intersections" );
+    OPENGEODE_EXCEPTION(
+        geode::conformal_surfaces_intersections( *surface, *other_surface )
+            .empty(),
+        "[Test] Wrong conformal surfaces intersections" );
+}
+
+std::unique_ptr< geode::TriangulatedSurface2D > build_surface2D()
+{
+    auto surface = geode::TriangulatedSurface2D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder2D::create( *surface );
+    builder->create_point( geode::Point2D{ { 0, 0 } } );
+    builder->create_point( geode::Point2D{ { 1, 0 } } );
+    builder->create_point( geode::Point2D{ { 0, 1 } } );
+    builder->create_point( geode::Point2D{ { 3, 0 } } );
+    builder->create_point( geode::Point2D{ { 4, 0 } } );
+    builder->create_point( geode::Point2D{ { 3, 1 } } );
+    builder->create_triangle( { 0, 1, 2 } );
+    builder->create_triangle( { 3, 4, 5 } );
+    return surface;
+}
+
+std::unique_ptr< geode::TriangulatedSurface2D > build_other_surface2D()
+{
+    auto surface = geode::TriangulatedSurface2D::create();
+    auto builder = geode::TriangulatedSurfaceBuilder2D::create( *surface );
+    builder->create_point( geode::Point2D{ { 1, 0 } } );
+    builder->create_point( geode::Point2D{ { 0, 1 } } );
+    builder->create_point( geode::Point2D{ { 1, 1 } } );
+    builder->create_point( geode::Point2D{ { 3.2, 0.2 } } );
+    builder->create_point( geode::Point2D{ { 5, 0.2 } } );
+    builder->create_point( geode::Point2D{ { 3.2, 2 } } );
+    builder->create_point( geode::Point2D{ { 0, 0 } } );
+    builder->create_point( geode::Point2D{ { -1, 0 } } );
+    builder->create_point( geode::Point2D{ { 0, -1 } } );
+    builder->create_point( geode::Point2D{ { 0.6, 0.6 } } );
+    builder->create_point( geode::Point2D{ { 0.1, 0.6 } } );
+    // Shares an edge, overlaps, shares a vertex and crosses
+    builder->create_triangle( { 0, 2, 1 } );
+    builder->create_triangle( { 3, 4, 5 } );
+    builder->create_triangle( { 6, 7, 8 } );
+    builder->create_triangle( { 6, 9, 10 } );
+    return surface;
+}
+
+void test_surfaces2D()
+{
+    const auto surface = build_surface2D();
+    const auto other_surface = build_other_surface2D();
+    const auto intersections =
+        geode::surfaces_intersections( *surface, *other_surface );
+    const std::vector< geode::ElementsIntersection > answer{ { 0, 0 },
+        { 0, 2 }, { 0, 3 }, { 1, 1 } };
+    OPENGEODE_EXCEPTION(
+        intersections == answer, "[Test] Wrong 2D surfaces intersections" );
+
+    const auto conformal_intersections =
+        geode::conformal_surfaces_intersections( *surface, *other_surface );
+    const std::vector< geode::ElementsIntersection > conformal_answer{
+        { 0, 3 }, { 1, 1 }
+    };
+    OPENGEODE_EXCEPTION( conformal_intersections == conformal_answer,
+        "[Test] Wrong 2D conformal surfaces intersections" );
+}
+
+std::unique_ptr< geode::TetrahedralSolid3D > build_solid()
+{
+    auto solid = geode::TetrahedralSolid3D::create();
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    builder->create_point( geode::Point3D{ { 0, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 1, 0, 0 } } );
+    builder->create_point( geode::Point3D{ { 0, 1, 0 } } );
+    builder->create_point( geode::Point3D{ { 0, 0, 1 } } );
+    builder->create_point( geode::Point3D{ { 1, 1, 1 } } );
+    builder->create_point( geode::Point3D{ { 0.1, 0.1, 0.1 } } );
+    builder->create_point( geode::Point3D{ { 0.3, 0.1, 0.1 } } );
+    builder->create_point( geode::Point3D{ { 0.1, 0.3, 0.1 } } );
+    builder->create_point( geode::Point3D{ { 0.1, 0.1, 0.3 } } );
+    builder->create_tetrahedron( { 0, 3, 1, 2 } );
+    builder->create_tetrahedron( { 4, 1, 3, 2 } );
+    builder->create_tetrahedron( { 5, 8, 6, 7 } );
+    builder->compute_polyhedron_adjacencies();
+    return solid;
+}
+
+std::unique_ptr< geode::TetrahedralSolid3D > build_other_solid()
+{
+    auto solid = geode::TetrahedralSolid3D::create();
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    builder->create_point( geode::Point3D{ { 0.9, 0.9, 0.9 } } );
+    builder->create_point( geode::Point3D{ { 1.5, 0.9, 0.9 } } );
+    builder->create_point( geode::Point3D{ { 0.9, 1.5, 0.9 } } );
+    builder->create_point( geode::Point3D{ { 0.9, 0.9, 1.5 } } );
+    builder->create_point( geode::Point3D{ { 1, 1, 1 } } );
+    builder->create_point( geode::Point3D{ { 2, 1, 1 } } );
+    builder->create_point( geode::Point3D{ { 1, 2, 1 } } );
+    builder->create_point( geode::Point3D{ { 1, 1, 2 } } );
+    builder->create_tetrahedron( { 0, 3, 1, 2 } );
+    // Touches the first solid on a colocated vertex
+    builder->create_tetrahedron( { 4, 7, 5, 6 } );
+    return solid;
+}
+
+void test_solids()
+{
+    const auto solid = build_solid();
+    const auto self_intersections =
+        geode::tetrahedral_solid_self_intersections( *solid );
+    const std::vector< geode::ElementsIntersection > self_answer{ { 0, 2 } };
+    OPENGEODE_EXCEPTION( self_intersections == self_answer,
+        "[Test] Wrong solid self-intersections" );
+
+    const auto other_solid = build_other_solid();
+    const auto intersections =
+        geode::tetrahedral_solids_intersections( *solid, *other_solid );
+    const std::vector< geode::ElementsIntersection > answer{ { 1, 0 },
+        { 1, 1 } };
+    OPENGEODE_EXCEPTION(
+        intersections == answer, "[Test] Wrong solids intersections" );
+
+    const auto conformal_intersections =
+        geode::conformal_tetrahedral_solids_intersections(
+            *solid, *other_solid );
+    const std::vector< geode::ElementsIntersection > conformal_answer{ {
+        1, 0 } };
+    OPENGEODE_EXCEPTION( conformal_intersections == conformal_answer,
+        "[Test] Wrong conformal solids intersections" );
+}
+
+void test()
+{
+    geode::OpenGeodeMeshLibrary::initialize();
+    test_surfaces();
+    test_conformal_surfaces();
+    test_surfaces2D();
+    test_solids();
+}
+
+OPENGEODE_TEST( "mesh-intersections" )
@@ -31,6 +31,7 @@
 #include <geode/mesh/builder/geode/geode_polygonal_surface_builder.hpp>
 #include <geode/mesh/builder/surface_edges_builder.hpp>
 #include <geode/mesh/core/geode/geode_polygonal_surface.hpp>
+#include <geode/mesh/core/mesh_element_ranges.hpp>
 #include <geode/mesh/core/polygonal_surface.hpp>
 #include <geode/mesh/core/surface_edges.hpp>
 #include <geode/mesh/io/polygonal_surface_input.hpp>
@@ -185,6 +186,14 @@ void test_create_polygons( const geode::PolygonalSurface3D& polygonal_surface,
     geode::PolygonVertices answer{ 1, 3, 4, 2 };
     OPENGEODE_EXCEPTION( polygonal_surface.polygon_vertices( 1 ) == answer,
         "[Test] Wrong polygon vertices list" );
+    geode::PolygonVertices range_vertices;
+    for( const auto vertex_id :
+        geode::PolygonVerticesRange{ polygonal_surface, 1 } )
+    {
+        range_vertices.push_back( vertex_id );
+    }
+    OPENGEODE_EXCEPTION(
+        range_vertices == answer, "[Test] Wrong polygon vertices range" );
 }
 
 void test_create_edge_attribute(
@@ -32,6 +32,7 @@
 #include <geode/mesh/builder/solid_edges_builder.hpp>
 #include <geode/mesh/builder/solid_facets_builder.hpp>
 #include <geode/mesh/core/geode/geode_polyhedral_solid.hpp>
+#include <geode/mesh/core/mesh_element_ranges.hpp>
 #include <geode/mesh/core/solid_edges.hpp>
 #include <geode/mesh/core/solid_facets.hpp>
 #include <geode/mesh/io/polyhedral_solid_input.hpp>
@@ -116,6 +117,30 @@ void test_create_polyhedra( const geode::PolyhedralSolid3D& polyhedral_solid,
     geode::PolyhedronVertices answer{ 3, 4, 5, 6 };
     OPENGEODE_EXCEPTION( polyhedral_solid.polyhedron_vertices( 1 ) == answer,
         "[Test] Wrong polyhedron vertices list" );
+    const auto facets = polyhedral_solid.polyhedron_facets_vertices( 0 );
+    const geode::PolyhedronFacetVertices facet_answer{ 0, 3, 4, 1 };
+    OPENGEODE_EXCEPTION( facets.size() == 5 && facets[2] == facet_answer,
+        "[Test] Wrong polyhedron facets vertices" );
+    const auto edges = polyhedral_solid.polyhedron_edges_vertices( 0 );
+    const std::array< geode::index_t, 2 > edge_answer{ 0, 3 };
+    OPENGEODE_EXCEPTION( edges.size() == 9 && edges[3] == edge_answer,
+        "[Test] Wrong polyhedron edges vertices" );
+    geode::PolyhedronVertices range_vertices;
+    for( const auto vertex_id :
+        geode::PolyhedronVerticesRange{ polyhedral_solid, 1 } )
+    {
+        range_vertices.push_back( vertex_id );
+    }
+    OPENGEODE_EXCEPTION(
+        range_vertices == answer, "[Test] Wrong polyhedron vertices range" );
+    geode::PolyhedronFacetVertices range_facet_vertices;
+    for( const auto vertex_id :
+        geode::PolyhedronFacetVerticesRange{ polyhedral_solid, { 0, 2 } } )
+    {
+        range_facet_vertices.push_back( vertex_id );
+    }
+    OPENGEODE_EXCEPTION( range_facet_vertices == facet_answer,
+        "[Test] Wrong polyhedron facet vertices range" );
 }
 
 void test_create_facet_attribute(
@@ -23,19 +23,24 @@
 
 #include <geode/tests/common.hpp>
 
+#include <absl/algorithm/container.h>
 #include <absl/container/flat_hash_set.h>
 
 #include <geode/basic/assert.hpp>
 #include <geode/basic/logger.hpp>
 
 #include <geode/geometry/basic_objects/segment.hpp>
+#include <geode/geometry/basic_objects/tetrahedron.hpp>
 #include <geode/geometry/basic_objects/triangle.hpp>
 #include <geode/geometry/point.hpp>
 
 #include <geode/mesh/builder/regular_grid_solid_builder.hpp>
 #include <geode/mesh/builder/regular_grid_surface_builder.hpp>
+#include <geode/mesh/builder/tetrahedral_solid_builder.hpp>
+#include <geode/mesh/builder/triangulated_surface_builder.hpp>
 #include <geode/mesh/core/regular_grid_solid.hpp>
 #include <geode/mesh/core/regular_grid_surface.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
 #include <geode/mesh/core/triangulated_surface.hpp>
 #include <geode/mesh/helpers/rasterize.hpp>
 #include <geode/mesh/io/regular_grid_input.hpp>
@@ -216,6 +221,109 @@ void test_limit()
         all_cells.size(), " instead of 27" );
 }
 
+void test_rasterize_tetrahedron_runs( const geode::RegularGrid3D& grid )
+{
+    const geode::Point3D pt0{ { 1.2, 1.3, 1.1 } };
+    const geode::Point3D pt1{ { 8.7, 2.1, 1.4 } };
+    const geode::Point3D pt2{ { 2.3, 8.6, 2.2 } };
+    const geode::Point3D pt3{ { 3.1, 2.9, 8.8 } };
+    const geode::Tetrahedron tetrahedron{ pt0, pt1, pt2, pt3 };
+    auto cells = geode::rasterize_tetrahedron( grid, tetrahedron );
+    const auto runs = geode::rasterize_tetrahedron_runs( grid, tetrahedron );
+    std::vector< geode::Grid3D::CellIndices > run_cells;
+    for( const auto& run : runs )
+    {
+        auto cell = run.first_cell;
+        for( const auto r : geode::Range{ run.nb_cells } )
+        {
+            cell[0] = run.first_cell[0] + r;
+            run_cells.push_back( cell );
+        }
+    }
+    absl::c_sort( cells );
+    absl::c_sort( run_cells );
+    OPENGEODE_EXCEPTION( !cells.empty() && cells == run_cells,
+        "[Test] Wrong cells (rasterize_tetrahedron_runs)" );
+    const auto merged_runs = geode::grid_cell_runs< 3 >( cells );
+    OPENGEODE_EXCEPTION( merged_runs.size() == runs.size(),
+        "[Test] Wrong number of runs (grid_cell_runs): ", merged_runs.size(),
+        " instead of ", runs.size() );
+}
+
+void test_rasterize_tetrahedral_solid()
+{
+    auto grid = geode::RegularGrid3D::create();
+    auto builder = geode::RegularGridBuilder3D::create( *grid );
+    builder->initialize_grid(
+        geode::Point3D{ { 0., 0., 0. } }, { 40, 40, 40 }, 1 );
+    auto solid = geode::TetrahedralSolid3D::create();
+    auto solid_builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    solid_builder->create_point( geode::Point3D{ { 2.1, 3.2, 1.7 } } );
+    solid_builder->create_point( geode::Point3D{ { 37.4, 5.1, 4.3 } } );
+    solid_builder->create_point( geode::Point3D{ { 20.2, 36.8, 6.6 } } );
+    solid_builder->create_point( geode::Point3D{ { 18.3, 17.9, 38.2 } } );
+    solid_builder->create_point( geode::Point3D{ { 30.6, 33.1, 35.4 } } );
+    solid_builder->create_tetrahedron( { 0, 1, 2, 3 } );
+    solid_builder->create_tetrahedron( { 1, 2, 3, 4 } );
+    const auto ids = geode::rasterize_tetrahedral_solid(
+        *grid, *solid, "tetrahedra", geode::RASTERIZATION_VALUE::element_id );
+    const auto counts = geode::rasterize_tetrahedral_solid( *grid, *solid,
+        "nb_tetrahedra", geode::RASTERIZATION_VALUE::nb_elements );
+    std::vector< geode::index_t > expected_ids(
+        grid->nb_cells(), geode::NO_ID );
+    std::vector< geode::index_t > expected_counts( grid->nb_cells(), 0 );
+    for( const auto t : geode::Range{ solid->nb_polyhedra() } )
+    {
+        for( const auto& cell :
+            geode::rasterize_tetrahedron( *grid, solid->tetrahedron( t ) ) )
+        {
+            const auto cell_id = grid->cell_index( cell );
+            expected_ids[cell_id] = std::min( expected_ids[cell_id], t );
+            expected_counts[cell_id]++;
+        }
+    }
+    for( const auto cell : geode::Range{ grid->nb_cells() } )
+    {
+        OPENGEODE_EXCEPTION( ids->value( cell ) == expected_ids[cell],
+            "[Test] Wrong tetrahedron id (rasterize_tetrahedral_solid)" );
+        OPENGEODE_EXCEPTION( counts->value( cell ) == expected_counts[cell],
+            "[Test] Wrong tetrahedron count (rasterize_tetrahedral_solid)" );
+    }
+}
+
+void test_rasterize_triangulated_surface()
+{
+    auto grid = geode::RegularGrid3D::create();
+    auto builder = geode::RegularGridBuilder3D::create( *grid );
+    builder->initialize_grid(
+        geode::Point3D{ { 0., 0., 0. } }, { 40, 40, 40 }, 1 );
+    auto surface = geode::TriangulatedSurface3D::create();
+    auto surface_builder =
+        geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    surface_builder->create_point( geode::Point3D{ { 2.1, 3.2, 1.7 } } );
+    surface_builder->create_point( geode::Point3D{ { 37.4, 5.1, 4.3 } } );
+    surface_builder->create_point( geode::Point3D{ { 20.2, 36.8, 6.6 } } );
+    surface_builder->create_point( geode::Point3D{ { 18.3, 17.9, 38.2 } } );
+    surface_builder->create_triangle( { 0, 1, 2 } );
+    surface_builder->create_triangle( { 1, 2, 3 } );
+    const auto counts = geode::rasterize_triangulated_surface( *grid,
+        *surface, "nb_triangles", geode::RASTERIZATION_VALUE::nb_elements );
+    std::vector< geode::index_t > expected_counts( grid->nb_cells(), 0 );
+    for( const auto t : geode::Range{ surface->nb_polygons() } )
+    {
+        for( const auto& cell : geode::conservative_rasterize_triangle(
+                 *grid, surface->triangle( t ) ) )
+        {
+            expected_counts[grid->cell_index( cell )]++;
+        }
+    }
+    for( const auto cell : geode::Range{ grid->nb_cells() } )
+    {
+        OPENGEODE_EXCEPTION( counts->value( cell ) == expected_counts[cell],
+            "[Test] Wrong triangle count (rasterize_triangulated_surface)" );
+    }
+}
+
 void test()
 {
     geode::OpenGeodeMeshLibrary::initialize();
@@ -237,6 +345,9 @@ void test()
         *grid, geode::Triangle3D{ pt0, pt3, pt4 } );
 
     test_limit();
+    test_rasterize_tetrahedron_runs( *grid );
+    test_rasterize_tetrahedral_solid();
+    test_rasterize_triangulated_surface();
 }
 
 OPENGEODE_TEST( "rasterize" )
\ No newline at end of file
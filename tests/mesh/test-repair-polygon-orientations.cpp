@@ -157,6 +157,47 @@ void compare_edges(
     }
 }
 
+void test_components3D()
+{
+    auto surface = geode::SurfaceMesh3D::create();
+    auto builder = geode::SurfaceMeshBuilder3D::create( *surface );
+    builder->create_vertices( 8 );
+    builder->create_polygon( { 0, 1, 2 } );
+    builder->create_polygon( { 1, 2, 3 } );
+    builder->create_polygon( { 4, 5, 6 } );
+    builder->create_polygon( { 4, 5, 7 } );
+    builder->compute_polygon_adjacencies();
+    geode::repair_polygon_orientations( *surface );
+    const std::array< std::array< geode::index_t, 3 >, 4 > expected{ {
+        { 0, 1, 2 },
+        { 1, 3, 2 },
+        { 4, 5, 6 },
+        { 4, 7, 5 },
+    } };
+    for( const auto p : geode::Range{ 4 } )
+    {
+        for( const auto v : geode::LRange{ 3 } )
+        {
+            OPENGEODE_EXCEPTION(
+                surface->polygon_vertex( { p, v } ) == expected[p][v],
+                "[Test] Wrong vertex for PolygonVertex ( ", p, ", ", v,
+                " ) in 3D components" );
+        }
+    }
+    OPENGEODE_EXCEPTION( surface->polygon_adjacent( { 1, 2 } ) == 0,
+        "[Test] Wrong adjacent for reversed polygon 1" );
+    OPENGEODE_EXCEPTION( surface->polygon_adjacent( { 3, 2 } ) == 2,
+        "[Test] Wrong adjacent for reversed polygon 3" );
+    for( const auto v : geode::Range{ 8 } )
+    {
+        const auto polygon_vertex = surface->polygon_around_vertex( v );
+        OPENGEODE_EXCEPTION( polygon_vertex
+                                 && surface->polygon_vertex( *polygon_vertex )
+                                        == v,
+            "[Test] Wrong polygon around vertex ", v );
+    }
+}
+
 void test()
 {
     geode::OpenGeodeMeshLibrary::initialize();
@@ -167,6 +208,7 @@ void test()
     check_repaired_surface( *wrong_surface );
     const auto edges_after = get_edges( *wrong_surface );
     compare_edges( edges_before, edges_after );
+    test_components3D();
 }
 
 OPENGEODE_TEST( "repair-polygon-orientations" )
\ No newline at end of file
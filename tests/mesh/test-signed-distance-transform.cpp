@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2019 - 2025 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+
+#include <geode/tests/common.hpp>
+
+#include <geode/basic/logger.hpp>
+
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/builder/regular_grid_solid_builder.hpp>
+#include <geode/mesh/builder/triangulated_surface_builder.hpp>
+#include <geode/mesh/core/regular_grid_solid.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+#include <geode/mesh/helpers/signed_distance_transform.hpp>
+
+namespace
+{
+    const geode::Point3D box_min{ { 5.3, 4.8, 5.1 } };
+    const geode::Point3D box_max{ { 14.7, 15.1, 14.6 } };
+
+    std::unique_ptr< geode::TriangulatedSurface3D > create_box()
+    {
+        auto surface = geode::TriangulatedSurface3D::create();
+        auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+        for( const auto v : geode::LRange{ 8 } )
+        {
+            const auto x = ( ( v + 1 ) / 2 ) % 2 == 0 ? box_min.value( 0 )
+                                                      : box_max.value( 0 );
+            const auto y = ( v / 2 ) % 2 == 0 ? box_min.value( 1 )
+                                              : box_max.value( 1 );
+            const auto z = v < 4 ? box_min.value( 2 ) : box_max.value( 2 );
+            builder->create_point( geode::Point3D{ { x, y, z } } );
+        }
+        const std::array< std::array< geode::index_t, 3 >, 12 > triangles{ {
+            { 0, 2, 1 },
+            { 0, 3, 2 },
+            { 4, 5, 6 },
+            { 4, 6, 7 },
+            { 0, 1, 5 },
+            { 0, 5, 4 },
+            { 3, 7, 6 },
+            { 3, 6, 2 },
+            { 0, 4, 7 },
+            { 0, 7, 3 },
+            { 1, 2, 6 },
+            { 1, 6, 5 },
+        } };
+        for( const auto& triangle : triangles )
+        {
+            builder->create_triangle( triangle );
+        }
+        return surface;
+    }
+
+    double box_signed_distance( const geode::Point3D& point )
+    {
+        double outside{ 0 };
+        auto inside = std::numeric_limits< double >::lowest();
+        for( const auto d : geode::LRange{ 3 } )
+        {
+            const auto offset =
+                std::max( box_min.value( d ) - point.value( d ),
+                    point.value( d ) - box_max.value( d ) );
+            inside = std::max( inside, offset );
+            const auto positive_offset = std::max( offset, 0. );
+            outside += positive_offset * positive_offset;
+        }
+        return inside > 0 ? std::sqrt( outside ) : inside;
+    }
+} // namespace
+
+void test_signed_distance(
+    const geode::RegularGrid3D& grid, const geode::TriangulatedSurface3D& box )
+{
+    const auto distance_map =
+        geode::signed_distance_transform( grid, box, "sdf" );
+    for( const auto cell : geode::Range{ grid.nb_cells() } )
+    {
+        const auto expected = box_signed_distance(
+            grid.cell_barycenter( grid.cell_indices( cell ) ) );
+        OPENGEODE_EXCEPTION(
+            std::fabs( distance_map->value( cell ) - expected )
+                < geode::GLOBAL_EPSILON,
+            "[Test] Wrong signed distance for cell ", cell, ": ",
+            distance_map->value( cell ), " instead of ", expected );
+    }
+}
+
+void test_narrow_band(
+    const geode::RegularGrid3D& grid, const geode::TriangulatedSurface3D& box )
+{
+    constexpr double narrow_band{ 2.5 };
+    const auto distance_map =
+        geode::signed_distance_transform( grid, box, "sdf", narrow_band );
+    for( const auto cell : geode::Range{ grid.nb_cells() } )
+    {
+        const auto expected = box_signed_distance(
+            grid.cell_barycenter( grid.cell_indices( cell ) ) );
+        const auto clamped_expected =
+            std::clamp( expected, -narrow_band, narrow_band );
+        OPENGEODE_EXCEPTION(
+            std::fabs( distance_map->value( cell ) - clamped_expected )
+                < geode::GLOBAL_EPSILON,
+            "[Test] Wrong narrow band signed distance for cell ", cell, ": ",
+            distance_map->value( cell ), " instead of ", clamped_expected );
+    }
+}
+
+void test()
+{
+    geode::OpenGeodeMeshLibrary::initialize();
+    const auto grid = geode::RegularGrid3D::create();
+    const auto builder = geode::RegularGridBuilder3D::create( *grid );
+    builder->initialize_grid(
+        geode::Point3D{ { 0., 0., 0. } }, { 20, 20, 20 }, 1. );
+    const auto box = create_box();
+    test_signed_distance( *grid, *box );
+    test_narrow_band( *grid, *box );
+}
+
+OPENGEODE_TEST( "signed-distance-transform" )
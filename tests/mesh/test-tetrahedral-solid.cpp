@@ -26,8 +26,10 @@
 
 #include <geode/geometry/basic_objects/tetrahedron.hpp>
 #include <geode/geometry/basic_objects/triangle.hpp>
+#include <geode/geometry/bounding_box.hpp>
 #include <geode/geometry/mensuration.hpp>
 #include <geode/geometry/point.hpp>
+#include <geode/geometry/vector.hpp>
 
 #include <geode/mesh/builder/geode/geode_tetrahedral_solid_builder.hpp>
 #include <geode/mesh/builder/solid_edges_builder.hpp>
@@ -376,6 +378,156 @@ void test_delete_all( const geode::TetrahedralSolid3D& solid,
         "[Test] TetrahedralSolid should have 0 vertex" );
 }
 
+void test_bulk_creation()
+{
+    auto solid = geode::TetrahedralSolid3D::create(
+        geode::OpenGeodeTetrahedralSolid3D::impl_name_static() );
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    solid->enable_facets();
+    solid->enable_edges();
+    const std::array< geode::Point3D, 5 > points{
+        geode::Point3D{ { 0, 0, 0 } }, geode::Point3D{ { 1, 0, 0 } },
+        geode::Point3D{ { 0, 1, 0 } }, geode::Point3D{ { 0, 0, 1 } },
+        geode::Point3D{ { 1, 1, 1 } }
+    };
+    OPENGEODE_EXCEPTION( builder->create_points( points ) == 0,
+        "[Test] Wrong first point created in bulk" );
+    OPENGEODE_EXCEPTION( solid->nb_vertices() == 5
+                             && solid->point( 4 ) == points[4],
+        "[Test] Wrong points created in bulk" );
+    const std::array< std::array< geode::index_t, 4 >, 2 > tetrahedra{
+        { { 0, 1, 2, 3 }, { 1, 2, 3, 4 } }
+    };
+    OPENGEODE_EXCEPTION( builder->create_tetrahedra( tetrahedra ) == 0,
+        "[Test] Wrong first tetrahedron created in bulk" );
+    OPENGEODE_EXCEPTION( solid->nb_polyhedra() == 2,
+        "[Test] TetrahedralSolid should have 2 tetrahedra" );
+    OPENGEODE_EXCEPTION( solid->polyhedron_vertex( { 1, 3 } ) == 4,
+        "[Test] Wrong tetrahedron vertex created in bulk" );
+    const auto around = solid->polyhedron_around_vertex( 4 );
+    OPENGEODE_EXCEPTION( around && around->polyhedron_id == 1,
+        "[Test] Wrong polyhedron around vertex after bulk creation" );
+    OPENGEODE_EXCEPTION( solid->facets().nb_facets() == 7,
+        "[Test] TetrahedralSolid should have 7 facets" );
+    OPENGEODE_EXCEPTION( solid->edges().nb_edges() == 9,
+        "[Test] TetrahedralSolid should have 9 edges" );
+    builder->compute_polyhedron_adjacencies();
+    OPENGEODE_EXCEPTION( solid->polyhedron_adjacent( { 0, 0 } ) == 1,
+        "[Test] Wrong adjacency after bulk creation" );
+}
+
+void test_parallel_facets_and_edges()
+{
+    auto serial = geode::TetrahedralSolid3D::create(
+        geode::OpenGeodeTetrahedralSolid3D::impl_name_static() );
+    auto serial_builder = geode::TetrahedralSolidBuilder3D::create( *serial );
+    serial->enable_facets();
+    serial->enable_edges();
+    auto bulk = geode::TetrahedralSolid3D::create(
+        geode::OpenGeodeTetrahedralSolid3D::impl_name_static() );
+    auto bulk_builder = geode::TetrahedralSolidBuilder3D::create( *bulk );
+    auto enabled = geode::TetrahedralSolid3D::create(
+        geode::OpenGeodeTetrahedralSolid3D::impl_name_static() );
+    auto enabled_builder = geode::TetrahedralSolidBuilder3D::create( *enabled );
+    constexpr geode::index_t nb_vertices{ 50 };
+    serial_builder->create_vertices( nb_vertices );
+    bulk_builder->create_vertices( nb_vertices );
+    enabled_builder->create_vertices( nb_vertices );
+    std::vector< std::array< geode::index_t, 4 > > tetrahedra;
+    for( const auto t : geode::Range{ 10000 } )
+    {
+        const auto base = t % 40;
+        tetrahedra.push_back( { base, base + 1 + t % 3, base + 5 + t % 4,
+            base + 10 } );
+        serial_builder->create_tetrahedron( tetrahedra.back() );
+    }
+    bulk->enable_facets();
+    bulk->enable_edges();
+    bulk_builder->create_tetrahedra( tetrahedra );
+    enabled_builder->create_tetrahedra( tetrahedra );
+    enabled->enable_facets();
+    enabled->enable_edges();
+    for( const auto* solid : { bulk.get(), enabled.get() } )
+    {
+        OPENGEODE_EXCEPTION(
+            solid->facets().nb_facets() == serial->facets().nb_facets(),
+            "[Test] Wrong number of facets built in parallel" );
+        for( const auto f : geode::Range{ serial->facets().nb_facets() } )
+        {
+            OPENGEODE_EXCEPTION( solid->facets().facet_vertices( f )
+                                     == serial->facets().facet_vertices( f ),
+                "[Test] Wrong facet built in parallel" );
+        }
+        OPENGEODE_EXCEPTION(
+            solid->edges().nb_edges() == serial->edges().nb_edges(),
+            "[Test] Wrong number of edges built in parallel" );
+        for( const auto e : geode::Range{ serial->edges().nb_edges() } )
+        {
+            OPENGEODE_EXCEPTION( solid->edges().edge_vertices( e )
+                                     == serial->edges().edge_vertices( e ),
+                "[Test] Wrong edge built in parallel" );
+        }
+    }
+}
+
+void test_geometric_cache()
+{
+    auto solid = geode::TetrahedralSolid3D::create(
+        geode::OpenGeodeTetrahedralSolid3D::impl_name_static() );
+    auto builder = geode::TetrahedralSolidBuilder3D::create( *solid );
+    const std::array< geode::Point3D, 5 > points{
+        geode::Point3D{ { 0, 0, 0 } }, geode::Point3D{ { 1, 0, 0 } },
+        geode::Point3D{ { 0, 1, 0 } }, geode::Point3D{ { 0, 0, 1 } },
+        geode::Point3D{ { 1, 1, 1 } }
+    };
+    builder->create_points( points );
+    const std::array< std::array< geode::index_t, 4 >, 2 > tetrahedra{
+        { { 0, 1, 2, 3 }, { 1, 2, 3, 4 } }
+    };
+    builder->create_tetrahedra( tetrahedra );
+    builder->compute_polyhedron_adjacencies();
+    const auto volume0 = solid->polyhedron_volume( 0 );
+    const auto volume1 = solid->polyhedron_volume( 1 );
+    const auto normal = solid->polyhedron_facet_normal( { 1, 2 } );
+    solid->enable_geometric_cache();
+    OPENGEODE_EXCEPTION( solid->polyhedron_volume( 0 ) == volume0
+                             && solid->polyhedron_volume( 1 ) == volume1,
+        "[Test] Wrong cached polyhedron volumes" );
+    OPENGEODE_EXCEPTION(
+        solid->polyhedron_facet_normal( { 1, 2 } ) == normal,
+        "[Test] Wrong cached polyhedron facet normal" );
+    OPENGEODE_EXCEPTION( solid->polyhedron_bounding_box( 0 ).max()
+                             == solid->bounding_box().max(),
+        "[Test] Wrong cached polyhedron bounding box" );
+
+    builder->set_point( 4, geode::Point3D{ { 2, 2, 2 } } );
+    const auto cached_volume = solid->polyhedron_volume( 1 );
+    const auto cached_normal = solid->polyhedron_facet_normal( { 1, 2 } );
+    const auto cached_barycenter = solid->polyhedron_barycenter( 1 );
+    OPENGEODE_EXCEPTION( solid->polyhedron_volume( 0 ) == volume0,
+        "[Test] Cached polyhedron volume should not be modified" );
+    solid->disable_geometric_cache();
+    OPENGEODE_EXCEPTION( cached_volume != volume1
+                             && cached_volume == solid->polyhedron_volume( 1 ),
+        "[Test] Cached polyhedron volume should be updated after "
+        "set_point" );
+    OPENGEODE_EXCEPTION(
+        cached_normal == solid->polyhedron_facet_normal( { 1, 2 } ),
+        "[Test] Cached polyhedron facet normal should be updated after "
+        "set_point" );
+    OPENGEODE_EXCEPTION( cached_barycenter == solid->polyhedron_barycenter( 1 ),
+        "[Test] Cached polyhedron barycenter should be updated after "
+        "set_point" );
+
+    solid->enable_geometric_cache();
+    builder->set_polyhedron_vertex( { 1, 0 }, 0 );
+    const auto replaced_volume = solid->polyhedron_volume( 1 );
+    solid->disable_geometric_cache();
+    OPENGEODE_EXCEPTION( replaced_volume == solid->polyhedron_volume( 1 ),
+        "[Test] Cached polyhedron volume should be updated after "
+        "set_polyhedron_vertex" );
+}
+
 void test()
 {
     geode::OpenGeodeMeshLibrary::initialize();
@@ -395,6 +547,9 @@ void test()
     test_delete_polyhedron( *solid, *builder );
     test_clone( *solid );
     test_delete_all( *solid, *builder );
+    test_bulk_creation();
+    test_parallel_facets_and_edges();
+    test_geometric_cache();
 }
 
 OPENGEODE_TEST( "tetrahedral-solid" )
\ No newline at end of file
@@ -50,6 +50,30 @@ geode::RasterImage2D create_raster()
     return raster;
 }
 
+void test_texture_sampling( geode::Texture2D& texture )
+{
+    OPENGEODE_EXCEPTION( texture.nb_mipmap_levels() == 1,
+        "[Test] Wrong number of mipmap levels before build" );
+    texture.build_mipmaps();
+    OPENGEODE_EXCEPTION( texture.nb_mipmap_levels() == 5,
+        "[Test] Wrong number of mipmap levels" );
+    OPENGEODE_EXCEPTION( texture.mipmap( 1 ).nb_cells() == 25,
+        "[Test] Wrong mipmap dimensions" );
+    const std::vector< geode::Point2D > coordinates{
+        geode::Point2D{ { 0.05, 0.05 } }, geode::Point2D{ { 0.15, 0.1 } }
+    };
+    const auto values = texture.texture_values( coordinates, 0 );
+    OPENGEODE_EXCEPTION( values[0] == geode::RGBColor( 0, 0, 0 )
+                             && values[1] == geode::RGBColor( 6, 6, 6 ),
+        "[Test] Wrong texture values" );
+    OPENGEODE_EXCEPTION( texture.texture_value( coordinates[1], 1 )
+                             == geode::RGBColor( 7, 7, 7 ),
+        "[Test] Wrong texture value on level 1" );
+    OPENGEODE_EXCEPTION( texture.texture_value( coordinates[1], 0.5 )
+                             == geode::RGBColor( 7, 7, 7 ),
+        "[Test] Wrong texture value between levels" );
+}
+
 void create_texture(
     geode::AttributeManager& attributes, geode::TextureStorage2D& storage )
 {
@@ -61,6 +85,7 @@ void create_texture(
             { i, 0 }, geode::Point2D{ { i * 2., i * 3. } } );
     }
     texture.set_image( create_raster() );
+    test_texture_sampling( texture );
 }
 
 void check_texture(
@@ -74,6 +99,8 @@ void check_texture(
         OPENGEODE_EXCEPTION( texture.texture_coordinates( { i, 0 } ) == coord,
             "[Test] Wrong texture coordinates" );
     }
+    OPENGEODE_EXCEPTION( texture.nb_mipmap_levels() == 1,
+        "[Test] Mipmaps should not be serialized" );
     const auto& image = texture.image();
     for( const auto i : geode::LRange{ 100 } )
     {
@@ -24,10 +24,14 @@
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/logger.hpp>
 
+#include <geode/geometry/bounding_box.hpp>
 #include <geode/geometry/point.hpp>
+#include <geode/geometry/vector.hpp>
 
+#include <geode/mesh/builder/coordinate_reference_system_manager_builder.hpp>
 #include <geode/mesh/builder/geode/geode_triangulated_surface_builder.hpp>
 #include <geode/mesh/builder/surface_edges_builder.hpp>
+#include <geode/mesh/core/coordinate_reference_system.hpp>
 #include <geode/mesh/core/geode/geode_triangulated_surface.hpp>
 #include <geode/mesh/core/surface_edges.hpp>
 #include <geode/mesh/io/triangulated_surface_input.hpp>
@@ -267,6 +271,144 @@ void test_delete_all( const geode::TriangulatedSurface3D& triangulated_surface,
         "[Test]TriangulatedSurface should have 0 vertex" );
 }
 
+void test_bulk_creation()
+{
+    auto surface = geode::TriangulatedSurface3D::create(
+        geode::OpenGeodeTriangulatedSurface3D::impl_name_static() );
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    surface->enable_edges();
+    const std::array< geode::Point3D, 4 > points{
+        geode::Point3D{ { 0, 0, 0 } }, geode::Point3D{ { 1, 0, 0 } },
+        geode::Point3D{ { 0, 1, 0 } }, geode::Point3D{ { 1, 1, 0 } }
+    };
+    builder->create_points( points );
+    const std::array< std::array< geode::index_t, 3 >, 2 > triangles{
+        { { 0, 1, 2 }, { 1, 3, 2 } }
+    };
+    OPENGEODE_EXCEPTION( builder->create_triangles( triangles ) == 0,
+        "[Test] Wrong first triangle created in bulk" );
+    OPENGEODE_EXCEPTION( surface->nb_polygons() == 2
+                             && surface->polygon_vertex( { 1, 1 } ) == 3,
+        "[Test] Wrong triangles created in bulk" );
+    const auto around = surface->polygon_around_vertex( 3 );
+    OPENGEODE_EXCEPTION( around && around->polygon_id == 1,
+        "[Test] Wrong polygon around vertex after bulk creation" );
+    OPENGEODE_EXCEPTION( surface->edges().nb_edges() == 5,
+        "[Test] TriangulatedSurface should have 5 edges" );
+}
+
+void test_geometric_cache()
+{
+    auto surface = geode::TriangulatedSurface3D::create(
+        geode::OpenGeodeTriangulatedSurface3D::impl_name_static() );
+    auto builder = geode::TriangulatedSurfaceBuilder3D::create( *surface );
+    const std::array< geode::Point3D, 4 > points{
+        geode::Point3D{ { 0, 0, 0 } }, geode::Point3D{ { 1, 0, 0 } },
+        geode::Point3D{ { 0, 1, 0 } }, geode::Point3D{ { 1, 1, 0 } }
+    };
+    builder->create_points( points );
+    const std::array< std::array< geode::index_t, 3 >, 2 > triangles{
+        { { 0, 1, 2 }, { 1, 3, 2 } }
+    };
+    builder->create_triangles( triangles );
+    builder->compute_polygon_adjacencies();
+    const auto nb_attributes =
+        surface->polygon_attribute_manager().attribute_names().size();
+    surface->enable_geometric_cache();
+    OPENGEODE_EXCEPTION( surface->is_geometric_cache_enabled(),
+        "[Test] Geometric cache should be enabled" );
+    OPENGEODE_EXCEPTION(
+        surface->polygon_attribute_manager().attribute_names().size()
+            == nb_attributes,
+        "[Test] Geometric cache should not be stored in an attribute" );
+    OPENGEODE_EXCEPTION(
+        std::fabs( surface->polygon_area( 0 ) - 0.5 ) < geode::GLOBAL_EPSILON,
+        "[Test] Wrong cached polygon area" );
+    OPENGEODE_EXCEPTION( surface->polygon_normal( 0 )->inexact_equal(
+                             geode::Vector3D{ { 0, 0, 1 } } ),
+        "[Test] Wrong cached polygon normal" );
+    OPENGEODE_EXCEPTION( surface->polygon_barycenter( 1 ).inexact_equal(
+                             geode::Point3D{ { 2. / 3., 2. / 3., 0 } } ),
+        "[Test] Wrong cached polygon barycenter" );
+
+    const geode::Point3D moved_point{ { 2, 2, 0 } };
+    builder->set_point( 3, moved_point );
+    OPENGEODE_EXCEPTION(
+        std::fabs( surface->polygon_area( 1 ) - 1.5 ) < geode::GLOBAL_EPSILON,
+        "[Test] Cached polygon area should be updated after set_point" );
+    OPENGEODE_EXCEPTION(
+        surface->polygon_bounding_box( 1 ).max() == moved_point,
+        "[Test] Cached polygon bounding box should be updated after "
+        "set_point" );
+    OPENGEODE_EXCEPTION(
+        std::fabs( surface->polygon_area( 0 ) - 0.5 ) < geode::GLOBAL_EPSILON,
+        "[Test] Cached polygon area should not be modified" );
+
+    builder->set_polygon_vertex( { 1, 1 }, 0 );
+    OPENGEODE_EXCEPTION( surface->polygon_normal( 1 )->inexact_equal(
+                             geode::Vector3D{ { 0, 0, -1 } } ),
+        "[Test] Cached polygon normal should be updated after "
+        "set_polygon_vertex" );
+
+    surface->disable_geometric_cache();
+    OPENGEODE_EXCEPTION( !surface->is_geometric_cache_enabled(),
+        "[Test] Geometric cache should be disabled" );
+}
+
+void test_geometric_cache_without_adjacencies()
+{
+    auto surface = geode::TriangulatedSurface2D::create(
+        geode::OpenGeodeTriangulatedSurface2D::impl_name_static() );
+    auto builder = geode::TriangulatedSurfaceBuilder2D::create( *surface );
+    const std::array< geode::Point2D, 4 > points{
+        geode::Point2D{ { 0, 0 } }, geode::Point2D{ { 1, 0 } },
+        geode::Point2D{ { 0, 1 } }, geode::Point2D{ { 1, 1 } }
+    };
+    builder->create_points( points );
+    const std::array< std::array< geode::index_t, 3 >, 2 > triangles{
+        { { 0, 1, 2 }, { 2, 1, 3 } }
+    };
+    builder->create_triangles( triangles );
+    surface->enable_geometric_cache();
+
+    builder->set_point( 1, geode::Point2D{ { 2, 0 } } );
+    OPENGEODE_EXCEPTION(
+        std::fabs( surface->polygon_area( 0 ) - 1 ) < geode::GLOBAL_EPSILON
+            && std::fabs( surface->polygon_area( 1 ) - 0.5 )
+                   < geode::GLOBAL_EPSILON,
+        "[Test] Cached polygon areas should be updated without "
+        "adjacencies" );
+    surface->enable_geometric_cache();
+    OPENGEODE_EXCEPTION(
+        std::fabs( surface->polygon_area( 1 ) - 0.5 ) < geode::GLOBAL_EPSILON,
+        "[Test] Cached polygon area should be computed again" );
+    builder->set_point( 3, geode::Point2D{ { 2, 2 } } );
+    OPENGEODE_EXCEPTION(
+        std::fabs( surface->polygon_area( 0 ) - 1 ) < geode::GLOBAL_EPSILON
+            && std::fabs( surface->polygon_area( 1 ) - 2 )
+                   < geode::GLOBAL_EPSILON,
+        "[Test] Only polygons around the moved vertex should be outdated" );
+
+    const auto filename =
+        absl::StrCat( "cached_surface.", surface->native_extension() );
+    geode::save_triangulated_surface( *surface, filename );
+    OPENGEODE_EXCEPTION( surface->is_geometric_cache_enabled(),
+        "[Test] Geometric cache should be kept after saving" );
+    const auto reload = geode::load_triangulated_surface< 2 >( filename );
+    OPENGEODE_EXCEPTION( !reload->is_geometric_cache_enabled(),
+        "[Test] Geometric cache should not be saved" );
+
+    auto& crs = builder->main_coordinate_reference_system_manager_builder()
+                    .active_coordinate_reference_system();
+    OPENGEODE_EXCEPTION( !surface->is_geometric_cache_enabled(),
+        "[Test] Geometric cache should be disabled by write access to "
+        "points" );
+    crs.set_point( 0, geode::Point2D{ { 0, -1 } } );
+    OPENGEODE_EXCEPTION(
+        std::fabs( surface->polygon_area( 0 ) - 2 ) < geode::GLOBAL_EPSILON,
+        "[Test] Polygon area should use modified points" );
+}
+
 void test()
 {
     geode::OpenGeodeMeshLibrary::initialize();
@@ -282,6 +424,9 @@ void test()
     test_permutation( *surface, *builder );
     test_delete_polygon( *surface, *builder );
     test_clone( *surface );
+    test_bulk_creation();
+    test_geometric_cache();
+    test_geometric_cache_without_adjacencies();
 }
 
 OPENGEODE_TEST( "triangulated-surface" )
\ No newline at end of file
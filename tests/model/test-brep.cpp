@@ -22,6 +22,7 @@
  */
 
 #include <geode/basic/assert.hpp>
+#include <geode/basic/io_profiler.hpp>
 #include <geode/basic/logger.hpp>
 #include <geode/basic/range.hpp>
 #include <geode/basic/uuid.hpp>
@@ -1331,6 +1332,56 @@ void test_components_filter()
         "[Test] Wrong number of components with relations" );
 }
 
+bool has_profile_stage(
+    const geode::IOProfile& profile, std::string_view stage_name )
+{
+    for( const auto& stage : profile.stages )
+    {
+        if( stage.name == stage_name )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void test_io_profile( const geode::BRep& model, std::string_view filename )
+{
+    std::vector< geode::IOProfile > profiles;
+    geode::IOProfiler::set_hook(
+        [&profiles]( const geode::IOProfile& profile ) {
+            profiles.push_back( profile );
+        } );
+    geode::save_brep( model, filename );
+    const auto model2 = geode::load_brep( filename );
+    geode::IOProfiler::set_hook( {} );
+    OPENGEODE_EXCEPTION(
+        profiles.size() == 2, "[Test] Wrong number of I/O profiles" );
+    const auto& save_profile = profiles.front();
+    OPENGEODE_EXCEPTION( has_profile_stage( save_profile, "BRep zip" )
+                             && has_profile_stage( save_profile,
+                                 "BRep mesh components" ),
+        "[Test] Missing stages in save profile" );
+    const auto& load_profile = profiles.back();
+    OPENGEODE_EXCEPTION( load_profile.name
+                             == absl::StrCat( "BRep load ", filename ),
+        "[Test] Wrong load profile name" );
+    OPENGEODE_EXCEPTION(
+        load_profile.bytes > 0, "[Test] Wrong load profile bytes" );
+    OPENGEODE_EXCEPTION( has_profile_stage( load_profile, "BRep unzip" )
+                             && has_profile_stage( load_profile,
+                                 "BRep unique vertices" ),
+        "[Test] Missing stages in load profile" );
+    const auto nb_meshes = model.nb_corners() + model.nb_lines()
+                           + model.nb_surfaces() + model.nb_blocks();
+    OPENGEODE_EXCEPTION( load_profile.stages.size() > nb_meshes,
+        "[Test] Component mesh loads should be profiled" );
+    const auto utilization = load_profile.thread_utilization();
+    OPENGEODE_EXCEPTION( utilization > 0 && utilization <= 1,
+        "[Test] Wrong thread utilization" );
+    geode::Logger::info( load_profile.string() );
+}
+
 std::tuple< geode::BRep, geode::ModelCopyMapping > copy_model(
     geode::BRep& brep )
 {
@@ -1418,6 +1469,17 @@ void test()
     geode::BRep model3{ std::move( model2 ) };
     test_compare_brep( model, model3 );
 
+    const auto async_file_io =
+        absl::StrCat( "test_async.", model.native_extension() );
+    auto saving = geode::save_brep_async( model, async_file_io );
+    const auto saved_files = saving.get();
+    OPENGEODE_EXCEPTION(
+        saved_files.size() == 1 && saved_files.front() == async_file_io,
+        "[Test] Wrong files saved in background" );
+    test_compare_brep( model, geode::load_brep( async_file_io ) );
+
+    test_io_profile( model, file_io );
+
     test_backward_io();
     test_components_filter();
 }
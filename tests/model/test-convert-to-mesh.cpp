@@ -26,11 +26,15 @@
 #include <geode/basic/range.hpp>
 #include <geode/basic/uuid.hpp>
 
+#include <geode/geometry/point.hpp>
+
 #include <geode/mesh/core/edged_curve.hpp>
 #include <geode/mesh/core/solid_mesh.hpp>
 #include <geode/mesh/core/surface_mesh.hpp>
 
 #include <geode/model/helpers/convert_to_mesh.hpp>
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/core/brep.hpp>
 #include <geode/model/representation/core/section.hpp>
 #include <geode/model/representation/io/brep_input.hpp>
@@ -38,6 +42,80 @@
 
 #include <geode/tests/common.hpp>
 
+template < typename Model >
+void check_surface_polygons( const Model& model,
+    const geode::SurfaceMesh< Model::dim >& mesh,
+    const geode::ModelToMeshMappings& mappings )
+{
+    geode::index_t nb_polygons{ 0 };
+    for( const auto& surface : model.surfaces() )
+    {
+        const auto& surface_mesh = surface.mesh();
+        for( const auto polygon : geode::Range{ surface_mesh.nb_polygons() } )
+        {
+            const auto& mesh_polygons =
+                mappings.surface_polygons_mapping.in2out(
+                    { surface.id(), polygon } );
+            OPENGEODE_EXCEPTION( mesh_polygons.size() == 1,
+                "[Test] Wrong surface polygon mapping" );
+            const auto nb_vertices =
+                surface_mesh.nb_polygon_vertices( polygon );
+            OPENGEODE_EXCEPTION(
+                mesh.nb_polygon_vertices( mesh_polygons[0] ) == nb_vertices,
+                "[Test] Wrong number of converted polygon vertices" );
+            for( const auto v : geode::LRange{ nb_vertices } )
+            {
+                const auto& point = mesh.point(
+                    mesh.polygon_vertex( { mesh_polygons[0], v } ) );
+                OPENGEODE_EXCEPTION(
+                    point.inexact_equal( surface_mesh.point(
+                        surface_mesh.polygon_vertex( { polygon, v } ) ) ),
+                    "[Test] Wrong converted polygon vertex" );
+            }
+            nb_polygons++;
+        }
+    }
+    OPENGEODE_EXCEPTION( nb_polygons == mesh.nb_polygons(),
+        "[Test] Wrong number of converted polygons" );
+}
+
+void check_block_polyhedra( const geode::BRep& model,
+    const geode::SolidMesh3D& mesh,
+    const geode::ModelToMeshMappings& mappings )
+{
+    geode::index_t nb_polyhedra{ 0 };
+    for( const auto& block : model.blocks() )
+    {
+        const auto& block_mesh = block.mesh();
+        for( const auto polyhedron :
+            geode::Range{ block_mesh.nb_polyhedra() } )
+        {
+            const auto& mesh_polyhedra =
+                mappings.solid_polyhedra_mapping.in2out(
+                    { block.id(), polyhedron } );
+            OPENGEODE_EXCEPTION( mesh_polyhedra.size() == 1,
+                "[Test] Wrong block polyhedron mapping" );
+            const auto nb_vertices =
+                block_mesh.nb_polyhedron_vertices( polyhedron );
+            OPENGEODE_EXCEPTION(
+                mesh.nb_polyhedron_vertices( mesh_polyhedra[0] ) == nb_vertices,
+                "[Test] Wrong number of converted polyhedron vertices" );
+            for( const auto v : geode::LRange{ nb_vertices } )
+            {
+                const auto& point = mesh.point(
+                    mesh.polyhedron_vertex( { mesh_polyhedra[0], v } ) );
+                OPENGEODE_EXCEPTION(
+                    point.inexact_equal( block_mesh.point(
+                        block_mesh.polyhedron_vertex( { polyhedron, v } ) ) ),
+                    "[Test] Wrong converted polyhedron vertex" );
+            }
+            nb_polyhedra++;
+        }
+    }
+    OPENGEODE_EXCEPTION( nb_polyhedra == mesh.nb_polyhedra(),
+        "[Test] Wrong number of converted polyhedra" );
+}
+
 void run_test_brep()
 {
     auto model = geode::load_brep(
@@ -47,17 +125,20 @@ void run_test_brep()
         "[Test] BRep - Wrong number of curve vertices" );
     OPENGEODE_EXCEPTION(
         curve->nb_edges() == 162, "[Test] BRep - Wrong number of curve edges" );
-    const auto surface =
-        std::get< 0 >( geode::convert_brep_into_surface( model ) );
+    const auto [surface, surface_mappings] =
+        geode::convert_brep_into_surface( model );
     OPENGEODE_EXCEPTION( surface->nb_vertices() == 840,
         "[Test] BRep - Wrong number of surface vertices" );
     OPENGEODE_EXCEPTION( surface->nb_polygons() == 1716,
         "[Test] BRep - Wrong number of surface polygons" );
-    const auto solid = std::get< 0 >( geode::convert_brep_into_solid( model ) );
+    check_surface_polygons( model, *surface, surface_mappings );
+    const auto [solid, solid_mappings] =
+        geode::convert_brep_into_solid( model );
     OPENGEODE_EXCEPTION( solid->nb_vertices() == 1317,
         "[Test] BRep - Wrong number of solid vertices" );
     OPENGEODE_EXCEPTION( solid->nb_polyhedra() == 5709,
         "[Test] BRep - Wrong number of solid polyhedra" );
+    check_block_polyhedra( model, *solid, solid_mappings );
 }
 
 void run_test_section()
@@ -71,12 +152,13 @@ void run_test_section()
         "[Test] Section - Wrong number of curve vertices" );
     OPENGEODE_EXCEPTION( curve->nb_edges() == 0,
         "[Test] Section - Wrong number of curve edges" );
-    const auto surface =
-        std::get< 0 >( geode::convert_section_into_surface( model ) );
+    const auto [surface, surface_mappings] =
+        geode::convert_section_into_surface( model );
     OPENGEODE_EXCEPTION( surface->nb_vertices() == 4,
         "[Test] Section - Wrong number of surface vertices" );
     OPENGEODE_EXCEPTION( surface->nb_polygons() == 1,
         "[Test] Section - Wrong number of surface polygons" );
+    check_surface_polygons( model, *surface, surface_mappings );
 }
 
 void test()
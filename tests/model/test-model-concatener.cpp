@@ -23,8 +23,12 @@
 
 #include <geode/basic/assert.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/timer.hpp>
+
+#include <geode/mesh/core/solid_mesh.hpp>
 
 #include <geode/model/helpers/model_concatener.hpp>
+#include <geode/model/mixin/core/block.hpp>
 #include <geode/model/representation/core/brep.hpp>
 #include <geode/model/representation/io/brep_input.hpp>
 #include <geode/model/representation/io/brep_output.hpp>
@@ -52,6 +56,49 @@ void check_concatenation(
         " ModelBoundaries" );
 }
 
+void concatenate_layers( geode::index_t nb_copies )
+{
+    const auto layers = geode::load_brep(
+        absl::StrCat( geode::DATA_PATH, "layers.og_brep" ) );
+    std::vector< std::reference_wrapper< const geode::BRep > > copies(
+        nb_copies, layers );
+    geode::BRep brep;
+    geode::Timer timer;
+    geode::BRepConcatener concatener{ brep };
+    const auto mappings = concatener.concatenate( copies );
+    geode::Logger::info( "Concatenation of ", nb_copies,
+        " layers models: ", timer.duration() );
+    OPENGEODE_EXCEPTION( mappings.size() == nb_copies,
+        "[Test] Wrong number of concatenation mappings" );
+    check_concatenation( brep,
+        std::array< geode::index_t, 5 >{ nb_copies * layers.nb_corners(),
+            nb_copies * layers.nb_lines(), nb_copies * layers.nb_surfaces(),
+            nb_copies * layers.nb_blocks(),
+            nb_copies * layers.nb_model_boundaries() } );
+    OPENGEODE_EXCEPTION(
+        brep.nb_unique_vertices() == nb_copies * layers.nb_unique_vertices(),
+        "[Test] Concatenated model has ", brep.nb_unique_vertices(),
+        " unique vertices, should have ",
+        nb_copies * layers.nb_unique_vertices() );
+    const auto& block_mapping =
+        mappings.back().at( geode::Block3D::component_type_static() );
+    const auto first_unique_vertex =
+        ( nb_copies - 1 ) * layers.nb_unique_vertices();
+    for( const auto& block : layers.blocks() )
+    {
+        const auto& block_copy =
+            brep.block( block_mapping.in2out( block.id() ) );
+        for( const auto v : geode::Range{ block.mesh().nb_vertices() } )
+        {
+            OPENGEODE_EXCEPTION(
+                brep.unique_vertex( { block_copy.component_id(), v } )
+                    == first_unique_vertex
+                           + layers.unique_vertex( { block.component_id(), v } ),
+                "[Test] Wrong unique vertex in concatenated model" );
+        }
+    }
+}
+
 void test()
 {
     geode::OpenGeodeModelLibrary::initialize();
@@ -69,6 +116,14 @@ void test()
     concatener.concatenate( brep2 );
     check_concatenation( brep, nb_components );
     geode::save_brep( brep, "concatenated_brep.og_brep" );
+
+    concatenate_layers( 3 );
+#ifdef OPENGEODE_BENCHMARK
+    for( const geode::index_t nb_copies : { 10, 50, 200 } )
+    {
+        concatenate_layers( nb_copies );
+    }
+#endif
 }
 
 OPENGEODE_TEST( "model-concatener" )
\ No newline at end of file
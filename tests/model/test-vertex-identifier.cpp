@@ -128,9 +128,25 @@ void test_set_unique_vertices(
         "[Test] Unique vertex should have component mesh vertices of type "
         "Corner" );
 
+    const auto range0 = vertex_identifier.component_mesh_vertices_range( 0 );
+    OPENGEODE_EXCEPTION( range0.size() == 2,
+        "[Test] Range of unique vertices is not correct" );
+    geode::index_t cmv_id{ 0 };
+    for( const auto& cmv : range0 )
+    {
+        OPENGEODE_EXCEPTION( cmv.component_mesh_vertex() == uvertices0[cmv_id],
+            "[Test] Range of unique vertices is not correct" );
+        cmv_id++;
+    }
+    OPENGEODE_EXCEPTION( cmv_id == 2,
+        "[Test] Range of unique vertices is not correct" );
+
     const auto& uvertices3 = vertex_identifier.component_mesh_vertices( 3 );
     OPENGEODE_EXCEPTION( uvertices3.size() == 0,
         "[Test] Search of unique vertices is not correct" );
+    OPENGEODE_EXCEPTION(
+        vertex_identifier.component_mesh_vertices_range( 3 ).empty(),
+        "[Test] Range of unique vertices is not correct" );
 }
 
 void test_modify_unique_vertices( geode::VertexIdentifier& vertex_identifier )
@@ -231,6 +247,79 @@ void test_update_unique_vertices()
     }
 }
 
+void test_bulk_set_unique_vertices()
+{
+    SurfaceProvider provider;
+    SurfaceProviderBuilder builder( provider );
+    const auto& surface0_id = builder.add_surface();
+    const auto& surface1_id = builder.add_surface();
+    builder.surface_mesh_builder( surface0_id )->create_vertices( 4 );
+    builder.surface_mesh_builder( surface1_id )->create_vertices( 3 );
+    const auto surface0_cid = provider.surface( surface0_id ).component_id();
+    const auto surface1_cid = provider.surface( surface1_id ).component_id();
+    builder.create_unique_vertices( 5 );
+
+    const std::array< geode::index_t, 4 > surface0_unique_vertices{ 0, 1, 2,
+        3 };
+    const std::array< geode::index_t, 3 > surface1_unique_vertices{ 2, 3, 4 };
+    builder.set_unique_vertices(
+        { { surface0_cid, surface0_unique_vertices },
+            { surface1_cid, surface1_unique_vertices } } );
+    OPENGEODE_EXCEPTION( provider.component_mesh_vertices( 2 ).size() == 2,
+        "[Test] Bulk set_unique_vertices is not correct (shared)" );
+    OPENGEODE_EXCEPTION(
+        provider.unique_vertex( { surface1_cid, 2 } ) == 4,
+        "[Test] Bulk set_unique_vertices is not correct (unique vertex)" );
+
+    const std::array< geode::index_t, 3 > new_surface1_unique_vertices{ 0,
+        geode::NO_ID, 4 };
+    builder.set_unique_vertices( surface1_cid, new_surface1_unique_vertices );
+    OPENGEODE_EXCEPTION( provider.component_mesh_vertices( 0 ).size() == 2,
+        "[Test] Bulk set_unique_vertices is not correct (moved)" );
+    OPENGEODE_EXCEPTION( provider.component_mesh_vertices( 2 ).size() == 1,
+        "[Test] Bulk set_unique_vertices is not correct (removed)" );
+    OPENGEODE_EXCEPTION( provider.component_mesh_vertices( 3 ).size() == 1,
+        "[Test] Bulk set_unique_vertices is not correct (unset)" );
+    OPENGEODE_EXCEPTION(
+        provider.unique_vertex( { surface1_cid, 1 } ) == geode::NO_ID,
+        "[Test] Bulk set_unique_vertices is not correct (NO_ID)" );
+    OPENGEODE_EXCEPTION( provider.component_mesh_vertices( 4 ).size() == 1,
+        "[Test] Bulk set_unique_vertices is not correct (unchanged)" );
+
+    const auto is_rejected =
+        [&builder]( absl::Span< const geode::ComponentUniqueVertices >
+                components_vertices ) {
+            try
+            {
+                builder.set_unique_vertices( components_vertices );
+            }
+            catch( const geode::OpenGeodeException& /*unused*/ )
+            {
+                return true;
+            }
+            return false;
+        };
+    const std::array< geode::index_t, 3 > out_of_range_unique_vertices{ 0, 1,
+        5 };
+    OPENGEODE_EXCEPTION(
+        is_rejected( { { surface0_cid, surface0_unique_vertices },
+            { surface0_cid, surface0_unique_vertices } } ),
+        "[Test] Bulk set_unique_vertices should reject duplicated "
+        "components" );
+    OPENGEODE_EXCEPTION(
+        is_rejected( { { surface0_cid, surface1_unique_vertices } } ),
+        "[Test] Bulk set_unique_vertices should reject wrong sizes" );
+    OPENGEODE_EXCEPTION(
+        is_rejected( { { surface0_cid, surface0_unique_vertices },
+            { surface1_cid, out_of_range_unique_vertices } } ),
+        "[Test] Bulk set_unique_vertices should reject unknown unique "
+        "vertices" );
+    OPENGEODE_EXCEPTION( provider.component_mesh_vertices( 4 ).size() == 1
+                             && provider.component_mesh_vertices( 3 ).size()
+                                    == 1,
+        "[Test] Rejected set_unique_vertices should not modify vertices" );
+}
+
 void test()
 {
     geode::OpenGeodeModelLibrary::initialize();
@@ -266,6 +355,7 @@ void test()
     test_save_and_load_unique_vertices( vertex_identifier );
 
     test_update_unique_vertices();
+    test_bulk_set_unique_vertices();
 
     builder.unregister_mesh_component( provider.corner( corner2_id ) );
     builder.register_mesh_component( provider.corner( corner2_id ) );